@@ -27,6 +27,7 @@ set(OMR_JITBUILDER ON CACHE BOOL "")
 set(OMR_GC_SEGREGATED_HEAP ON CACHE BOOL "")
 set(OMR_GC_MODRON_SCAVENGER ON CACHE BOOL "")
 set(OMR_GC_MODRON_CONCURRENT_MARK ON CACHE BOOL "")
+set(OMR_GC_MODRON_COMPACTION ON CACHE BOOL "")
 set(OMR_GC_VLHGC ON CACHE BOOL "")
 set(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD ON CACHE BOOL "")
 set(OMR_SEPARATE_DEBUG_INFO ON CACHE BOOL "")
@@ -77,8 +77,12 @@ public:
 	void
 	verifyHeap(MM_EnvironmentBase *env, MM_MarkMap *markMap) { }
 
+	/**
+	 * Fix up the root table, the object table and the objects saved by each thread, which
+	 * are the references the example VM holds outside the heap.
+	 */
 	void
-	fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme) { }
+	fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme);
 
 	void
 	workerCleanupAfterGC(MM_EnvironmentBase *env) { }
@@ -87,9 +91,9 @@ public:
 	mainSetupForGC(MM_EnvironmentBase *env) { }
 
 	MM_CompactDelegate()
-		: _compactScheme(NULL)
+		: _omrVM(NULL)
+		, _compactScheme(NULL)
 		, _markMap(NULL)
-		, _omrVM(NULL)
 	{}
 };
 
@@ -41,6 +41,9 @@ class MM_ConfigurationDelegate
  */
 private:
 	const MM_GCPolicy _gcPolicy;
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	OMR_SizeClasses _sizeClasses; /**< Storage for the size classes, filled in by MM_SizeClasses::initialize() */
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 protected:
 public:
@@ -134,7 +137,7 @@ public:
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	OMR_SizeClasses *getSegregatedSizeClasses(MM_EnvironmentBase *env)
 	{
-		return NULL;
+		return &_sizeClasses;
 	}
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
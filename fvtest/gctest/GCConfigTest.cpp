@@ -28,6 +28,7 @@
 #include "omrgc.h"
 #include "SlotObject.hpp"
 #include "StandardWriteBarrier.hpp"
+#include "VerboseGCDecoder.hpp"
 #include "VerboseWriterChain.hpp"
 
 //#define OMRGCTEST_PRINTFILE
@@ -43,12 +44,32 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/work_stealing_GC_config.xml"
+                        , "fvtest/gctest/configuration/scan_prefetch_mark_GC_config.xml"
+                        , "fvtest/gctest/configuration/heap_sizing_GC_config.xml"
+                        , "fvtest/gctest/configuration/background_decommit_GC_config.xml"
+#if defined(OMR_GC_MODRON_COMPACTION)
+                        , "fvtest/gctest/configuration/incremental_compact_GC_config.xml"
+#endif
+#if defined(OMR_GC_SEGREGATED_HEAP)
+                        , "fvtest/gctest/configuration/lazy_sweep_segregated_GC_config.xml"
+#endif
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+                        , "fvtest/gctest/configuration/tlh_adaptive_GC_config.xml"
+                        , "fvtest/gctest/configuration/allocation_sampling_GC_config.xml"
+#endif
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
+                        , "fvtest/gctest/configuration/dirty_card_summary_GC_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
                         , "fvtest/gctest/configuration/scavenger_GC_config.xml"
                         , "fvtest/gctest/configuration/scavenger_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_numa_GC_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_tenure_prediction_GC_config.xml"
+                        , "fvtest/gctest/configuration/scan_prefetch_scavenger_GC_config.xml"
+                        , "fvtest/gctest/configuration/mixed_page_size_GC_config.xml"
+                        , "fvtest/gctest/configuration/binary_verbose_GC_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/gencon_GC_config.xml"
@@ -57,7 +78,20 @@ const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         };
 
 const char *perfTests[] = {"perftest/gctest/configuration/21645_core.20150126.202455.11862202.0001.xml",
-								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"};
+								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml",
+								"perftest/gctest/configuration/fragmented_allocation_latency.xml",
+								"perftest/gctest/configuration/fragmented_allocation_latency_size_class_index.xml",
+								"perftest/gctest/configuration/parallel_mark_work_packets.xml",
+								"perftest/gctest/configuration/parallel_mark_work_stealing.xml"};
+
+static int
+compareLatency(const void *left, const void *right)
+{
+	uint64_t leftLatency = *(const uint64_t *)left;
+	uint64_t rightLatency = *(const uint64_t *)right;
+	return (leftLatency < rightLatency) ? -1 : ((leftLatency > rightLatency) ? 1 : 0);
+}
+
 void
 GCConfigTest::SetUp()
 {
@@ -830,7 +864,7 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 	do {
 		pugi::xml_document verboseDoc;
 		if (0 == numOfFiles) {
-			verboseDoc.load_file(verboseFile);
+			loadVerboseLog(verboseDoc, verboseFile);
 			gcTestEnv->log("Parsing verbose log %s:\n", verboseFile);
 #if defined(OMRGCTEST_PRINTFILE)
 			printFile(verboseFile);
@@ -838,7 +872,7 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 		} else {
 			char currentVerboseFile[MAX_NAME_LENGTH];
 			omrstr_printf(currentVerboseFile, MAX_NAME_LENGTH, "%s.%03zu", verboseFile, seq++);
-			pugi::xml_parse_result result = verboseDoc.load_file(currentVerboseFile);
+			pugi::xml_parse_result result = loadVerboseLog(verboseDoc, currentVerboseFile);
 			if (pugi::status_file_not_found == result.status) {
 				break;
 			}
@@ -906,6 +940,39 @@ done:
 	return rt;
 }
 
+pugi::xml_parse_result
+GCConfigTest::loadVerboseLog(pugi::xml_document &verboseDoc, const char *fileName)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = (MM_GCExtensionsBase *)exampleVM->_omrVM->_gcOmrVMExtensions;
+	if (!extensions->binaryLogging) {
+		return verboseDoc.load_file(fileName);
+	}
+
+	/* binary logs are checked through the XML verbosegcdecoder produces for them */
+	pugi::xml_parse_result result;
+	result.status = pugi::status_file_not_found;
+	if (0 <= omrfile_lastmod(fileName)) {
+		char decodedFile[MAX_NAME_LENGTH];
+		omrstr_printf(decodedFile, MAX_NAME_LENGTH, "%s.decoded.xml", fileName);
+		VerboseGCDecoder decoder;
+		if (RC_OK == decoder.decodeFile(fileName, decodedFile)) {
+			result = verboseDoc.load_file(decodedFile);
+			if (!result) {
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Decoded verbose log %s is not valid XML: %s.\n", __FILE__, __LINE__, decodedFile, result.description());
+			}
+		} else {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to decode binary verbose log %s.\n", __FILE__, __LINE__, fileName);
+			result.status = pugi::status_io_error;
+		}
+		decoder.tearDown();
+		if (false == gcTestEnv->keepLog) {
+			omrfile_unlink(decodedFile);
+		}
+	}
+	return result;
+}
+
 int32_t
 GCConfigTest::parseGarbagePolicy(pugi::xml_node node)
 {
@@ -953,6 +1020,65 @@ done:
 	return rt;
 }
 
+int32_t
+GCConfigTest::measureAllocationLatency(pugi::xml_node node)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	int32_t rt = 0;
+	AttributeElem *sizeElem = NULL;
+	uint64_t *latencies = NULL;
+	uintptr_t allocated = 0;
+
+	uintptr_t count = (uintptr_t)atoi(node.attribute("count").value());
+	const char *sizeStr = node.attribute("size").value();
+	if ((0 == count) || (0 == strcmp(sizeStr, ""))) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: allocationLatency requires \"size\" and \"count\" attributes.\n", __FILE__, __LINE__);
+		goto done;
+	}
+	rt = parseAttribute(&sizeElem, sizeStr);
+	OMRGCTEST_CHECK_RT(rt);
+
+	latencies = (uint64_t *)omrmem_allocate_memory(count * sizeof(uint64_t), OMRMEM_CATEGORY_MM);
+	if (NULL == latencies) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to allocate native memory.\n", __FILE__, __LINE__);
+		goto done;
+	}
+
+	/* Time each allocate without allowing a GC, the allocated objects are garbage */
+	for (; allocated < count; allocated++) {
+		uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+		MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
+				MM_ObjectAllocationModel(env, (uintptr_t)sizeElem->value, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+		uint64_t startTime = omrtime_hires_clock();
+		omrobjectptr_t objPtr = OMR_GC_AllocateObject(exampleVM->_omrVMThread, noGc);
+		uint64_t endTime = omrtime_hires_clock();
+		if (NULL == objPtr) {
+			break;
+		}
+		latencies[allocated] = omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+		sizeElem = sizeElem->linkNext;
+	}
+
+	if (0 == allocated) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d No free memory to measure allocation latency.\n", __FILE__, __LINE__);
+		goto done;
+	}
+
+	qsort(latencies, allocated, sizeof(uint64_t), compareLatency);
+	gcTestEnv->log("Allocation latency (ns) of %zu allocations of size %s: p50 %llu, p90 %llu, p99 %llu, max %llu\n",
+			allocated, sizeStr, latencies[allocated / 2], latencies[(allocated * 90) / 100], latencies[(allocated * 99) / 100], latencies[allocated - 1]);
+
+done:
+	if (NULL != latencies) {
+		omrmem_free_memory(latencies);
+	}
+	freeAttributeList(sizeElem);
+	return rt;
+}
+
 int32_t
 GCConfigTest::triggerOperation(pugi::xml_node node)
 {
@@ -973,6 +1099,9 @@ GCConfigTest::triggerOperation(pugi::xml_node node)
 			}
 			OMRGCTEST_CHECK_RT(rt);
 			verboseManager->getWriterChain()->endOfCycle(env);
+		} else if (0 == strcmp(node.name(), "allocationLatency")) {
+			rt = measureAllocationLatency(node);
+			OMRGCTEST_CHECK_RT(rt);
 		}
 	}
 done:
@@ -1044,6 +1173,10 @@ TEST_P(GCConfigTest, test)
 			/* select verboseGC nodes with right spec info */
 			omrstr_printf(verboseNodeSet, MAX_NAME_LENGTH, "verboseGC[not(@spec) or @spec = '%s']", STRINGFY(SPEC));
 			pugi::xpath_node_set verboseGCs = configChild.select_nodes(verboseNodeSet);
+			if (((MM_GCExtensionsBase *)exampleVM->_omrVM->_gcOmrVMExtensions)->binaryLogging) {
+				/* binary records reach the file from a background thread; close the log so it is complete */
+				verboseManager->closeStreams(env);
+			}
 			rt = verifyVerboseGC(verboseGCs);
 			ASSERT_EQ(0, rt) << "Failed in verbose GC verification.";
 			gcTestEnv->log("[ Verification Successful ]\n\n");
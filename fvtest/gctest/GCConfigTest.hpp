@@ -108,8 +108,10 @@ protected:
 	void printFile(const char *name);
 #endif
 	int32_t verifyVerboseGC(pugi::xpath_node_set verboseGCs);
+	pugi::xml_parse_result loadVerboseLog(pugi::xml_document &verboseDoc, const char *fileName);
 	int32_t parseGarbagePolicy(pugi::xml_node node);
 	int32_t triggerOperation(pugi::xml_node node);
+	int32_t measureAllocationLatency(pugi::xml_node node);
 	int32_t iniXMLStr(const char *configStyle);
 
 	/* This implementation assumes that existing entries hashed into the rootTable and objectTable can
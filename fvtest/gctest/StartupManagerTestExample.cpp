@@ -37,7 +37,7 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 		/* parse options */
 		pugi::xpath_node option = doc.select_node("/gc-config/option");
 
-		int32_t unitSize = 1;
+		uintptr_t unitSize = 1;
 		const char *unit = option.node().attribute("sizeUnit").value();
 		if (0 != strcmp(unit, "")) {
 			if (0 == j9_cmdla_stricmp(unit, "B")) {
@@ -83,7 +83,8 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountForced = true;
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -91,8 +92,12 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=gencon ignored, requires OMR_GC_MODRON_SCAVENGER (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "segregated")) {
+						_useSegregatedGC = true;
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 					} else  if (0 != j9_cmdla_stricmp(attr.value(), "optavgpause")) {
-						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon or optavgpause): %s\n", attr.value());
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon, optavgpause or segregated): %s\n", attr.value());
 						result = false;
 					}
 				} else if (0 == strcmp(attr.name(), "concurrentMark")) {
@@ -101,12 +106,77 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+				} else if (0 == strcmp(attr.name(), "dirtyCardSummary")) {
+					extensions->dirtyCardSummary = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "concurrentSlack")) {
+					extensions->concurrentSlack = atoi(attr.value()) * unitSize;
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+				} else if (0 == strcmp(attr.name(), "freeListSizeClassIndex")) {
+					extensions->freeListSizeClassIndex = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "workStealingMarking")) {
+					extensions->workStealingMarking = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scanPrefetchDistance")) {
+					int prefetchDistance = atoi(attr.value());
+					if ((0 > prefetchDistance) || (MM_SCAN_PREFETCH_DISTANCE_MAX < prefetchDistance)) {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: scanPrefetchDistance must be between 0 and %d: %s\n", MM_SCAN_PREFETCH_DISTANCE_MAX, attr.value());
+						result = false;
+					} else {
+						extensions->scanPrefetchDistance = (uintptr_t)prefetchDistance;
+					}
+				} else if (0 == strcmp(attr.name(), "binaryLogging")) {
+					extensions->binaryLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "heapSizingCostModel")) {
+					extensions->heapSizingCostModel = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "heapSizingPauseTarget")) {
+					extensions->heapSizingPauseTarget = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "mixedPageSizeHeap")) {
+					extensions->mixedPageSizeHeap = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "backgroundDecommit")) {
+					extensions->backgroundDecommit = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "backgroundDecommitCPUPercent")) {
+					int cpuPercent = atoi(attr.value());
+					if ((1 > cpuPercent) || (100 < cpuPercent)) {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: backgroundDecommitCPUPercent must be between 1 and 100: %s\n", attr.value());
+						result = false;
+					} else {
+						extensions->backgroundDecommitCPUPercent = (uintptr_t)cpuPercent;
+					}
+#if defined(OMR_GC_SEGREGATED_HEAP)
+				} else if (0 == strcmp(attr.name(), "lazySweepSegregated")) {
+					extensions->lazySweepSegregated = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+				} else if (0 == strcmp(attr.name(), "allocationSampling")) {
+					extensions->allocationSampling = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "allocationSamplingInterval")) {
+					extensions->allocationSamplingInterval = atoi(attr.value());
+#if defined(OMR_GC_MODRON_COMPACTION)
+				} else if (0 == strcmp(attr.name(), "compactOnGlobalGC")) {
+					if (0 == j9_cmdla_stricmp(attr.value(), "true")) {
+						extensions->compactOnGlobalGC = 1;
+						extensions->noCompactOnGlobalGC = 0;
+					}
+				} else if (0 == strcmp(attr.name(), "incrementalCompactBudget")) {
+					extensions->incrementalCompactBudget = atoi(attr.value()) * unitSize;
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerNumaAffinity")) {
+					extensions->scavengerNumaAffinity = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scvTenureStrategyPredictive")) {
+					extensions->scvTenureStrategyPredictive = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+				} else if (0 == strcmp(attr.name(), "tlhAdaptiveSizing")) {
+					extensions->tlhAdaptiveSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhWasteTarget")) {
+					extensions->tlhAdaptiveWasteTarget = atoi(attr.value());
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+				} else if (0 == strcmp(attr.name(), "simulatedNumaNodeCount")) {
+					extensions->_numaManager.setSimulatedNodeCountForFVTest(atoi(attr.value()));
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
 					gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized option: %s\n", attr.name());
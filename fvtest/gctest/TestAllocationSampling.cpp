@@ -0,0 +1,181 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Overhead of -Xgc:allocationSampling at its default interval.  Small garbage objects are allocated
+ * through OMR_GC_AllocateObject (see perftest/gctest/configuration/allocation_sampling.xml), in passes
+ * alternating between the sampler attached and detached, and the fastest pass of each is reported along
+ * with the share of the sampled passes the sampler accounts for itself, which must stay under 1%.
+ * The samples must then be written out by OMR_GC_DumpAllocationSamples.
+ *
+ * Run with --gtest_filter=AllocationSamplingTest.* -logLevel=info (not part of the functional test run).
+ */
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_STANDARD) && defined(OMR_GC_THREAD_LOCAL_HEAP)
+
+#include "omrgc.h"
+#include "omrhashtable.h"
+
+#include "AllocationSampler.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "StartupManagerTestExample.hpp"
+#include "gcTestHelpers.hpp"
+
+#define ALLOCATION_SAMPLING_OBJECT_SIZE 64
+#define ALLOCATION_SAMPLING_PASS_BYTES ((uintptr_t)512 * 1024 * 1024)
+#define ALLOCATION_SAMPLING_PASSES 5
+#define ALLOCATION_SAMPLING_REPORT "allocation_samples.txt"
+
+class AllocationSamplingTest : public ::testing::Test
+{
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	MM_AllocationSampler *sampler;
+
+	virtual void
+	SetUp()
+	{
+		exampleVM = &(gcTestEnv->exampleVM);
+
+		MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, "perftest/gctest/configuration/allocation_sampling.xml");
+		omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_IntializeHeapAndCollector failed, rc=" << rc;
+		rc = OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread");
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_Thread_Init failed, rc=" << rc;
+		rc = OMR_GC_InitializeDispatcherThreads(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_InitializeDispatcherThreads failed, rc=" << rc;
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+
+		/* no roots, every collection frees the whole heap */
+		exampleVM->rootTable = hashTableNew(
+				exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(RootEntry), 0, 0, OMRMEM_CATEGORY_MM,
+				rootTableHashFn, rootTableHashEqualFn, NULL, NULL);
+		exampleVM->objectTable = hashTableNew(
+				exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(ObjectEntry), 0, 0, OMRMEM_CATEGORY_MM,
+				objectTableHashFn, objectTableHashEqualFn, NULL, NULL);
+		ASSERT_TRUE((NULL != exampleVM->rootTable) && (NULL != exampleVM->objectTable));
+
+		sampler = env->getExtensions()->allocationSampler;
+		ASSERT_TRUE(NULL != sampler) << "the configuration must enable allocationSampling";
+	}
+
+	virtual void
+	TearDown()
+	{
+		env->getExtensions()->allocationSampler = sampler;
+		if (NULL != exampleVM->rootTable) {
+			hashTableFree(exampleVM->rootTable);
+			exampleVM->rootTable = NULL;
+		}
+		if (NULL != exampleVM->objectTable) {
+			hashTableFree(exampleVM->objectTable);
+			exampleVM->objectTable = NULL;
+		}
+		omr_error_t rc = OMR_GC_ShutdownDispatcherThreads(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_GC_ShutdownDispatcherThreads failed, rc=" << rc;
+		rc = OMR_Thread_Free(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_Thread_Free failed, rc=" << rc;
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM));
+		exampleVM->_omrVMThread = NULL;
+	}
+
+	/**
+	 * Allocate ALLOCATION_SAMPLING_PASS_BYTES of garbage.
+	 * @param passSampler sampler to attach for the pass, NULL for none
+	 * @return the time taken, in microseconds
+	 */
+	uint64_t
+	allocationPass(MM_AllocationSampler *passSampler)
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+		env->getExtensions()->allocationSampler = passSampler;
+
+		uint64_t start = omrtime_hires_clock();
+		for (uintptr_t allocated = 0; allocated < ALLOCATION_SAMPLING_PASS_BYTES; allocated += ALLOCATION_SAMPLING_OBJECT_SIZE) {
+			MM_ObjectAllocationModel allocator(env, ALLOCATION_SAMPLING_OBJECT_SIZE);
+			if (NULL == OMR_GC_AllocateObject(exampleVM->_omrVMThread, &allocator)) {
+				ADD_FAILURE() << "allocation failed after " << allocated << " bytes";
+				break;
+			}
+		}
+		uint64_t end = omrtime_hires_clock();
+
+		return omrtime_hires_delta(start, end, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	}
+};
+
+TEST_F(AllocationSamplingTest, overhead)
+{
+	uint64_t unsampledTime = UINT64_MAX;
+	uint64_t sampledTime = UINT64_MAX;
+	uint64_t sampledPassesTime = 0;
+	uintptr_t samplesBefore = 0;
+	uintptr_t samplesAfter = 0;
+	uintptr_t stackCount = 0;
+	uintptr_t droppedCount = 0;
+	uint64_t samplingBefore = 0;
+	uint64_t samplingAfter = 0;
+
+	allocationPass(sampler);
+	sampler->getStats(&samplesBefore, &stackCount, &droppedCount, &samplingBefore);
+	for (uintptr_t pass = 0; pass < ALLOCATION_SAMPLING_PASSES; pass++) {
+		unsampledTime = OMR_MIN(unsampledTime, allocationPass(NULL));
+		uint64_t time = allocationPass(sampler);
+		sampledTime = OMR_MIN(sampledTime, time);
+		sampledPassesTime += time;
+	}
+	sampler->getStats(&samplesAfter, &stackCount, &droppedCount, &samplingAfter);
+
+	/* passes vary by more than sampling costs, the time the sampler accounts for itself gives the overhead */
+	int64_t measured = (((int64_t)sampledTime - (int64_t)unsampledTime) * 10000) / (int64_t)unsampledTime;
+	uint64_t accounted = ((samplingAfter - samplingBefore) * 10000) / sampledPassesTime;
+	uintptr_t sampleCount = (samplesAfter - samplesBefore) / ALLOCATION_SAMPLING_PASSES;
+	uint64_t sampleTime = (0 == sampleCount) ? 0 : ((samplingAfter - samplingBefore) / (samplesAfter - samplesBefore));
+	gcTestEnv->log("allocation of %zu MB in %d byte objects: unsampled %8llu us  sampled %8llu us (%lld.%02lld%%)  %zu samples per pass, %llu us per sample, sampling overhead %llu.%02llu%%\n",
+			ALLOCATION_SAMPLING_PASS_BYTES >> 20, ALLOCATION_SAMPLING_OBJECT_SIZE, unsampledTime, sampledTime,
+			measured / 100, (measured < 0 ? -measured : measured) % 100, sampleCount,
+			sampleTime, accounted / 100, accounted % 100);
+
+	/* one sample per interval on average, so well over half of the expected number */
+	EXPECT_LT((ALLOCATION_SAMPLING_PASS_BYTES / env->getExtensions()->allocationSamplingInterval) / 2, sampleCount);
+	EXPECT_EQ(0u, droppedCount);
+	EXPECT_GT(100u, accounted);
+}
+
+TEST_F(AllocationSamplingTest, dump)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+
+	allocationPass(sampler);
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_DumpAllocationSamples(exampleVM->_omrVMThread, ALLOCATION_SAMPLING_REPORT));
+
+	int64_t reportSize = omrfile_length(ALLOCATION_SAMPLING_REPORT);
+	omrfile_unlink(ALLOCATION_SAMPLING_REPORT);
+	EXPECT_LT(0, reportSize);
+}
+
+#endif /* defined(OMR_GC_MODRON_STANDARD) && defined(OMR_GC_THREAD_LOCAL_HEAP) */
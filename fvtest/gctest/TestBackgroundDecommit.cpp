@@ -0,0 +1,175 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Benchmark of the time contraction spends decommitting heap memory inside the pause
+ * (-Xgc:backgroundDecommit).  A touched range at the top of the reserved heap is decommitted once
+ * synchronously, as contraction does by default, and once by handing it to MM_MemoryMaintenanceThread;
+ * the time the caller is held up and the time the thread spent are reported.  A range committed again
+ * before the thread gets to it must keep its contents.
+ *
+ * Run with --gtest_filter=BackgroundDecommitTest.* -logLevel=info (not part of the functional test run).
+ */
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_STANDARD)
+
+#include <string.h>
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "Math.hpp"
+#include "MemoryMaintenanceThread.hpp"
+#include "omrExampleVM.hpp"
+#include "omrgc.h"
+#include "StartupManagerTestExample.hpp"
+#include "gcTestHelpers.hpp"
+
+#define BACKGROUND_DECOMMIT_TEST_RANGE_SIZE ((uintptr_t)16 * 1024 * 1024)
+#define BACKGROUND_DECOMMIT_TEST_PASSES 8
+
+class BackgroundDecommitTest : public ::testing::Test
+{
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	MM_Heap *heap;
+	MM_MemoryMaintenanceThread *maintenanceThread;
+	uint8_t *rangeBase;
+
+	virtual void
+	SetUp()
+	{
+		exampleVM = &(gcTestEnv->exampleVM);
+
+		/* the heap starts small, so the top of its reservation is free for the test */
+		MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, "fvtest/gctest/configuration/background_decommit_GC_config.xml");
+		omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_IntializeHeapAndCollector failed, rc=" << rc;
+		rc = OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread");
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_Thread_Init failed, rc=" << rc;
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+
+		heap = env->getExtensions()->heap;
+		maintenanceThread = env->getExtensions()->memoryMaintenanceThread;
+		ASSERT_TRUE(NULL != maintenanceThread) << "the configuration must enable backgroundDecommit";
+		uintptr_t rangeTop = MM_Math::roundToFloor(heap->getPageSize(), (uintptr_t)heap->getHeapTop());
+		rangeBase = (uint8_t *)(rangeTop - BACKGROUND_DECOMMIT_TEST_RANGE_SIZE);
+		ASSERT_TRUE(((uintptr_t)heap->getHeapBase() + heap->getActiveMemorySize()) <= (uintptr_t)rangeBase);
+	}
+
+	virtual void
+	TearDown()
+	{
+		omr_error_t rc = OMR_Thread_Free(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_Thread_Free failed, rc=" << rc;
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM));
+		exampleVM->_omrVMThread = NULL;
+	}
+
+	void
+	commitRange(uint8_t value)
+	{
+		ASSERT_TRUE(heap->commitMemory(rangeBase, BACKGROUND_DECOMMIT_TEST_RANGE_SIZE));
+		memset(rangeBase, value, BACKGROUND_DECOMMIT_TEST_RANGE_SIZE);
+	}
+
+	/**
+	 * Wait for the thread to finish everything handed to it.
+	 * @return the thread's total background time, in microseconds
+	 */
+	uint64_t
+	waitForThread()
+	{
+		uint64_t deferredBytes = 0;
+		uint64_t releasedBytes = 0;
+		uint64_t reclaimedBytes = 0;
+		uint64_t pendingBytes = 0;
+		uint64_t backgroundTime = 0;
+		for (;;) {
+			maintenanceThread->getStats(&deferredBytes, &releasedBytes, &reclaimedBytes, &pendingBytes, &backgroundTime);
+			if (0 == pendingBytes) {
+				break;
+			}
+			omrthread_sleep(1);
+		}
+		EXPECT_EQ(deferredBytes, releasedBytes + reclaimedBytes);
+		return backgroundTime;
+	}
+};
+
+TEST_F(BackgroundDecommitTest, contractionPause)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	void *rangeTop = rangeBase + BACKGROUND_DECOMMIT_TEST_RANGE_SIZE;
+	uint64_t synchronousTime = 0;
+	uint64_t deferredTime = 0;
+	uint64_t backgroundStart = waitForThread();
+
+	for (uintptr_t pass = 0; pass < BACKGROUND_DECOMMIT_TEST_PASSES; pass++) {
+		commitRange(0x5a);
+		uint64_t start = omrtime_hires_clock();
+		ASSERT_TRUE(heap->decommitMemory(rangeBase, BACKGROUND_DECOMMIT_TEST_RANGE_SIZE, NULL, rangeTop));
+		uint64_t end = omrtime_hires_clock();
+		synchronousTime += end - start;
+
+		commitRange(0x5a);
+		start = omrtime_hires_clock();
+		ASSERT_TRUE(maintenanceThread->deferDecommit(env, heap, rangeBase, BACKGROUND_DECOMMIT_TEST_RANGE_SIZE, NULL, rangeTop));
+		end = omrtime_hires_clock();
+		deferredTime += end - start;
+		waitForThread();
+	}
+	uint64_t backgroundTime = waitForThread() - backgroundStart;
+
+	gcTestEnv->log("decommit of %zu MB, caller held up for: synchronous %8llu us  deferred %8llu us  (background thread %8llu us)\n",
+			BACKGROUND_DECOMMIT_TEST_RANGE_SIZE >> 20,
+			omrtime_hires_delta(0, synchronousTime / BACKGROUND_DECOMMIT_TEST_PASSES, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+			omrtime_hires_delta(0, deferredTime / BACKGROUND_DECOMMIT_TEST_PASSES, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+			backgroundTime / BACKGROUND_DECOMMIT_TEST_PASSES);
+}
+
+TEST_F(BackgroundDecommitTest, recommitBeforeRelease)
+{
+	void *rangeTop = rangeBase + BACKGROUND_DECOMMIT_TEST_RANGE_SIZE;
+
+	for (uintptr_t pass = 0; pass < BACKGROUND_DECOMMIT_TEST_PASSES; pass++) {
+		commitRange(0x5a);
+		ASSERT_TRUE(maintenanceThread->deferDecommit(env, heap, rangeBase, BACKGROUND_DECOMMIT_TEST_RANGE_SIZE, NULL, rangeTop));
+
+		/* take back the middle of the range, the thread may be anywhere in it */
+		uint8_t *middleBase = rangeBase + (BACKGROUND_DECOMMIT_TEST_RANGE_SIZE / 4);
+		uintptr_t middleSize = BACKGROUND_DECOMMIT_TEST_RANGE_SIZE / 2;
+		ASSERT_TRUE(heap->commitMemory(middleBase, middleSize));
+		memset(middleBase, 0xa5, middleSize);
+		waitForThread();
+
+		for (uintptr_t i = 0; i < middleSize; i += heap->getPageSize()) {
+			ASSERT_EQ(0xa5, middleBase[i]) << "committed memory was decommitted at offset " << i;
+		}
+		ASSERT_TRUE(heap->decommitMemory(middleBase, middleSize, NULL, middleBase + middleSize));
+	}
+}
+
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
@@ -0,0 +1,190 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Benchmark of the scan done by final card cleaning (-Xgc:dirtyCardSummary).  A card table for a
+ * 16GB heap is dirtied sparsely and scanned once a slot at a time, as getNextDirtyCard does without
+ * the summary, and once stepping over the granules MM_DirtyCardSummary proves clean.  Both scans
+ * must find the same dirty cards; the time of each is reported.
+ *
+ * Runs in CI as part of gcunittest; run with --gtest_filter=DirtyCardSummaryTest.* -logLevel=info to see the times.
+ */
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+
+#include <string.h>
+
+#include "DirtyCardSummary.hpp"
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "HeapMapScanner.hpp"
+#include "Math.hpp"
+#include "omrExampleVM.hpp"
+#include "omrgc.h"
+#include "omrmodroncore.h"
+#include "StartupManagerTestExample.hpp"
+#include "gcTestHelpers.hpp"
+
+#define DIRTY_CARD_SUMMARY_TEST_CARDS ((uintptr_t)32 * 1024 * 1024)
+#define DIRTY_CARD_SUMMARY_TEST_PASSES 4
+
+class DirtyCardSummaryTest : public ::testing::Test
+{
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	Card *cards;
+	MM_DirtyCardSummary *summary;
+
+	virtual void
+	SetUp()
+	{
+		exampleVM = &(gcTestEnv->exampleVM);
+		cards = NULL;
+		summary = NULL;
+
+		/* any heap configuration will do, the startup only selects the heap map scan kernel */
+		MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, "fvtest/gctest/configuration/sample_GC_config.xml");
+		omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_IntializeHeapAndCollector failed, rc=" << rc;
+		rc = OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread");
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_Thread_Init failed, rc=" << rc;
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+
+		cards = (Card *)env->getForge()->allocate(DIRTY_CARD_SUMMARY_TEST_CARDS, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		ASSERT_TRUE(NULL != cards);
+		summary = MM_DirtyCardSummary::newInstance(env, DIRTY_CARD_SUMMARY_TEST_CARDS);
+		ASSERT_TRUE(NULL != summary);
+	}
+
+	virtual void
+	TearDown()
+	{
+		if (NULL != summary) {
+			summary->kill(env);
+			summary = NULL;
+		}
+		if (NULL != cards) {
+			env->getForge()->free(cards);
+			cards = NULL;
+		}
+		omr_error_t rc = OMR_Thread_Free(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_Thread_Free failed, rc=" << rc;
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM));
+		exampleVM->_omrVMThread = NULL;
+	}
+
+	/**
+	 * Clean the whole table then dirty every stride'th card, starting from an odd offset so
+	 * dirty cards fall anywhere within a slot.
+	 */
+	void
+	dirtyCards(uintptr_t stride)
+	{
+		memset(cards, CARD_CLEAN, DIRTY_CARD_SUMMARY_TEST_CARDS);
+		summary->clear();
+		for (uintptr_t i = 7; i < DIRTY_CARD_SUMMARY_TEST_CARDS; i += stride) {
+			cards[i] = CARD_DIRTY;
+			summary->markCard(i);
+		}
+	}
+
+	/**
+	 * Count the dirty cards in the slot range, one slot at a time.
+	 */
+	uintptr_t
+	countDirtyCards(uintptr_t *slot, uintptr_t *slotTop)
+	{
+		uintptr_t count = 0;
+		for (; slot < slotTop; slot++) {
+			if (0 != *slot) {
+				Card *card = (Card *)slot;
+				for (uintptr_t i = 0; i < sizeof(uintptr_t); i++) {
+					if (CARD_DIRTY == card[i]) {
+						count += 1;
+					}
+				}
+			}
+		}
+		return count;
+	}
+
+	/**
+	 * Count the dirty cards in the slot range, only looking at the granules the summary has marked.
+	 */
+	uintptr_t
+	countDirtyCardsUsingSummary(uintptr_t *slot, uintptr_t *slotTop)
+	{
+		uintptr_t count = 0;
+		uintptr_t topIndex = (uintptr_t)((Card *)slotTop - cards);
+		uintptr_t cardIndex = (uintptr_t)((Card *)slot - cards);
+		while (cardIndex < topIndex) {
+			cardIndex = summary->findPossiblyDirtyCard(cardIndex, topIndex);
+			uintptr_t granuleTop = OMR_MIN(MM_Math::roundToFloor((uintptr_t)1 << DIRTY_CARD_SUMMARY_GRANULE_SHIFT, cardIndex) + ((uintptr_t)1 << DIRTY_CARD_SUMMARY_GRANULE_SHIFT), topIndex);
+			uintptr_t *granuleSlotTop = (uintptr_t *)(cards + granuleTop);
+			uintptr_t *next = MM_HeapMapScanner::findNonEmptySlot((uintptr_t *)(cards + cardIndex), granuleSlotTop);
+			while (next < granuleSlotTop) {
+				count += countDirtyCards(next, next + 1);
+				next = MM_HeapMapScanner::findNonEmptySlot(next + 1, granuleSlotTop);
+			}
+			cardIndex = granuleTop;
+		}
+		return count;
+	}
+};
+
+TEST_F(DirtyCardSummaryTest, finalCleaningScan)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	uintptr_t *slotBase = (uintptr_t *)cards;
+	uintptr_t *slotTop = (uintptr_t *)(cards + DIRTY_CARD_SUMMARY_TEST_CARDS);
+
+	/* from one dirty card in every 64 down to one in every 4M */
+	for (uintptr_t stride = 64; stride <= DIRTY_CARD_SUMMARY_TEST_CARDS / 8; stride *= 16) {
+		dirtyCards(stride);
+		uintptr_t expected = countDirtyCards(slotBase, slotTop);
+
+		uint64_t linearTime = 0;
+		uint64_t summaryTime = 0;
+		for (uintptr_t pass = 0; pass < DIRTY_CARD_SUMMARY_TEST_PASSES; pass++) {
+			uint64_t start = omrtime_hires_clock();
+			uintptr_t linearCount = countDirtyCards(slotBase, slotTop);
+			uint64_t middle = omrtime_hires_clock();
+			uintptr_t summaryCount = countDirtyCardsUsingSummary(slotBase, slotTop);
+			uint64_t end = omrtime_hires_clock();
+			ASSERT_EQ(expected, linearCount);
+			ASSERT_EQ(expected, summaryCount) << "the summary lost a dirty card, stride " << stride;
+			linearTime += middle - start;
+			summaryTime += end - middle;
+		}
+
+		gcTestEnv->log("dirty cards: %8zu (1 in %8zu)  linear scan: %8llu us  summary scan (%s): %8llu us\n",
+				expected, stride,
+				omrtime_hires_delta(0, linearTime / DIRTY_CARD_SUMMARY_TEST_PASSES, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+				MM_HeapMapScanner::getKernelName(),
+				omrtime_hires_delta(0, summaryTime / DIRTY_CARD_SUMMARY_TEST_PASSES, OMRPORT_TIME_DELTA_IN_MICROSECONDS));
+	}
+}
+
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
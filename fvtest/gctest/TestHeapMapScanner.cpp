@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Compares the heap map scan kernel selected for this processor with the scalar one for every range
+ * length up to a few vector steps, with the non-empty slot at each position and at each alignment, so
+ * the partial step at the end of a range is covered.  The slots just past the range are left empty, so
+ * a kernel which steps over the end of the range returns a slot beyond it.
+ */
+
+#include <string.h>
+
+#include "omrcfg.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "HeapMapScanner.hpp"
+#include "omrExampleVM.hpp"
+#include "omrgc.h"
+#include "StartupManagerTestExample.hpp"
+#include "gcTestHelpers.hpp"
+
+/* longer than three steps of the widest kernel (2 * 256 bits) */
+#define HEAP_MAP_SCANNER_TEST_MAX_SLOTS ((3 * 64 / sizeof(uintptr_t)) + 2)
+#define HEAP_MAP_SCANNER_TEST_ALIGNMENTS 4
+/* empty slots after the range, one step of the widest kernel */
+#define HEAP_MAP_SCANNER_TEST_PADDING (64 / sizeof(uintptr_t))
+
+class HeapMapScannerTest : public ::testing::Test
+{
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+
+	virtual void
+	SetUp()
+	{
+		exampleVM = &(gcTestEnv->exampleVM);
+
+		MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, "fvtest/gctest/configuration/sample_GC_config.xml");
+		omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_IntializeHeapAndCollector failed, rc=" << rc;
+		rc = OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread");
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_Thread_Init failed, rc=" << rc;
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+	}
+
+	virtual void
+	TearDown()
+	{
+		omr_error_t rc = OMR_Thread_Free(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_Thread_Free failed, rc=" << rc;
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM));
+		exampleVM->_omrVMThread = NULL;
+	}
+
+	/**
+	 * Find the non-empty slot of every range with the kernel chosen for the given setting of
+	 * vectorHeapMapScan.  results[alignment][length][position] is the index of the slot found.
+	 */
+	void
+	scanRanges(bool vectorHeapMapScan, uintptr_t results[HEAP_MAP_SCANNER_TEST_ALIGNMENTS][HEAP_MAP_SCANNER_TEST_MAX_SLOTS + 1][HEAP_MAP_SCANNER_TEST_MAX_SLOTS + 1])
+	{
+		uintptr_t slots[HEAP_MAP_SCANNER_TEST_ALIGNMENTS + HEAP_MAP_SCANNER_TEST_MAX_SLOTS + HEAP_MAP_SCANNER_TEST_PADDING];
+
+		env->getExtensions()->vectorHeapMapScan = vectorHeapMapScan;
+		MM_HeapMapScanner::selectKernel(env);
+		for (uintptr_t alignment = 0; alignment < HEAP_MAP_SCANNER_TEST_ALIGNMENTS; alignment++) {
+			for (uintptr_t length = 0; length <= HEAP_MAP_SCANNER_TEST_MAX_SLOTS; length++) {
+				/* position == length leaves the whole range empty */
+				for (uintptr_t position = 0; position <= length; position++) {
+					uintptr_t *slot = slots + alignment;
+					for (uintptr_t i = 0; i < (length + HEAP_MAP_SCANNER_TEST_PADDING); i++) {
+						slot[i] = 0;
+					}
+					if (position < length) {
+						slot[position] = (uintptr_t)1 << (position % (sizeof(uintptr_t) * 8));
+					}
+					results[alignment][length][position] = (uintptr_t)(MM_HeapMapScanner::findNonEmptySlot(slot, slot + length) - slot);
+				}
+			}
+		}
+	}
+};
+
+TEST_F(HeapMapScannerTest, matchesScalarAtEdgeLengths)
+{
+	static uintptr_t vectorResults[HEAP_MAP_SCANNER_TEST_ALIGNMENTS][HEAP_MAP_SCANNER_TEST_MAX_SLOTS + 1][HEAP_MAP_SCANNER_TEST_MAX_SLOTS + 1];
+	static uintptr_t scalarResults[HEAP_MAP_SCANNER_TEST_ALIGNMENTS][HEAP_MAP_SCANNER_TEST_MAX_SLOTS + 1][HEAP_MAP_SCANNER_TEST_MAX_SLOTS + 1];
+	bool vectorHeapMapScan = env->getExtensions()->vectorHeapMapScan;
+
+	scanRanges(true, vectorResults);
+	const char *kernelName = MM_HeapMapScanner::getKernelName();
+	scanRanges(false, scalarResults);
+	env->getExtensions()->vectorHeapMapScan = vectorHeapMapScan;
+	MM_HeapMapScanner::selectKernel(env);
+
+	if (0 == strcmp(kernelName, "scalar")) {
+		gcTestEnv->log(LEVEL_ERROR, "no vector heap map scan kernel on this processor, only the scalar kernel is checked\n");
+	} else {
+		gcTestEnv->log("checking the %s heap map scan kernel\n", kernelName);
+	}
+	for (uintptr_t alignment = 0; alignment < HEAP_MAP_SCANNER_TEST_ALIGNMENTS; alignment++) {
+		for (uintptr_t length = 0; length <= HEAP_MAP_SCANNER_TEST_MAX_SLOTS; length++) {
+			for (uintptr_t position = 0; position <= length; position++) {
+				ASSERT_EQ(position, scalarResults[alignment][length][position]) << "scalar, length " << length << " alignment " << alignment;
+				ASSERT_EQ(scalarResults[alignment][length][position], vectorResults[alignment][length][position]) << kernelName << ", length " << length << " alignment " << alignment;
+			}
+		}
+	}
+}
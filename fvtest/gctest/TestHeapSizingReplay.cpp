@@ -0,0 +1,263 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Offline tests of MM_HeapSizingCostModel (-Xgc:heapSizingCostModel).  The synthetic tests run a
+ * workload with a known allocation rate and pause cost through the model, applying each target, and
+ * check where the size settles.  replayVerboseLog feeds the <heap-sizing> decisions of a text
+ * verbose log back into a fresh model: with the recorded targets every decision must be reproduced,
+ * and with -heapSizingGCTimeTarget / -heapSizingPauseTarget it shows what the sizes would have been.
+ *
+ * The synthetic tests run in CI as part of gcunittest.  To replay a log, run with
+ * --gtest_filter=HeapSizingReplayTest.* -logLevel=info -heapSizingReplay=<verbose log>
+ * [-heapSizingGCTimeTarget=<percent>] [-heapSizingPauseTarget=<ms>].
+ */
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_STANDARD)
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "HeapSizingCostModel.hpp"
+#include "gcTestHelpers.hpp"
+#include "pugixml.hpp"
+
+#define HEAP_SIZING_TEST_MB ((uintptr_t)1024 * 1024)
+#define HEAP_SIZING_TEST_GRANULE ((uintptr_t)64 * 1024)
+#define HEAP_SIZING_TEST_COLLECTIONS 32
+
+/**
+ * An application with a constant amount of live data and allocation rate, collected by a
+ * collector whose pause is exactly markMicrosPerMB * live + sweepMicrosPerMB * size.
+ */
+struct SyntheticWorkload {
+	uintptr_t liveBytes;
+	double allocationRate; /**< bytes per microsecond */
+	double markMicrosPerMB;
+	double sweepMicrosPerMB;
+};
+
+static uint64_t
+pauseMicros(const SyntheticWorkload *workload, uintptr_t size)
+{
+	return (uint64_t)(((workload->markMicrosPerMB * workload->liveBytes) + (workload->sweepMicrosPerMB * size)) / HEAP_SIZING_TEST_MB);
+}
+
+static double
+gcTimePercent(const SyntheticWorkload *workload, uintptr_t size)
+{
+	double pause = (double)pauseMicros(workload, size);
+	double interval = (double)(size - workload->liveBytes) / workload->allocationRate;
+	return (pause * 100.0) / (pause + interval);
+}
+
+/**
+ * Run collections of the workload, resizing to each target, and answer the last decision.
+ * @param[in] recentTargets filled with the targets of the last 4 collections
+ */
+static void
+runWorkload(MM_HeapSizingCostModel *model, const SyntheticWorkload *workload, uintptr_t initialSize, uintptr_t containerBudget, MM_HeapSizingStats *decision, uintptr_t *recentTargets)
+{
+	uintptr_t size = initialSize;
+	for (uintptr_t i = 0; i < HEAP_SIZING_TEST_COLLECTIONS; i++) {
+		MM_HeapSizingSample sample;
+		memset(&sample, 0, sizeof(sample));
+		sample.allocatedBytes = size - workload->liveBytes;
+		sample.intervalMicros = (uint64_t)((double)sample.allocatedBytes / workload->allocationRate);
+		sample.pauseMicros = pauseMicros(workload, size);
+		sample.liveBytes = workload->liveBytes;
+		sample.currentSize = size;
+		sample.minimumSize = 4 * HEAP_SIZING_TEST_MB;
+		sample.maximumSize = 1024 * HEAP_SIZING_TEST_MB;
+		sample.containerBudget = containerBudget;
+		ASSERT_TRUE(model->decide(&sample, decision));
+		size = decision->_targetSize;
+		recentTargets[i % 4] = size;
+	}
+}
+
+static bool
+isStable(const uintptr_t *recentTargets)
+{
+	uintptr_t smallest = recentTargets[0];
+	uintptr_t largest = recentTargets[0];
+	for (uintptr_t i = 1; i < 4; i++) {
+		smallest = OMR_MIN(smallest, recentTargets[i]);
+		largest = OMR_MAX(largest, recentTargets[i]);
+	}
+	return (largest - smallest) <= HEAP_SIZING_TEST_GRANULE;
+}
+
+class HeapSizingReplayTest : public ::testing::Test
+{
+protected:
+	MM_HeapSizingCostModel model;
+	MM_HeapSizingStats decision;
+	uintptr_t recentTargets[4];
+	SyntheticWorkload workload;
+
+	virtual void
+	SetUp()
+	{
+		memset(&decision, 0, sizeof(decision));
+		memset(recentTargets, 0, sizeof(recentTargets));
+		workload.liveBytes = 64 * HEAP_SIZING_TEST_MB;
+		workload.allocationRate = 200.0;
+		workload.markMicrosPerMB = 1000.0;
+		workload.sweepMicrosPerMB = 50.0;
+		model.setTargets(5, 0, HEAP_SIZING_TEST_GRANULE);
+	}
+};
+
+TEST_F(HeapSizingReplayTest, settlesAtGCTimeTarget)
+{
+	ASSERT_NO_FATAL_FAILURE(runWorkload(&model, &workload, 128 * HEAP_SIZING_TEST_MB, 0, &decision, recentTargets));
+	double gcTime = gcTimePercent(&workload, decision._targetSize);
+	gcTestEnv->log("size: %zuMB  gc time: %.2f%%  predicted pause: %llums\n",
+			decision._targetSize / HEAP_SIZING_TEST_MB, gcTime, decision._predictedPauseMicros / 1000);
+
+	EXPECT_EQ(HEAP_SIZING_LIMIT_COST, decision._limit);
+	EXPECT_TRUE(isStable(recentTargets));
+	EXPECT_NEAR(5.0, gcTime, 0.25);
+}
+
+TEST_F(HeapSizingReplayTest, cappedByPauseTarget)
+{
+	/* 75ms allows 220MB, less than the 5% GC time target needs */
+	model.setTargets(5, 75 * 1000, HEAP_SIZING_TEST_GRANULE);
+	ASSERT_NO_FATAL_FAILURE(runWorkload(&model, &workload, 128 * HEAP_SIZING_TEST_MB, 0, &decision, recentTargets));
+
+	EXPECT_EQ(HEAP_SIZING_LIMIT_PAUSE, decision._limit);
+	EXPECT_TRUE(isStable(recentTargets));
+	EXPECT_GE((uint64_t)75 * 1000, pauseMicros(&workload, decision._targetSize));
+	EXPECT_LT(gcTimePercent(&workload, decision._targetSize), 10.0);
+}
+
+TEST_F(HeapSizingReplayTest, cappedByContainerBudget)
+{
+	ASSERT_NO_FATAL_FAILURE(runWorkload(&model, &workload, 128 * HEAP_SIZING_TEST_MB, 256 * HEAP_SIZING_TEST_MB, &decision, recentTargets));
+	EXPECT_EQ(HEAP_SIZING_LIMIT_CONTAINER, decision._limit);
+	EXPECT_EQ(256 * HEAP_SIZING_TEST_MB, decision._targetSize);
+
+	/* the container shrinks: the space follows, but keeps its headroom above the live data */
+	ASSERT_NO_FATAL_FAILURE(runWorkload(&model, &workload, decision._targetSize, 128 * HEAP_SIZING_TEST_MB, &decision, recentTargets));
+	EXPECT_EQ(HEAP_SIZING_LIMIT_CONTAINER, decision._limit);
+	EXPECT_EQ(128 * HEAP_SIZING_TEST_MB, decision._targetSize);
+
+	ASSERT_NO_FATAL_FAILURE(runWorkload(&model, &workload, decision._targetSize, 32 * HEAP_SIZING_TEST_MB, &decision, recentTargets));
+	EXPECT_EQ(32 * HEAP_SIZING_TEST_MB, decision._targetSize);
+}
+
+TEST_F(HeapSizingReplayTest, keepsMinimumHeadroom)
+{
+	/* almost no allocation: collections are rare at any size, so only the headroom is kept */
+	workload.allocationRate = 0.01;
+	ASSERT_NO_FATAL_FAILURE(runWorkload(&model, &workload, 512 * HEAP_SIZING_TEST_MB, 0, &decision, recentTargets));
+
+	EXPECT_EQ(HEAP_SIZING_LIMIT_MINIMUM, decision._limit);
+	EXPECT_TRUE(isStable(recentTargets));
+	EXPECT_GE(decision._targetSize, workload.liveBytes + ((workload.liveBytes * HEAP_SIZING_MINIMUM_HEADROOM_PERCENT) / 100));
+	EXPECT_LT(decision._targetSize, workload.liveBytes + ((workload.liveBytes * HEAP_SIZING_MINIMUM_HEADROOM_PERCENT) / 100) + HEAP_SIZING_TEST_GRANULE);
+}
+
+/**
+ * Answer a verbose GC time in milliseconds with 3 decimals (e.g. timems="12.345") in microseconds.
+ */
+static uint64_t
+parseMicros(const char *value)
+{
+	char *fraction = NULL;
+	uint64_t micros = strtoull(value, &fraction, 10) * 1000;
+	if ('.' == *fraction) {
+		micros += strtoull(fraction + 1, NULL, 10);
+	}
+	return micros;
+}
+
+static uintptr_t
+parseSize(pugi::xml_node node, const char *name)
+{
+	return (uintptr_t)strtoull(node.attribute(name).value(), NULL, 10);
+}
+
+TEST_F(HeapSizingReplayTest, replayVerboseLog)
+{
+	if (NULL == gcTestEnv->heapSizingReplay) {
+		gcTestEnv->log("no verbose log to replay, specify -heapSizingReplay=<file>\n");
+		return;
+	}
+
+	pugi::xml_document verboseDoc;
+	pugi::xml_parse_result result = verboseDoc.load_file(gcTestEnv->heapSizingReplay);
+	ASSERT_TRUE(result) << "Failed to parse " << gcTestEnv->heapSizingReplay << ": " << result.description();
+
+	bool whatIf = (0 <= gcTestEnv->heapSizingGCTimeTarget) || (0 <= gcTestEnv->heapSizingPauseTarget);
+	pugi::xpath_node_set decisions = verboseDoc.select_nodes("//heap-sizing");
+	ASSERT_FALSE(decisions.empty()) << "No <heap-sizing> decisions in " << gcTestEnv->heapSizingReplay << ", was it written with -Xgc:heapSizingCostModel?";
+
+	model.reset();
+	uintptr_t index = 0;
+	for (pugi::xpath_node_set::const_iterator it = decisions.begin(); it != decisions.end(); ++it) {
+		pugi::xml_node recorded = it->node();
+		pugi::xml_node sampleNode = recorded.child("heap-sizing-sample");
+		pugi::xml_node targetsNode = recorded.child("heap-sizing-targets");
+
+		MM_HeapSizingSample sample;
+		sample.intervalMicros = parseMicros(sampleNode.attribute("intervalms").value());
+		sample.pauseMicros = parseMicros(sampleNode.attribute("pausems").value());
+		sample.allocatedBytes = parseSize(sampleNode, "allocated");
+		sample.liveBytes = parseSize(sampleNode, "live");
+		sample.currentSize = parseSize(sampleNode, "current");
+		sample.minimumSize = parseSize(sampleNode, "minimum");
+		sample.maximumSize = parseSize(sampleNode, "maximum");
+		sample.containerBudget = parseSize(sampleNode, "containerbudget");
+		sample.bytesRequired = parseSize(sampleNode, "required");
+
+		uintptr_t gcTimeTarget = parseSize(targetsNode, "gctimetarget");
+		uintptr_t pauseTargetMillis = parseSize(targetsNode, "pausetargetms");
+		if (0 <= gcTestEnv->heapSizingGCTimeTarget) {
+			gcTimeTarget = (uintptr_t)gcTestEnv->heapSizingGCTimeTarget;
+		}
+		if (0 <= gcTestEnv->heapSizingPauseTarget) {
+			pauseTargetMillis = (uintptr_t)gcTestEnv->heapSizingPauseTarget;
+		}
+		model.setTargets(gcTimeTarget, (uint64_t)pauseTargetMillis * 1000, parseSize(targetsNode, "granule"));
+
+		/* a what-if replay sees the recorded sizes, not the sizes its own targets would have led to */
+		ASSERT_TRUE(model.decide(&sample, &decision)) << "decision " << index << " was not reproduced";
+		const char *limit = MM_HeapSizingCostModel::getLimitAsString(decision._limit);
+		uintptr_t recordedTarget = parseSize(recorded, "target");
+		gcTestEnv->log("%4zu: live %6zuKB  size %7zuKB  recorded %7zuKB %-9s  replayed %7zuKB %-9s  pause %llums\n",
+				index, sample.liveBytes >> 10, sample.currentSize >> 10,
+				recordedTarget >> 10, recorded.attribute("limit").value(),
+				decision._targetSize >> 10, limit, decision._predictedPauseMicros / 1000);
+		if (!whatIf) {
+			EXPECT_EQ(recordedTarget, decision._targetSize) << "decision " << index;
+			EXPECT_STREQ(recorded.attribute("limit").value(), limit) << "decision " << index;
+		}
+		index += 1;
+	}
+}
+
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
@@ -0,0 +1,337 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Benchmark for OMR_GC_ParallelHeapWalk.  The heap (10GB by default, see
+ * perftest/gctest/configuration/parallel_heap_walk.xml) is filled with chains of live objects of
+ * mixed sizes, then walked with a size histogram kept in per-thread contexts and merged at the end.
+ * Every walk must see exactly the objects that were allocated; the walk time is reported for a
+ * growing number of threads and for a few partition sizes, and for objects handed to the callback
+ * one at a time or in spans.
+ *
+ * Run with --gtest_filter=ParallelHeapWalkTest.* -logLevel=info [-heapWalkConfig=<file>]
+ * (not part of the functional test run).
+ */
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_STANDARD)
+
+#include "omrgc.h"
+#include "omrhashtable.h"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "ObjectModel.hpp"
+#include "ParallelDispatcher.hpp"
+#include "StandardWriteBarrier.hpp"
+#include "StartupManagerTestExample.hpp"
+#include "gcTestHelpers.hpp"
+
+#define HEAP_WALK_CHAIN_LENGTH 4096
+#define HEAP_WALK_MAX_SLOTS 128
+#define HEAP_WALK_PREFETCH_DISTANCE 8
+#define HEAP_WALK_ROOT_NAME_LENGTH 32
+#define HEAP_WALK_SIZE_CLASSES 32
+
+struct HeapWalkHistogram {
+	uintptr_t objects;
+	uintptr_t bytes;
+	uintptr_t sizeClassCounts[HEAP_WALK_SIZE_CLASSES];
+};
+
+struct HeapWalkData {
+	HeapWalkHistogram total;
+	uintptr_t threadCount;
+	volatile uint64_t walkStart; /**< when the first thread started walking, once the heap has been marked */
+	uint64_t walkTime; /**< time, in microseconds, from walkStart to the end of the walk */
+};
+
+static void
+clearHistogram(HeapWalkHistogram *histogram)
+{
+	memset(histogram, 0, sizeof(HeapWalkHistogram));
+}
+
+static void
+addToHistogram(HeapWalkHistogram *histogram, uintptr_t size)
+{
+	histogram->objects += 1;
+	histogram->bytes += size;
+	histogram->sizeClassCounts[MM_Math::floorLog2(size) % HEAP_WALK_SIZE_CLASSES] += 1;
+}
+
+static void *
+heapWalkStartThread(OMR_VMThread *omrVMThread, void *userData)
+{
+	OMRPORT_ACCESS_FROM_OMRVMTHREAD(omrVMThread);
+	HeapWalkData *data = (HeapWalkData *)userData;
+	MM_AtomicOperations::lockCompareExchangeU64(&data->walkStart, 0, omrtime_hires_clock());
+	HeapWalkHistogram *histogram = (HeapWalkHistogram *)MM_EnvironmentBase::getEnvironment(omrVMThread)->getForge()->allocate(sizeof(HeapWalkHistogram), OMR::GC::AllocationCategory::OTHER, OMR_GET_CALLSITE());
+	if (NULL != histogram) {
+		clearHistogram(histogram);
+	}
+	return histogram;
+}
+
+static void
+heapWalkObjectDo(OMR_VMThread *omrVMThread, omrobjectptr_t object, void *threadContext)
+{
+	HeapWalkHistogram *histogram = (HeapWalkHistogram *)threadContext;
+	addToHistogram(histogram, MM_GCExtensionsBase::getExtensions(omrVMThread->_vm)->objectModel.getConsumedSizeInBytesWithHeader(object));
+}
+
+static void
+heapWalkObjectsDo(OMR_VMThread *omrVMThread, omrobjectptr_t *objects, uintptr_t count, void *threadContext)
+{
+	HeapWalkHistogram *histogram = (HeapWalkHistogram *)threadContext;
+	GC_ObjectModel *objectModel = &MM_GCExtensionsBase::getExtensions(omrVMThread->_vm)->objectModel;
+	/* the whole span is known up front, so the headers can be fetched ahead of the histogram */
+	for (uintptr_t i = 0; i < OMR_MIN(count, HEAP_WALK_PREFETCH_DISTANCE); i++) {
+		MM_PREFETCH_FOR_READ(objects[i]);
+	}
+	for (uintptr_t i = 0; i < count; i++) {
+		if ((i + HEAP_WALK_PREFETCH_DISTANCE) < count) {
+			MM_PREFETCH_FOR_READ(objects[i + HEAP_WALK_PREFETCH_DISTANCE]);
+		}
+		addToHistogram(histogram, objectModel->getConsumedSizeInBytesWithHeader(objects[i]));
+	}
+}
+
+static void
+heapWalkMergeThread(OMR_VMThread *omrVMThread, void *threadContext, void *userData)
+{
+	HeapWalkData *data = (HeapWalkData *)userData;
+	HeapWalkHistogram *histogram = (HeapWalkHistogram *)threadContext;
+	data->total.objects += histogram->objects;
+	data->total.bytes += histogram->bytes;
+	for (uintptr_t i = 0; i < HEAP_WALK_SIZE_CLASSES; i++) {
+		data->total.sizeClassCounts[i] += histogram->sizeClassCounts[i];
+	}
+	data->threadCount += 1;
+	MM_EnvironmentBase::getEnvironment(omrVMThread)->getForge()->free(histogram);
+}
+
+static uintptr_t
+freeRootName(void *entry, void *userData)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT((OMRPortLibrary *)userData);
+	omrmem_free_memory((void *)((RootEntry *)entry)->name);
+	return FALSE;
+}
+
+class ParallelHeapWalkTest : public ::testing::Test
+{
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	HeapWalkHistogram allocated;
+
+	virtual void
+	SetUp()
+	{
+		exampleVM = &(gcTestEnv->exampleVM);
+		MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, gcTestEnv->heapWalkConfig);
+		omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_IntializeHeapAndCollector failed, rc=" << rc;
+		rc = OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread");
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_Thread_Init failed, rc=" << rc;
+		rc = OMR_GC_InitializeDispatcherThreads(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_InitializeDispatcherThreads failed, rc=" << rc;
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+
+		exampleVM->rootTable = hashTableNew(
+				exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(RootEntry), 0, 0, OMRMEM_CATEGORY_MM,
+				rootTableHashFn, rootTableHashEqualFn, NULL, NULL);
+		exampleVM->objectTable = hashTableNew(
+				exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(ObjectEntry), 0, 0, OMRMEM_CATEGORY_MM,
+				objectTableHashFn, objectTableHashEqualFn, NULL, NULL);
+		ASSERT_TRUE((NULL != exampleVM->rootTable) && (NULL != exampleVM->objectTable));
+	}
+
+	virtual void
+	TearDown()
+	{
+		if (NULL != exampleVM->rootTable) {
+			hashTableForEachDo(exampleVM->rootTable, freeRootName, exampleVM->_omrVM->_runtime->_portLibrary);
+			hashTableFree(exampleVM->rootTable);
+			exampleVM->rootTable = NULL;
+		}
+		if (NULL != exampleVM->objectTable) {
+			hashTableFree(exampleVM->objectTable);
+			exampleVM->objectTable = NULL;
+		}
+		omr_error_t rc = OMR_GC_ShutdownDispatcherThreads(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_GC_ShutdownDispatcherThreads failed, rc=" << rc;
+		rc = OMR_Thread_Free(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_Thread_Free failed, rc=" << rc;
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM));
+		exampleVM->_omrVMThread = NULL;
+	}
+
+	omrobjectptr_t
+	allocateObject(uintptr_t size)
+	{
+		uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+		MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
+				MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+		return OMR_GC_AllocateObject(exampleVM->_omrVMThread, noGc);
+	}
+
+	/**
+	 * Fill the heap with chains of HEAP_WALK_CHAIN_LENGTH objects linked through their first slot,
+	 * the last object of each chain being a root. Stops at the first allocation that would need a GC,
+	 * so nothing is collected while a chain is still unrooted.
+	 */
+	void
+	fillHeap()
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		uint32_t seed = 1;
+		bool heapFull = false;
+		uintptr_t chainCount = 0;
+
+		clearHistogram(&allocated);
+		while (!heapFull) {
+			omrobjectptr_t previous = NULL;
+			for (uintptr_t i = 0; i < HEAP_WALK_CHAIN_LENGTH; i++) {
+				/* mostly small objects with an occasional large one, like a typical application heap */
+				seed = (seed * 1103515245) + 12345;
+				uintptr_t slotCount = 1 + ((seed >> 16) % (0 == (i % 64) ? (HEAP_WALK_MAX_SLOTS * 8) : HEAP_WALK_MAX_SLOTS));
+				uintptr_t size = sizeof(uintptr_t) + (slotCount * sizeof(fomrobject_t));
+				omrobjectptr_t object = allocateObject(size);
+				if (NULL == object) {
+					heapFull = true;
+					break;
+				}
+				if (NULL != previous) {
+					standardWriteBarrierStore(exampleVM->_omrVMThread, object, (fomrobject_t *)object + 1, previous);
+				}
+				addToHistogram(&allocated, extensions->objectModel.getConsumedSizeInBytesWithHeader(object));
+				previous = object;
+			}
+			if (NULL != previous) {
+				RootEntry rootEntry;
+				char *name = (char *)omrmem_allocate_memory(HEAP_WALK_ROOT_NAME_LENGTH, OMRMEM_CATEGORY_MM);
+				ASSERT_TRUE(NULL != name);
+				omrstr_printf(name, HEAP_WALK_ROOT_NAME_LENGTH, "chain%zu", chainCount);
+				rootEntry.name = name;
+				rootEntry.rootPtr = previous;
+				ASSERT_TRUE(NULL != hashTableAdd(exampleVM->rootTable, &rootEntry));
+				chainCount += 1;
+			}
+		}
+
+		gcTestEnv->log("heap: %zuMB  chains: %zu  objects: %zu  bytes: %zu\n",
+				extensions->heap->getMemorySize() >> 20, chainCount, allocated.objects, allocated.bytes);
+	}
+
+	/**
+	 * @return the time taken by the walk, in microseconds, including the mark which prepares the heap
+	 */
+	uint64_t
+	walk(uintptr_t partitionSize, uintptr_t threadCount, HeapWalkData *data, bool spans = false)
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+		OMR_GC_ParallelHeapWalkCallbacks callbacks;
+		callbacks.startThread = heapWalkStartThread;
+		callbacks.objectDo = spans ? NULL : heapWalkObjectDo;
+		callbacks.objectsDo = spans ? heapWalkObjectsDo : NULL;
+		callbacks.mergeThread = heapWalkMergeThread;
+		data->threadCount = 0;
+		data->walkStart = 0;
+		clearHistogram(&data->total);
+
+		uint64_t start = omrtime_hires_clock();
+		EXPECT_EQ(OMR_ERROR_NONE, OMR_GC_ParallelHeapWalk(exampleVM->_omrVMThread, &callbacks, data, partitionSize, threadCount));
+		uint64_t end = omrtime_hires_clock();
+		data->walkTime = omrtime_hires_delta(data->walkStart, end, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		return omrtime_hires_delta(start, end, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	}
+
+	void
+	verify(HeapWalkData *data)
+	{
+		EXPECT_EQ(allocated.objects, data->total.objects);
+		EXPECT_EQ(allocated.bytes, data->total.bytes);
+		for (uintptr_t i = 0; i < HEAP_WALK_SIZE_CLASSES; i++) {
+			EXPECT_EQ(allocated.sizeClassCounts[i], data->total.sizeClassCounts[i]) << "size class " << i;
+		}
+	}
+};
+
+TEST_F(ParallelHeapWalkTest, walkRate)
+{
+	ASSERT_NO_FATAL_FAILURE(fillHeap());
+	/* everything allocated is live, the collection only makes the free memory walkable */
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+
+	HeapWalkData data;
+	uint64_t serialTime = walk(0, 1, &data);
+	ASSERT_EQ((uintptr_t)1, data.threadCount);
+	verify(&data);
+	gcTestEnv->log("threads: %2zu  partition: %8s  walk: %8llums\n", (uintptr_t)1, "default", (unsigned long long)(serialTime / 1000));
+
+	uintptr_t const partitionSizes[] = {0, 64 * 1024 * 1024, 4 * 1024 * 1024};
+	uintptr_t threadCountMaximum = env->getExtensions()->dispatcher->threadCountMaximum();
+	for (uintptr_t threadCount = 2; threadCount < (threadCountMaximum * 2); threadCount *= 2) {
+		threadCount = OMR_MIN(threadCount, threadCountMaximum);
+		for (uintptr_t i = 0; i < (sizeof(partitionSizes) / sizeof(partitionSizes[0])); i++) {
+			uint64_t time = walk(partitionSizes[i], threadCount, &data);
+			verify(&data);
+			char partition[32];
+			if (0 == partitionSizes[i]) {
+				strcpy(partition, "default");
+			} else {
+				snprintf(partition, sizeof(partition), "%zuMB", partitionSizes[i] >> 20);
+			}
+			gcTestEnv->log("threads: %2zu  partition: %8s  walk: %8llums  speedup: %.2f\n",
+					threadCount, partition, (unsigned long long)(time / 1000), (double)serialTime / (double)OMR_MAX(time, 1));
+		}
+	}
+}
+
+TEST_F(ParallelHeapWalkTest, spanWalkRate)
+{
+	ASSERT_NO_FATAL_FAILURE(fillHeap());
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+
+	/* only the walk itself is compared, the mark which prepares the heap is the same either way */
+	HeapWalkData data;
+	uintptr_t threadCountMaximum = env->getExtensions()->dispatcher->threadCountMaximum();
+	uintptr_t const threadCounts[] = {1, threadCountMaximum};
+	for (uintptr_t i = 0; i < (sizeof(threadCounts) / sizeof(threadCounts[0])); i++) {
+		walk(0, threadCounts[i], &data, false);
+		verify(&data);
+		uint64_t objectTime = data.walkTime;
+		walk(0, threadCounts[i], &data, true);
+		verify(&data);
+		uint64_t spanTime = data.walkTime;
+		gcTestEnv->log("threads: %2zu  walk after mark: %6llums one object at a time  %6llums in spans  (%.0f objects/us)\n",
+				threadCounts[i], (unsigned long long)(objectTime / 1000), (unsigned long long)(spanTime / 1000), (double)allocated.objects / (double)OMR_MAX(spanTime, 1));
+	}
+}
+
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
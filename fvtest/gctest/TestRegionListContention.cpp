@@ -0,0 +1,215 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+/*
+ * Contention benchmark for the shared segregated region lists.  Every worker thread repeatedly
+ * takes a region from a free list and hands it to a full queue (a refill), then returns a region
+ * from the full queue to the free list.  The refill rate is reported for the locking lists and
+ * for the sharded lists (-Xgc:regionListShards=<n>) as the number of threads grows.
+ *
+ * Run with --gtest_filter=RegionListContentionTest.* -logLevel=info (not part of the functional test run).
+ */
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "LockingFreeHeapRegionList.hpp"
+#include "LockingHeapRegionQueue.hpp"
+#include "omrExampleVM.hpp"
+#include "omrgc.h"
+#include "ShardedFreeHeapRegionList.hpp"
+#include "ShardedHeapRegionQueue.hpp"
+#include "StartupManagerTestExample.hpp"
+#include "gcTestHelpers.hpp"
+
+#define REGION_LIST_CONTENTION_MAX_THREADS 8
+#define REGION_LIST_CONTENTION_REGIONS_PER_THREAD 16
+#define REGION_LIST_CONTENTION_ITERATIONS 200000
+
+struct RegionListContentionData {
+	MM_FreeHeapRegionList *freeList;
+	MM_HeapRegionQueue *fullQueue;
+	omrthread_monitor_t monitor;
+	uintptr_t startedCount;
+	uintptr_t finishedCount;
+	bool go;
+	uintptr_t refills;
+};
+
+static int J9THREAD_PROC
+regionListContentionWorker(void *arg)
+{
+	RegionListContentionData *data = (RegionListContentionData *)arg;
+
+	omrthread_monitor_enter(data->monitor);
+	data->startedCount += 1;
+	omrthread_monitor_notify_all(data->monitor);
+	while (!data->go) {
+		omrthread_monitor_wait(data->monitor);
+	}
+	omrthread_monitor_exit(data->monitor);
+
+	uintptr_t refills = 0;
+	for (uintptr_t i = 0; i < REGION_LIST_CONTENTION_ITERATIONS; i++) {
+		MM_HeapRegionDescriptorSegregated *region = data->freeList->pop();
+		if (NULL != region) {
+			data->fullQueue->enqueue(region);
+			refills += 1;
+		}
+		region = data->fullQueue->dequeue();
+		if (NULL != region) {
+			data->freeList->push(region);
+		}
+	}
+
+	omrthread_monitor_enter(data->monitor);
+	data->refills += refills;
+	data->finishedCount += 1;
+	omrthread_monitor_notify_all(data->monitor);
+	omrthread_monitor_exit(data->monitor);
+	return 0;
+}
+
+class RegionListContentionTest : public ::testing::Test
+{
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	MM_HeapRegionDescriptorSegregated *regions;
+	uintptr_t regionCount;
+
+	virtual void
+	SetUp()
+	{
+		exampleVM = &(gcTestEnv->exampleVM);
+		regions = NULL;
+		regionCount = REGION_LIST_CONTENTION_MAX_THREADS * REGION_LIST_CONTENTION_REGIONS_PER_THREAD;
+
+		/* the lists only need an environment, any heap configuration will do */
+		MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, "fvtest/gctest/configuration/sample_GC_config.xml");
+		omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_IntializeHeapAndCollector failed, rc=" << rc;
+		rc = OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread");
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_Thread_Init failed, rc=" << rc;
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+
+		/* detached descriptors, the lists only link them and read their range */
+		regions = (MM_HeapRegionDescriptorSegregated *)env->getForge()->allocate(sizeof(MM_HeapRegionDescriptorSegregated) * regionCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		ASSERT_TRUE(NULL != regions);
+		for (uintptr_t i = 0; i < regionCount; i++) {
+			new (&regions[i]) MM_HeapRegionDescriptorSegregated(env, NULL, NULL);
+			regions[i].setRangeCount(1);
+		}
+	}
+
+	virtual void
+	TearDown()
+	{
+		if (NULL != regions) {
+			env->getForge()->free(regions);
+			regions = NULL;
+		}
+		omr_error_t rc = OMR_Thread_Free(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_Thread_Free failed, rc=" << rc;
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM));
+		exampleVM->_omrVMThread = NULL;
+	}
+
+	/**
+	 * Run threadCount workers against the given lists.
+	 * @return refills per second
+	 */
+	uint64_t
+	runWorkers(MM_FreeHeapRegionList *freeList, MM_HeapRegionQueue *fullQueue, uintptr_t threadCount)
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+		RegionListContentionData data;
+		data.freeList = freeList;
+		data.fullQueue = fullQueue;
+		data.startedCount = 0;
+		data.finishedCount = 0;
+		data.go = false;
+		data.refills = 0;
+		EXPECT_EQ(0, omrthread_monitor_init_with_name(&data.monitor, 0, "RegionListContentionTest"));
+
+		/* seed the free list, the worker threads only ever move these regions around */
+		for (uintptr_t i = 0; i < (threadCount * REGION_LIST_CONTENTION_REGIONS_PER_THREAD); i++) {
+			freeList->push(&regions[i]);
+		}
+
+		omrthread_monitor_enter(data.monitor);
+		for (uintptr_t i = 0; i < threadCount; i++) {
+			omrthread_t thread = NULL;
+			EXPECT_EQ(0, omrthread_create(&thread, 256 * 1024, J9THREAD_PRIORITY_NORMAL, 0, regionListContentionWorker, &data));
+		}
+		while (data.startedCount < threadCount) {
+			omrthread_monitor_wait(data.monitor);
+		}
+		uint64_t start = omrtime_hires_clock();
+		data.go = true;
+		omrthread_monitor_notify_all(data.monitor);
+		while (data.finishedCount < threadCount) {
+			omrthread_monitor_wait(data.monitor);
+		}
+		uint64_t end = omrtime_hires_clock();
+		omrthread_monitor_exit(data.monitor);
+		omrthread_monitor_destroy(data.monitor);
+
+		/* no region may be lost or duplicated by the handoffs */
+		EXPECT_EQ(threadCount * REGION_LIST_CONTENTION_REGIONS_PER_THREAD, freeList->getTotalRegions() + fullQueue->getTotalRegions());
+		while (NULL != freeList->pop()) {}
+		while (NULL != fullQueue->dequeue()) {}
+
+		uint64_t elapsed = OMR_MAX(end - start, 1);
+		return (data.refills * omrtime_hires_frequency()) / elapsed;
+	}
+};
+
+TEST_F(RegionListContentionTest, refillRate)
+{
+	for (uintptr_t threadCount = 1; threadCount <= REGION_LIST_CONTENTION_MAX_THREADS; threadCount *= 2) {
+		MM_FreeHeapRegionList *lockingFree = MM_LockingFreeHeapRegionList::newInstance(env, MM_HeapRegionList::HRL_KIND_FREE, true);
+		MM_HeapRegionQueue *lockingFull = MM_LockingHeapRegionQueue::newInstance(env, MM_HeapRegionList::HRL_KIND_FULL, true, true, false);
+		ASSERT_TRUE((NULL != lockingFree) && (NULL != lockingFull));
+		uint64_t lockingRate = runWorkers(lockingFree, lockingFull, threadCount);
+		lockingFree->kill(env);
+		lockingFull->kill(env);
+
+		/* one shard per thread is the configuration the option is meant for */
+		uintptr_t shardCount = OMR_MAX(threadCount, 2);
+		MM_FreeHeapRegionList *shardedFree = MM_ShardedFreeHeapRegionList::newInstance(env, MM_HeapRegionList::HRL_KIND_FREE, true, shardCount);
+		MM_HeapRegionQueue *shardedFull = MM_ShardedHeapRegionQueue::newInstance(env, MM_HeapRegionList::HRL_KIND_FULL, true, false, shardCount);
+		ASSERT_TRUE((NULL != shardedFree) && (NULL != shardedFull));
+		uint64_t shardedRate = runWorkers(shardedFree, shardedFull, threadCount);
+		shardedFree->kill(env);
+		shardedFull->kill(env);
+
+		gcTestEnv->log("threads: %2zu  locking: %10llu refills/s  sharded (%zu shards): %10llu refills/s\n",
+				threadCount, lockingRate, shardCount, shardedRate);
+	}
+}
+
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
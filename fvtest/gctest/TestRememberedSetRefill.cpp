@@ -0,0 +1,209 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Write barrier stress benchmark for the remembered set.  Every worker thread remembers objects
+ * through its own fragment as fast as it can, the way the generational barrier slow path does, so
+ * the pool is refilled whenever a fragment fills.  The remembering rate is reported as the number
+ * of threads grows, with fixed size fragments and one puddle per refill, and with adaptive fragments
+ * and batched puddles (-Xgc:rememberedSetMaxFragmentSize=<bytes>, -Xgc:rememberedSetPuddleBatch=<n>).
+ * Every remembered entry must be found in the pool afterwards.
+ *
+ * Run with --gtest_filter=RememberedSetRefillTest.* -logLevel=info (not part of the functional test run).
+ */
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "EnvironmentBase.hpp"
+#include "omrExampleVM.hpp"
+#include "omrgc.h"
+#include "omrgcconsts.h"
+#include "StartupManagerTestExample.hpp"
+#include "SublistFragment.hpp"
+#include "SublistIterator.hpp"
+#include "SublistPool.hpp"
+#include "SublistPuddle.hpp"
+#include "SublistSlotIterator.hpp"
+#include "gcTestHelpers.hpp"
+
+#define REMEMBERED_SET_REFILL_MAX_THREADS 8
+#define REMEMBERED_SET_REFILL_ENTRIES_PER_THREAD 400000
+#define REMEMBERED_SET_REFILL_PUDDLE_BATCH 8
+#define REMEMBERED_SET_REFILL_MAX_FRAGMENT_SIZE 1024
+
+struct RememberedSetRefillData {
+	MM_EnvironmentBase *env; /**< only used for its forge, which any thread may use */
+	MM_SublistPool *pool;
+	omrthread_monitor_t monitor;
+	uintptr_t startedCount;
+	uintptr_t finishedCount;
+	bool go;
+	bool failed;
+};
+
+static int J9THREAD_PROC
+rememberedSetRefillWorker(void *arg)
+{
+	RememberedSetRefillData *data = (RememberedSetRefillData *)arg;
+	J9VMGC_SublistFragment fragmentPrimitive;
+	fragmentPrimitive.fragmentCurrent = NULL;
+	fragmentPrimitive.fragmentTop = NULL;
+	fragmentPrimitive.fragmentSize = (uintptr_t)OMR_SCV_REMSET_FRAGMENT_SIZE;
+	fragmentPrimitive.parentList = data->pool;
+	fragmentPrimitive.deferredFlushID = 0;
+	fragmentPrimitive.count = 0;
+	MM_SublistFragment fragment(&fragmentPrimitive);
+
+	omrthread_monitor_enter(data->monitor);
+	data->startedCount += 1;
+	omrthread_monitor_notify_all(data->monitor);
+	while (!data->go) {
+		omrthread_monitor_wait(data->monitor);
+	}
+	omrthread_monitor_exit(data->monitor);
+
+	bool failed = false;
+	for (uintptr_t i = 1; i <= REMEMBERED_SET_REFILL_ENTRIES_PER_THREAD; i++) {
+		if (!fragment.add(data->env, i)) {
+			failed = true;
+			break;
+		}
+	}
+	MM_SublistFragment::flush(&fragmentPrimitive);
+
+	omrthread_monitor_enter(data->monitor);
+	data->failed |= failed;
+	data->finishedCount += 1;
+	omrthread_monitor_notify_all(data->monitor);
+	omrthread_monitor_exit(data->monitor);
+	return 0;
+}
+
+class RememberedSetRefillTest : public ::testing::Test
+{
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+
+	virtual void
+	SetUp()
+	{
+		exampleVM = &(gcTestEnv->exampleVM);
+
+		/* the pool only needs an environment, any heap configuration will do */
+		MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, "fvtest/gctest/configuration/sample_GC_config.xml");
+		omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_IntializeHeapAndCollector failed, rc=" << rc;
+		rc = OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread");
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_Thread_Init failed, rc=" << rc;
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+	}
+
+	virtual void
+	TearDown()
+	{
+		omr_error_t rc = OMR_Thread_Free(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_Thread_Free failed, rc=" << rc;
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM));
+		exampleVM->_omrVMThread = NULL;
+	}
+
+	/**
+	 * Run threadCount workers against a fresh remembered set pool.
+	 * @return entries remembered per second
+	 */
+	uint64_t
+	runWorkers(uintptr_t threadCount, uintptr_t puddleBatchCount, uintptr_t maxFragmentSize)
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+		MM_SublistPool pool;
+		EXPECT_TRUE(pool.initialize(env, OMR::GC::AllocationCategory::REMEMBERED_SET));
+		pool.setGrowSize(OMR_SCV_REMSET_SIZE);
+		pool.setPuddleBatchCount(puddleBatchCount);
+		pool.setMaxFragmentSize(maxFragmentSize);
+
+		RememberedSetRefillData data;
+		data.env = env;
+		data.pool = &pool;
+		data.startedCount = 0;
+		data.finishedCount = 0;
+		data.go = false;
+		data.failed = false;
+		EXPECT_EQ(0, omrthread_monitor_init_with_name(&data.monitor, 0, "RememberedSetRefillTest"));
+
+		omrthread_monitor_enter(data.monitor);
+		for (uintptr_t i = 0; i < threadCount; i++) {
+			omrthread_t thread = NULL;
+			EXPECT_EQ(0, omrthread_create(&thread, 256 * 1024, J9THREAD_PRIORITY_NORMAL, 0, rememberedSetRefillWorker, &data));
+		}
+		while (data.startedCount < threadCount) {
+			omrthread_monitor_wait(data.monitor);
+		}
+		uint64_t start = omrtime_hires_clock();
+		data.go = true;
+		omrthread_monitor_notify_all(data.monitor);
+		while (data.finishedCount < threadCount) {
+			omrthread_monitor_wait(data.monitor);
+		}
+		uint64_t end = omrtime_hires_clock();
+		omrthread_monitor_exit(data.monitor);
+		omrthread_monitor_destroy(data.monitor);
+
+		/* no entry may be lost or stored twice by concurrent refills */
+		uintptr_t expected = threadCount * REMEMBERED_SET_REFILL_ENTRIES_PER_THREAD;
+		EXPECT_FALSE(data.failed);
+		EXPECT_EQ(expected, pool.countElements());
+		uintptr_t found = 0;
+		GC_SublistIterator puddleIterator(&pool);
+		MM_SublistPuddle *puddle = NULL;
+		while (NULL != (puddle = puddleIterator.nextList())) {
+			GC_SublistSlotIterator slotIterator(puddle);
+			uintptr_t *slot = NULL;
+			while (NULL != (slot = (uintptr_t *)slotIterator.nextSlot())) {
+				if (0 != *slot) {
+					found += 1;
+				}
+			}
+		}
+		EXPECT_EQ(expected, found);
+
+		pool.tearDown(env);
+
+		uint64_t elapsed = OMR_MAX(end - start, 1);
+		return (expected * omrtime_hires_frequency()) / elapsed;
+	}
+};
+
+TEST_F(RememberedSetRefillTest, barrierSlowPathRate)
+{
+	for (uintptr_t threadCount = 1; threadCount <= REMEMBERED_SET_REFILL_MAX_THREADS; threadCount *= 2) {
+		uint64_t fixedRate = runWorkers(threadCount, 1, 0);
+		uint64_t adaptiveRate = runWorkers(threadCount, REMEMBERED_SET_REFILL_PUDDLE_BATCH, REMEMBERED_SET_REFILL_MAX_FRAGMENT_SIZE);
+
+		gcTestEnv->log("threads: %2zu  fixed fragments: %10llu entries/s  adaptive fragments, batch of %d puddles: %10llu entries/s\n",
+				threadCount, fixedRate, REMEMBERED_SET_REFILL_PUDDLE_BATCH, adaptiveRate);
+	}
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
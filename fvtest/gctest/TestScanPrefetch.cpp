@@ -0,0 +1,240 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Mark rate benchmark for -Xgc:scanPrefetchDistance=.  A pointer chasing heap of small example
+ * objects is built (see perftest/gctest/configuration/scan_prefetch.xml): the objects are linked
+ * through their first slot in a random order, so that all of them are reachable from a single root,
+ * and their other slots point to random objects.  Consecutive objects popped by the marker are then
+ * never near each other in memory.  The heap is marked with increasing prefetch distances and the
+ * mark rate, in MB of live objects per second, is reported against the rate without prefetching.
+ * Every mark must find every object.
+ *
+ * Disabled by default: run with --gtest_also_run_disabled_tests --gtest_filter=ScanPrefetchTest.* -logLevel=info.
+ * The prefetching scan paths are exercised functionally by scan_prefetch_*_GC_config.xml.
+ */
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_STANDARD)
+
+#include "mmprivatehook.h"
+#include "omrgc.h"
+#include "omrhashtable.h"
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "ObjectModel.hpp"
+#include "StandardWriteBarrier.hpp"
+#include "StartupManagerTestExample.hpp"
+#include "gcTestHelpers.hpp"
+
+#define SCAN_PREFETCH_SLOTS 4
+#define SCAN_PREFETCH_LIVE_FRACTION 3 /* fill a third of the heap */
+#define SCAN_PREFETCH_PASSES 3
+
+struct ScanPrefetchMarkTime {
+	uint64_t start;
+	uint64_t end;
+};
+
+static void
+scanPrefetchMarkStart(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	((ScanPrefetchMarkTime *)userData)->start = ((MM_MarkStartEvent *)eventData)->timestamp;
+}
+
+static void
+scanPrefetchMarkEnd(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	((ScanPrefetchMarkTime *)userData)->end = ((MM_MarkEndEvent *)eventData)->timestamp;
+}
+
+class ScanPrefetchTest : public ::testing::Test
+{
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	omrobjectptr_t *objects;
+	uintptr_t objectCount;
+	uintptr_t liveBytes;
+
+	virtual void
+	SetUp()
+	{
+		exampleVM = &(gcTestEnv->exampleVM);
+		objects = NULL;
+		objectCount = 0;
+		liveBytes = 0;
+
+		MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, "perftest/gctest/configuration/scan_prefetch.xml");
+		omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_IntializeHeapAndCollector failed, rc=" << rc;
+		rc = OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread");
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_Thread_Init failed, rc=" << rc;
+		rc = OMR_GC_InitializeDispatcherThreads(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_InitializeDispatcherThreads failed, rc=" << rc;
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+
+		exampleVM->rootTable = hashTableNew(
+				exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(RootEntry), 0, 0, OMRMEM_CATEGORY_MM,
+				rootTableHashFn, rootTableHashEqualFn, NULL, NULL);
+		exampleVM->objectTable = hashTableNew(
+				exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(ObjectEntry), 0, 0, OMRMEM_CATEGORY_MM,
+				objectTableHashFn, objectTableHashEqualFn, NULL, NULL);
+		ASSERT_TRUE((NULL != exampleVM->rootTable) && (NULL != exampleVM->objectTable));
+	}
+
+	virtual void
+	TearDown()
+	{
+		if (NULL != objects) {
+			env->getForge()->free(objects);
+			objects = NULL;
+		}
+		if (NULL != exampleVM->rootTable) {
+			hashTableFree(exampleVM->rootTable);
+			exampleVM->rootTable = NULL;
+		}
+		if (NULL != exampleVM->objectTable) {
+			hashTableFree(exampleVM->objectTable);
+			exampleVM->objectTable = NULL;
+		}
+		env->getExtensions()->scanPrefetchDistance = 0;
+		omr_error_t rc = OMR_GC_ShutdownDispatcherThreads(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_GC_ShutdownDispatcherThreads failed, rc=" << rc;
+		rc = OMR_Thread_Free(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_Thread_Free failed, rc=" << rc;
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM));
+		exampleVM->_omrVMThread = NULL;
+	}
+
+	omrobjectptr_t
+	allocateObject(uintptr_t size)
+	{
+		uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+		MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
+				MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+		return OMR_GC_AllocateObject(exampleVM->_omrVMThread, noGc);
+	}
+
+	/**
+	 * Allocate the objects, then link them in a random order. Nothing is collected before the
+	 * single root is in place since every allocation fails rather than triggering a GC.
+	 */
+	void
+	buildHeap()
+	{
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		uintptr_t objectSize = sizeof(uintptr_t) + (SCAN_PREFETCH_SLOTS * sizeof(fomrobject_t));
+		uintptr_t maxObjects = extensions->heap->getMemorySize() / SCAN_PREFETCH_LIVE_FRACTION / objectSize;
+		objects = (omrobjectptr_t *)env->getForge()->allocate(maxObjects * sizeof(omrobjectptr_t), OMR::GC::AllocationCategory::OTHER, OMR_GET_CALLSITE());
+		ASSERT_TRUE(NULL != objects);
+
+		while (objectCount < maxObjects) {
+			omrobjectptr_t object = allocateObject(objectSize);
+			if (NULL == object) {
+				break;
+			}
+			objects[objectCount] = object;
+			objectCount += 1;
+			liveBytes += extensions->objectModel.getConsumedSizeInBytesWithHeader(object);
+		}
+		ASSERT_LT((uintptr_t)1, objectCount);
+
+		/* shuffle, so that following the first slots visits the objects in no particular address order */
+		uint32_t seed = 1;
+		for (uintptr_t i = objectCount - 1; i > 0; i--) {
+			seed = (seed * 1103515245) + 12345;
+			uintptr_t j = (((uintptr_t)seed << 15) ^ (seed >> 16)) % (i + 1);
+			omrobjectptr_t swap = objects[i];
+			objects[i] = objects[j];
+			objects[j] = swap;
+		}
+		for (uintptr_t i = 0; i < objectCount; i++) {
+			fomrobject_t *slot = (fomrobject_t *)((uintptr_t *)objects[i] + 1);
+			if ((i + 1) < objectCount) {
+				standardWriteBarrierStore(exampleVM->_omrVMThread, objects[i], slot, objects[i + 1]);
+			}
+			for (uintptr_t s = 1; s < SCAN_PREFETCH_SLOTS; s++) {
+				seed = (seed * 1103515245) + 12345;
+				uintptr_t target = (((uintptr_t)seed << 15) ^ (seed >> 16)) % objectCount;
+				standardWriteBarrierStore(exampleVM->_omrVMThread, objects[i], slot + s, objects[target]);
+			}
+		}
+
+		RootEntry rootEntry;
+		rootEntry.name = "scanPrefetchRoot";
+		rootEntry.rootPtr = objects[0];
+		ASSERT_TRUE(NULL != hashTableAdd(exampleVM->rootTable, &rootEntry));
+
+		gcTestEnv->log("heap: %zuMB  objects: %zu  live: %zuMB\n",
+				extensions->heap->getMemorySize() >> 20, objectCount, liveBytes >> 20);
+	}
+
+	/**
+	 * Collect SCAN_PREFETCH_PASSES times with the given prefetch distance.
+	 * @return the shortest mark phase, in microseconds
+	 */
+	uint64_t
+	mark(uintptr_t prefetchDistance)
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		J9HookInterface **privateHooks = J9_HOOK_INTERFACE(extensions->privateHookInterface);
+		ScanPrefetchMarkTime markTime;
+		(*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_MARK_START, scanPrefetchMarkStart, OMR_GET_CALLSITE(), &markTime);
+		(*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_MARK_END, scanPrefetchMarkEnd, OMR_GET_CALLSITE(), &markTime);
+
+		extensions->scanPrefetchDistance = prefetchDistance;
+		uint64_t bestTime = UINT64_MAX;
+		for (uintptr_t pass = 0; pass < SCAN_PREFETCH_PASSES; pass++) {
+			markTime.start = 0;
+			markTime.end = 0;
+			EXPECT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+			EXPECT_EQ(objectCount, extensions->globalGCStats.markStats._objectsMarked) << "prefetch distance " << prefetchDistance;
+			bestTime = OMR_MIN(bestTime, omrtime_hires_delta(markTime.start, markTime.end, OMRPORT_TIME_DELTA_IN_MICROSECONDS));
+		}
+
+		(*privateHooks)->J9HookUnregister(privateHooks, J9HOOK_MM_PRIVATE_MARK_START, scanPrefetchMarkStart, &markTime);
+		(*privateHooks)->J9HookUnregister(privateHooks, J9HOOK_MM_PRIVATE_MARK_END, scanPrefetchMarkEnd, &markTime);
+		return OMR_MAX(bestTime, 1);
+	}
+};
+
+TEST_F(ScanPrefetchTest, DISABLED_markRate)
+{
+	ASSERT_NO_FATAL_FAILURE(buildHeap());
+
+	uint64_t baseTime = mark(0);
+	gcTestEnv->log("prefetch distance: %2zu  mark: %8llums  rate: %8.1f MB/s\n",
+			(uintptr_t)0, baseTime / 1000, ((double)liveBytes / (1024 * 1024)) / ((double)baseTime / 1000000));
+	for (uintptr_t prefetchDistance = 2; prefetchDistance <= MM_SCAN_PREFETCH_DISTANCE_MAX; prefetchDistance *= 2) {
+		uint64_t time = mark(prefetchDistance);
+		gcTestEnv->log("prefetch distance: %2zu  mark: %8llums  rate: %8.1f MB/s  speedup: %.2f\n",
+				prefetchDistance, time / 1000, ((double)liveBytes / (1024 * 1024)) / ((double)time / 1000000), (double)baseTime / (double)time);
+	}
+}
+
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
@@ -34,6 +34,14 @@ GCTestEnvironment::initParams()
 	for (int i = 1; i < _argc; i++) {
 		if (0 == strcmp(_argv[i], "-keepVerboseLog")) {
 			keepLog = true;
+		} else if (0 == strncmp(_argv[i], "-heapWalkConfig=", strlen("-heapWalkConfig="))) {
+			heapWalkConfig = &_argv[i][strlen("-heapWalkConfig=")];
+		} else if (0 == strncmp(_argv[i], "-heapSizingReplay=", strlen("-heapSizingReplay="))) {
+			heapSizingReplay = &_argv[i][strlen("-heapSizingReplay=")];
+		} else if (0 == strncmp(_argv[i], "-heapSizingGCTimeTarget=", strlen("-heapSizingGCTimeTarget="))) {
+			heapSizingGCTimeTarget = atoi(&_argv[i][strlen("-heapSizingGCTimeTarget=")]);
+		} else if (0 == strncmp(_argv[i], "-heapSizingPauseTarget=", strlen("-heapSizingPauseTarget="))) {
+			heapSizingPauseTarget = atoi(&_argv[i][strlen("-heapSizingPauseTarget=")]);
 		}
 	}
 }
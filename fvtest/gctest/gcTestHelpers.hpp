@@ -43,6 +43,10 @@ public:
 	OMR_VM_Example exampleVM;
 	std::vector<const char *> params;
 	bool keepLog;
+	const char *heapWalkConfig; /**< Heap configuration of ParallelHeapWalkTest (-heapWalkConfig=<file>) */
+	const char *heapSizingReplay; /**< Verbose log replayed by HeapSizingReplayTest (-heapSizingReplay=<file>) */
+	intptr_t heapSizingGCTimeTarget; /**< GC time target replayed instead of the recorded one (-heapSizingGCTimeTarget=<percent>), -1 for none */
+	intptr_t heapSizingPauseTarget; /**< Pause target replayed instead of the recorded one (-heapSizingPauseTarget=<ms>), -1 for none */
 
 	/*
 	 * Function members
@@ -60,7 +64,8 @@ public:
 
 public:
 	GCTestEnvironment(int argc, char **argv)
-	: BaseEnvironment(argc, argv), keepLog(false)
+	: BaseEnvironment(argc, argv), keepLog(false), heapWalkConfig("perftest/gctest/configuration/parallel_heap_walk.xml")
+	, heapSizingReplay(NULL), heapSizingGCTimeTarget(-1), heapSizingPauseTarget(-1)
 	{
 	}
 };
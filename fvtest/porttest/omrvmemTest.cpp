@@ -4451,6 +4451,68 @@ exit:
 	EXPECT_EQ(0, result) << "Test Failed!";
 }
 
+/**
+ * Backs each large page sized chunk of a default page reservation with the largest pages available,
+ * then commits what is not explicitly backed and writes to every chunk.
+ *
+ * @ref omrvmem.c::omrvmem_back_with_large_pages
+ */
+TEST(PortVmemTest, vmem_testBackWithLargePages)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "vmem_testBackWithLargePages";
+	uintptr_t *pageSizes = omrvmem_supported_page_sizes();
+	uintptr_t largePageSize = (0 != pageSizes[1]) ? pageSizes[1] : (2 * 1024 * 1024);
+	uintptr_t chunkCount = 4;
+	uintptr_t byteAmount = (chunkCount + 1) * largePageSize;
+	uintptr_t backingCounts[3] = {0, 0, 0};
+	struct J9PortVmemIdentifier vmemID;
+	J9PortVmemParams params;
+	char *memPtr = NULL;
+	uintptr_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	omrvmem_vmem_params_init(&params);
+	params.byteAmount = byteAmount;
+	params.mode |= OMRPORT_VMEM_MEMORY_MODE_READ | OMRPORT_VMEM_MEMORY_MODE_WRITE;
+	params.pageSize = pageSizes[0];
+	params.category = OMRMEM_CATEGORY_PORT_LIBRARY;
+	memPtr = (char *)omrvmem_reserve_memory_ex(&vmemID, &params);
+	if (NULL == memPtr) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "unable to reserve 0x%zx bytes with page size 0x%zx\n", byteAmount, pageSizes[0]);
+		goto exit;
+	}
+
+	{
+		char *chunks = (char *)(((uintptr_t)memPtr + largePageSize - 1) & ~(largePageSize - 1));
+
+		/* a range which is not aligned to the large page size keeps its default pages */
+		EXPECT_EQ((uintptr_t)OMRPORT_VMEM_PAGE_BACKING_DEFAULT, omrvmem_back_with_large_pages(chunks + pageSizes[0], largePageSize, largePageSize, &vmemID));
+
+		for (i = 0; i < chunkCount; i++) {
+			char *chunk = chunks + (i * largePageSize);
+			uintptr_t backing = omrvmem_back_with_large_pages(chunk, largePageSize, largePageSize, &vmemID);
+			ASSERT_TRUE(backing <= OMRPORT_VMEM_PAGE_BACKING_EXPLICIT) << "unknown backing " << backing;
+			backingCounts[backing] += 1;
+			if (OMRPORT_VMEM_PAGE_BACKING_EXPLICIT != backing) {
+				ASSERT_TRUE(NULL != omrvmem_commit_memory(chunk, largePageSize, &vmemID)) << "unable to commit chunk " << i;
+			}
+			memset(chunk, 'c', largePageSize);
+			EXPECT_EQ('c', chunk[largePageSize - 1]);
+		}
+	}
+	portTestEnv->log("0x%zx byte chunks: %zu explicit, %zu transparent, %zu default\n", largePageSize,
+			backingCounts[OMRPORT_VMEM_PAGE_BACKING_EXPLICIT], backingCounts[OMRPORT_VMEM_PAGE_BACKING_TRANSPARENT], backingCounts[OMRPORT_VMEM_PAGE_BACKING_DEFAULT]);
+
+	if (0 != omrvmem_free_memory(memPtr, byteAmount, &vmemID)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "unable to free 0x%zx bytes at %p\n", byteAmount, memPtr);
+	}
+
+exit:
+	reportTestExit(OMRPORTLIB, testName);
+}
+
 /**
  * Queries process virtual, physical, and private memory sizes.
  *
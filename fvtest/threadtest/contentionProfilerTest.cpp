@@ -0,0 +1,154 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "omrport.h"
+#include "testHelper.hpp"
+#include "thread_api.h"
+
+#define CONTENTION_TEST_HOLD_MILLIS 100
+#define CONTENTION_TEST_MAX_SAMPLES 64
+
+#if defined(OMR_THR_THREE_TIER_LOCKING)
+typedef struct ContentionTestData {
+	omrthread_monitor_t monitor;
+	volatile uintptr_t started;
+	volatile uintptr_t finished;
+} ContentionTestData;
+
+static intptr_t J9THREAD_PROC
+blockedEnterThread(ContentionTestData *data)
+{
+	data->started = 1;
+	omrthread_monitor_enter(data->monitor);
+	omrthread_monitor_exit(data->monitor);
+	data->finished = 1;
+	return 0;
+}
+
+/**
+ * Hold the monitor while another thread tries to enter it, so that thread blocks for about CONTENTION_TEST_HOLD_MILLIS.
+ */
+static void
+blockOtherThread(ContentionTestData *data)
+{
+	omrthread_t thread = NULL;
+
+	data->started = 0;
+	data->finished = 0;
+	omrthread_monitor_enter(data->monitor);
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, (omrthread_entrypoint_t) blockedEnterThread, data));
+	while (0 == data->started) {
+		omrthread_sleep(1);
+	}
+	omrthread_sleep(CONTENTION_TEST_HOLD_MILLIS);
+	omrthread_monitor_exit(data->monitor);
+	while (0 == data->finished) {
+		omrthread_sleep(1);
+	}
+}
+
+/**
+ * @return the dumped sample for the monitor, or NULL if there is none
+ */
+static J9ThreadContentionSample *
+findSample(J9ThreadContentionSample *samples, uintptr_t sampleCount, omrthread_monitor_t monitor)
+{
+	for (uintptr_t i = 0; i < sampleCount; i++) {
+		if (monitor == samples[i].monitor) {
+			return &samples[i];
+		}
+	}
+	return NULL;
+}
+
+/**
+ * validates that a blocked enter is charged to its monitor and the stack it was called from, that nothing is
+ * sampled once the profiler is stopped, and that starting it again discards the samples
+ */
+TEST(ContentionProfilerTest, blockedEnterIsSampled)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	ContentionTestData data;
+	J9ThreadContentionSample samples[CONTENTION_TEST_MAX_SAMPLES];
+	uintptr_t contendedCount = 0;
+
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&data.monitor, 0, "contention profiler test monitor"));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_contention_profiler_start(OMRPORTLIB, 1));
+	blockOtherThread(&data);
+	omrthread_contention_profiler_stop();
+
+	uintptr_t sampleCount = omrthread_contention_profiler_dump(samples, CONTENTION_TEST_MAX_SAMPLES, &contendedCount);
+	J9ThreadContentionSample *sample = findSample(samples, sampleCount, data.monitor);
+	ASSERT_TRUE(NULL != sample);
+	ASSERT_LE((uintptr_t)1, contendedCount);
+	ASSERT_EQ((uintptr_t)1, sample->sampleCount);
+	ASSERT_STREQ("contention profiler test monitor", sample->monitorName);
+	ASSERT_LE((uint64_t)(CONTENTION_TEST_HOLD_MILLIS / 5) * 1000000, sample->blockedTime);
+	ASSERT_EQ(sample->blockedTime, sample->maxBlockedTime);
+#if defined(LINUX)
+	ASSERT_LT((uintptr_t)0, sample->frameCount);
+#endif /* defined(LINUX) */
+
+	/* stopped, the same contention adds nothing */
+	blockOtherThread(&data);
+	sampleCount = omrthread_contention_profiler_dump(samples, CONTENTION_TEST_MAX_SAMPLES, NULL);
+	sample = findSample(samples, sampleCount, data.monitor);
+	ASSERT_TRUE(NULL != sample);
+	ASSERT_EQ((uintptr_t)1, sample->sampleCount);
+
+	intptr_t fd = omrfile_open("contentionProfilerTest.txt", EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	ASSERT_NE(-1, fd);
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_contention_profiler_report(OMRPORTLIB, fd));
+	omrfile_close(fd);
+	ASSERT_LT(0, omrfile_length("contentionProfilerTest.txt"));
+	omrfile_unlink("contentionProfilerTest.txt");
+
+	/* a restart discards the samples of the earlier run */
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_contention_profiler_start(OMRPORTLIB, 1));
+	omrthread_contention_profiler_stop();
+	sampleCount = omrthread_contention_profiler_dump(samples, CONTENTION_TEST_MAX_SAMPLES, &contendedCount);
+	ASSERT_TRUE(NULL == findSample(samples, sampleCount, data.monitor));
+	ASSERT_EQ((uintptr_t)0, contendedCount);
+
+	omrthread_monitor_destroy(data.monitor);
+}
+
+#else /* defined(OMR_THR_THREE_TIER_LOCKING) */
+
+/**
+ * validates that the profiler refuses to start, and has nothing to dump or report, when blocked enters are not
+ * profiled because three-tier locking is not built
+ */
+TEST(ContentionProfilerTest, unsupportedWithoutThreeTierLocking)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	J9ThreadContentionSample samples[1];
+	uintptr_t contendedCount = 1;
+
+	ASSERT_EQ(J9THREAD_ERR_UNSUPPORTED_ATTR, omrthread_contention_profiler_start(OMRPORTLIB, 1));
+	omrthread_contention_profiler_stop();
+	ASSERT_EQ((uintptr_t)0, omrthread_contention_profiler_dump(samples, 1, &contendedCount));
+	ASSERT_EQ((uintptr_t)0, contendedCount);
+	ASSERT_EQ(J9THREAD_ERR, omrthread_contention_profiler_report(OMRPORTLIB, OMRPORT_TTY_OUT));
+}
+
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
@@ -0,0 +1,284 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Monitors created with J9THREAD_MONITOR_FUTEX must behave like any other monitor: exclusion, wait/notify,
+ * interrupt and abort all work the same whether a contended enter sleeps on the futex or not.
+ *
+ * The flag is only honoured by Linux three-tier locking builds; elsewhere it is cleared when the monitor is
+ * initialized and these tests are skipped.
+ */
+
+#include "omrthread.h"
+#include "thrtypes.h"
+#include "threadTestHelp.h"
+
+#define FUTEX_TEST_THREADS 4
+#define FUTEX_TEST_ENTERS 20000
+#define FUTEX_TEST_ROUNDS 1000
+
+typedef struct FutexTestData {
+	omrthread_monitor_t monitor;
+	volatile uintptr_t counter;
+	volatile uintptr_t turn;
+	volatile uintptr_t started;
+	volatile intptr_t rc;
+} FutexTestData;
+
+/**
+ * Initialize a monitor with J9THREAD_MONITOR_FUTEX.
+ * @return false (after logging why the test is skipped, and with no monitor left to destroy) if this build ignores the flag
+ */
+static bool
+initFutexMonitor(FutexTestData *data)
+{
+	EXPECT_EQ(0, omrthread_monitor_init_with_name(&data->monitor, J9THREAD_MONITOR_FUTEX, "futex monitor test"));
+	if (OMR_ARE_NO_BITS_SET(((J9ThreadMonitor *)data->monitor)->flags, J9THREAD_MONITOR_FUTEX)) {
+		omrTestEnv->log(LEVEL_ERROR, "J9THREAD_MONITOR_FUTEX is not supported by this build, skipping test\n");
+		omrthread_monitor_destroy(data->monitor);
+		return false;
+	}
+	return true;
+}
+
+static void
+waitForFlags(omrthread_t thread, uintptr_t flags)
+{
+	while (flags != (((J9AbstractThread *)thread)->flags & flags)) {
+		omrthread_sleep(1);
+	}
+}
+
+static int J9THREAD_PROC
+enterExitThread(void *arg)
+{
+	FutexTestData *data = (FutexTestData *)arg;
+
+	for (uintptr_t i = 0; i < FUTEX_TEST_ENTERS; i++) {
+		omrthread_monitor_enter(data->monitor);
+		uintptr_t counter = data->counter;
+		if (0 == (i % 64)) {
+			/* give the other threads a chance to find the monitor owned */
+			omrthread_yield();
+		}
+		data->counter = counter + 1;
+		omrthread_monitor_exit(data->monitor);
+	}
+	return 0;
+}
+
+TEST(FutexMonitorTest, mutualExclusion)
+{
+	FutexTestData data;
+	omrthread_t threads[FUTEX_TEST_THREADS];
+
+	data.counter = 0;
+	if (!initFutexMonitor(&data)) {
+		return;
+	}
+	for (uintptr_t i = 0; i < FUTEX_TEST_THREADS; i++) {
+		createJoinableThread(&threads[i], enterExitThread, &data);
+	}
+	for (uintptr_t i = 0; i < FUTEX_TEST_THREADS; i++) {
+		VERBOSE_JOIN(threads[i], J9THREAD_SUCCESS);
+	}
+	ASSERT_EQ((uintptr_t)(FUTEX_TEST_THREADS * FUTEX_TEST_ENTERS), data.counter);
+	omrthread_monitor_destroy(data.monitor);
+}
+
+static int J9THREAD_PROC
+pongThread(void *arg)
+{
+	FutexTestData *data = (FutexTestData *)arg;
+
+	omrthread_monitor_enter(data->monitor);
+	for (uintptr_t i = 0; i < FUTEX_TEST_ROUNDS; i++) {
+		while (0 == data->turn) {
+			omrthread_monitor_wait(data->monitor);
+		}
+		data->turn = 0;
+		data->counter += 1;
+		omrthread_monitor_notify(data->monitor);
+	}
+	omrthread_monitor_exit(data->monitor);
+	return 0;
+}
+
+TEST(FutexMonitorTest, waitNotify)
+{
+	FutexTestData data;
+	omrthread_t pong = NULL;
+
+	data.counter = 0;
+	data.turn = 0;
+	if (!initFutexMonitor(&data)) {
+		return;
+	}
+	createJoinableThread(&pong, pongThread, &data);
+
+	omrthread_monitor_enter(data.monitor);
+	for (uintptr_t i = 0; i < FUTEX_TEST_ROUNDS; i++) {
+		data.turn = 1;
+		omrthread_monitor_notify(data.monitor);
+		while (1 == data.turn) {
+			omrthread_monitor_wait(data.monitor);
+		}
+	}
+	omrthread_monitor_exit(data.monitor);
+
+	VERBOSE_JOIN(pong, J9THREAD_SUCCESS);
+	ASSERT_EQ((uintptr_t)FUTEX_TEST_ROUNDS, data.counter);
+	omrthread_monitor_destroy(data.monitor);
+}
+
+static int J9THREAD_PROC
+waitForTurnThread(void *arg)
+{
+	FutexTestData *data = (FutexTestData *)arg;
+
+	omrthread_monitor_enter(data->monitor);
+	data->started += 1;
+	while (0 == data->turn) {
+		omrthread_monitor_wait(data->monitor);
+	}
+	data->counter += 1;
+	omrthread_monitor_exit(data->monitor);
+	return 0;
+}
+
+TEST(FutexMonitorTest, notifyAll)
+{
+	FutexTestData data;
+	omrthread_t threads[FUTEX_TEST_THREADS];
+
+	data.counter = 0;
+	data.turn = 0;
+	data.started = 0;
+	if (!initFutexMonitor(&data)) {
+		return;
+	}
+	for (uintptr_t i = 0; i < FUTEX_TEST_THREADS; i++) {
+		createJoinableThread(&threads[i], waitForTurnThread, &data);
+	}
+	for (uintptr_t i = 0; i < FUTEX_TEST_THREADS; i++) {
+		waitForFlags(threads[i], J9THREAD_FLAG_WAITING);
+	}
+
+	omrthread_monitor_enter(data.monitor);
+	ASSERT_EQ((uintptr_t)FUTEX_TEST_THREADS, data.started);
+	data.turn = 1;
+	omrthread_monitor_notify_all(data.monitor);
+	omrthread_monitor_exit(data.monitor);
+
+	for (uintptr_t i = 0; i < FUTEX_TEST_THREADS; i++) {
+		VERBOSE_JOIN(threads[i], J9THREAD_SUCCESS);
+	}
+	ASSERT_EQ((uintptr_t)FUTEX_TEST_THREADS, data.counter);
+	omrthread_monitor_destroy(data.monitor);
+}
+
+static int J9THREAD_PROC
+interruptableWaitThread(void *arg)
+{
+	FutexTestData *data = (FutexTestData *)arg;
+
+	omrthread_monitor_enter(data->monitor);
+	data->rc = omrthread_monitor_wait_interruptable(data->monitor, 0, 0);
+	omrthread_monitor_exit(data->monitor);
+	return 0;
+}
+
+TEST(FutexMonitorTest, interruptWait)
+{
+	FutexTestData data;
+	omrthread_t waiter = NULL;
+
+	data.rc = -1;
+	if (!initFutexMonitor(&data)) {
+		return;
+	}
+	createJoinableThread(&waiter, interruptableWaitThread, &data);
+	waitForFlags(waiter, J9THREAD_FLAG_WAITING);
+
+	omrthread_interrupt(waiter);
+	VERBOSE_JOIN(waiter, J9THREAD_SUCCESS);
+	ASSERT_EQ(J9THREAD_INTERRUPTED, data.rc);
+	omrthread_monitor_destroy(data.monitor);
+}
+
+#if defined(OMR_THR_THREE_TIER_LOCKING)
+static int J9THREAD_PROC
+abortableEnterThread(void *arg)
+{
+	FutexTestData *data = (FutexTestData *)arg;
+
+	data->rc = omrthread_monitor_enter_abortable_using_threadId(data->monitor, omrthread_self());
+	if (0 == data->rc) {
+		omrthread_monitor_exit(data->monitor);
+	}
+	return 0;
+}
+
+static int J9THREAD_PROC
+blockedEnterThread(void *arg)
+{
+	FutexTestData *data = (FutexTestData *)arg;
+
+	omrthread_monitor_enter(data->monitor);
+	data->counter += 1;
+	omrthread_monitor_exit(data->monitor);
+	return 0;
+}
+
+/**
+ * validates that an abortable enter sleeping on the futex returns when aborted, and that a thread blocked
+ * alongside it still gets the monitor
+ */
+TEST(FutexMonitorTest, abortBlockedEnter)
+{
+	FutexTestData data;
+	omrthread_t aborted = NULL;
+	omrthread_t blocked = NULL;
+
+	data.counter = 0;
+	data.rc = -1;
+	if (!initFutexMonitor(&data)) {
+		return;
+	}
+
+	omrthread_monitor_enter(data.monitor);
+	createJoinableThread(&aborted, abortableEnterThread, &data);
+	createJoinableThread(&blocked, blockedEnterThread, &data);
+	waitForFlags(aborted, J9THREAD_FLAG_BLOCKED | J9THREAD_FLAG_ABORTABLE);
+	waitForFlags(blocked, J9THREAD_FLAG_BLOCKED);
+
+	omrthread_abort(aborted);
+	VERBOSE_JOIN(aborted, J9THREAD_SUCCESS);
+	ASSERT_EQ(J9THREAD_INTERRUPTED_MONITOR_ENTER, data.rc);
+	ASSERT_EQ((uintptr_t)0, data.counter);
+	omrthread_monitor_exit(data.monitor);
+
+	VERBOSE_JOIN(blocked, J9THREAD_SUCCESS);
+	ASSERT_EQ((uintptr_t)1, data.counter);
+	omrthread_monitor_destroy(data.monitor);
+}
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
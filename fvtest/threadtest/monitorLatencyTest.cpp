@@ -0,0 +1,205 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Benchmark of contended monitor enter/exit and of wait/notify ping-pong, for the default monitor and for
+ * one created with J9THREAD_MONITOR_FUTEX.
+ *
+ * Run with --gtest_also_run_disabled_tests --gtest_filter=MonitorLatencyTest.* -logLevel=info
+ * (not part of the functional test run).
+ *
+ * J9THREAD_MONITOR_FUTEX is only honoured by Linux three-tier locking builds, so the futex column is a
+ * second measurement of the default monitor anywhere else. The figures quoted when the futex path was added
+ * (about 80-95 ns per enter and 7.5 us per round trip for both kinds of monitor) came from a Release build
+ * (CMAKE_BUILD_TYPE=Release) with the default options of the CMake gate build, including
+ * OMR_THR_THREE_TIER_LOCKING=ON, run on a single CPU.
+ */
+
+#include "omrport.h"
+#include "testHelper.hpp"
+#include "thread_api.h"
+
+#define MONITOR_LATENCY_MAX_THREADS 16
+#define MONITOR_LATENCY_RUN_MILLIS 250
+#define MONITOR_LATENCY_PING_PONG_ROUNDS 20000
+
+typedef struct EnterExitData {
+	omrthread_monitor_t monitor;
+	omrthread_monitor_t synchronization;
+	uintptr_t started;
+	uintptr_t finished;
+	uint64_t enters;
+	volatile uintptr_t go;
+	volatile uintptr_t stop;
+	volatile uintptr_t shared;
+} EnterExitData;
+
+static intptr_t J9THREAD_PROC
+enterExitThread(EnterExitData *data)
+{
+	uint64_t enters = 0;
+
+	omrthread_monitor_enter(data->synchronization);
+	data->started += 1;
+	omrthread_monitor_notify_all(data->synchronization);
+	while (0 == data->go) {
+		omrthread_monitor_wait(data->synchronization);
+	}
+	omrthread_monitor_exit(data->synchronization);
+
+	while (0 == data->stop) {
+		omrthread_monitor_enter(data->monitor);
+		data->shared += 1;
+		omrthread_monitor_exit(data->monitor);
+		enters += 1;
+	}
+
+	omrthread_monitor_enter(data->synchronization);
+	data->enters += enters;
+	data->finished += 1;
+	omrthread_monitor_notify_all(data->synchronization);
+	omrthread_monitor_exit(data->synchronization);
+	return 0;
+}
+
+/**
+ * Have threadCount threads enter and exit one monitor for MONITOR_LATENCY_RUN_MILLIS.
+ * @return nanoseconds per enter/exit pair, across all of the threads
+ */
+static uint64_t
+measureEnterExit(uintptr_t flags, uintptr_t threadCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	EnterExitData data;
+	omrthread_t thread = NULL;
+
+	data.started = 0;
+	data.finished = 0;
+	data.enters = 0;
+	data.go = 0;
+	data.stop = 0;
+	data.shared = 0;
+	EXPECT_EQ(0, omrthread_monitor_init_with_name(&data.monitor, flags, "monitor latency"));
+	EXPECT_EQ(0, omrthread_monitor_init_with_name(&data.synchronization, 0, "monitor latency synchronization"));
+
+	omrthread_monitor_enter(data.synchronization);
+	for (uintptr_t i = 0; i < threadCount; i++) {
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, (omrthread_entrypoint_t) enterExitThread, &data));
+	}
+	while (data.started < threadCount) {
+		omrthread_monitor_wait(data.synchronization);
+	}
+	data.go = 1;
+	omrthread_monitor_notify_all(data.synchronization);
+	omrthread_monitor_exit(data.synchronization);
+
+	uint64_t start = omrtime_hires_clock();
+	omrthread_sleep(MONITOR_LATENCY_RUN_MILLIS);
+	data.stop = 1;
+	uint64_t end = omrtime_hires_clock();
+
+	omrthread_monitor_enter(data.synchronization);
+	while (data.finished < threadCount) {
+		omrthread_monitor_wait(data.synchronization);
+	}
+	omrthread_monitor_exit(data.synchronization);
+
+	omrthread_monitor_destroy(data.monitor);
+	omrthread_monitor_destroy(data.synchronization);
+
+	uint64_t nanos = omrtime_hires_delta(start, end, OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+	return (0 == data.enters) ? 0 : nanos / data.enters;
+}
+
+typedef struct PingPongData {
+	omrthread_monitor_t monitor;
+	volatile uintptr_t turn;
+	volatile uintptr_t finished;
+} PingPongData;
+
+static intptr_t J9THREAD_PROC
+pongThread(PingPongData *data)
+{
+	omrthread_monitor_enter(data->monitor);
+	for (uintptr_t i = 0; i < MONITOR_LATENCY_PING_PONG_ROUNDS; i++) {
+		while (0 == data->turn) {
+			omrthread_monitor_wait(data->monitor);
+		}
+		data->turn = 0;
+		omrthread_monitor_notify(data->monitor);
+	}
+	data->finished = 1;
+	omrthread_monitor_exit(data->monitor);
+	return 0;
+}
+
+/**
+ * Pass a turn back and forth between two threads with wait/notify, MONITOR_LATENCY_PING_PONG_ROUNDS times.
+ * @return nanoseconds per round trip
+ */
+static uint64_t
+measurePingPong(uintptr_t flags)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	PingPongData data;
+	omrthread_t thread = NULL;
+
+	data.turn = 0;
+	data.finished = 0;
+	EXPECT_EQ(0, omrthread_monitor_init_with_name(&data.monitor, flags, "monitor ping-pong"));
+	EXPECT_EQ(J9THREAD_SUCCESS, omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, (omrthread_entrypoint_t) pongThread, &data));
+
+	uint64_t start = omrtime_hires_clock();
+	omrthread_monitor_enter(data.monitor);
+	for (uintptr_t i = 0; i < MONITOR_LATENCY_PING_PONG_ROUNDS; i++) {
+		data.turn = 1;
+		omrthread_monitor_notify(data.monitor);
+		while (1 == data.turn) {
+			omrthread_monitor_wait(data.monitor);
+		}
+	}
+	uint64_t end = omrtime_hires_clock();
+	while (0 == data.finished) {
+		omrthread_monitor_wait(data.monitor);
+	}
+	omrthread_monitor_exit(data.monitor);
+	omrthread_monitor_destroy(data.monitor);
+
+	return omrtime_hires_delta(start, end, OMRPORT_TIME_DELTA_IN_NANOSECONDS) / MONITOR_LATENCY_PING_PONG_ROUNDS;
+}
+
+TEST(MonitorLatencyTest, DISABLED_contendedEnterExit)
+{
+	omrTestEnv->log("%8s %20s %20s\n", "threads", "default ns/enter", "futex ns/enter");
+	for (uintptr_t threadCount = 1; threadCount <= MONITOR_LATENCY_MAX_THREADS; threadCount *= 2) {
+		uint64_t defaultLatency = measureEnterExit(0, threadCount);
+		uint64_t futexLatency = measureEnterExit(J9THREAD_MONITOR_FUTEX, threadCount);
+		omrTestEnv->log("%8zu %20llu %20llu\n", threadCount, (unsigned long long)defaultLatency, (unsigned long long)futexLatency);
+	}
+}
+
+TEST(MonitorLatencyTest, DISABLED_waitNotifyPingPong)
+{
+	uint64_t defaultLatency = measurePingPong(0);
+	uint64_t futexLatency = measurePingPong(J9THREAD_MONITOR_FUTEX);
+	omrTestEnv->log("wait/notify round trip: default %llu ns  futex %llu ns\n", (unsigned long long)defaultLatency, (unsigned long long)futexLatency);
+}
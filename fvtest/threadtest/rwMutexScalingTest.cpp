@@ -0,0 +1,131 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+/*
+ * Benchmark of read acquisitions of an omrthread_rwmutex_t as the number of reading threads grows,
+ * for the default mutex and for one created with J9THREAD_RWMUTEX_READER_BIASED.
+ *
+ * Run with --gtest_also_run_disabled_tests --gtest_filter=RWMutexScalingTest.* -logLevel=info
+ * (not part of the functional test run).
+ */
+
+#include "omrport.h"
+#include "testHelper.hpp"
+#include "thread_api.h"
+
+#define RWMUTEX_SCALING_MAX_THREADS 128
+#define RWMUTEX_SCALING_RUN_MILLIS 250
+
+typedef struct ReadRateData {
+	omrthread_rwmutex_t handle;
+	omrthread_monitor_t synchronization;
+	uintptr_t started;
+	uintptr_t finished;
+	uint64_t acquisitions;
+	volatile uintptr_t go;
+	volatile uintptr_t stop;
+} ReadRateData;
+
+static intptr_t J9THREAD_PROC
+readRateThread(ReadRateData *data)
+{
+	uint64_t acquisitions = 0;
+
+	omrthread_monitor_enter(data->synchronization);
+	data->started += 1;
+	omrthread_monitor_notify_all(data->synchronization);
+	while (0 == data->go) {
+		omrthread_monitor_wait(data->synchronization);
+	}
+	omrthread_monitor_exit(data->synchronization);
+
+	while (0 == data->stop) {
+		omrthread_rwmutex_enter_read(data->handle);
+		omrthread_rwmutex_exit_read(data->handle);
+		acquisitions += 1;
+	}
+
+	omrthread_monitor_enter(data->synchronization);
+	data->acquisitions += acquisitions;
+	data->finished += 1;
+	omrthread_monitor_notify_all(data->synchronization);
+	omrthread_monitor_exit(data->synchronization);
+	return 0;
+}
+
+/**
+ * Have threadCount threads enter and exit a mutex for read for RWMUTEX_SCALING_RUN_MILLIS.
+ * @return read acquisitions per second across all of the threads
+ */
+static uint64_t
+measureReadRate(uintptr_t flags, uintptr_t threadCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	ReadRateData data;
+	omrthread_t thread = NULL;
+
+	data.started = 0;
+	data.finished = 0;
+	data.acquisitions = 0;
+	data.go = 0;
+	data.stop = 0;
+	EXPECT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_init(&data.handle, flags, "rwmutex scaling"));
+	EXPECT_EQ(0, omrthread_monitor_init_with_name(&data.synchronization, 0, "rwmutex scaling monitor"));
+
+	omrthread_monitor_enter(data.synchronization);
+	for (uintptr_t i = 0; i < threadCount; i++) {
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, (omrthread_entrypoint_t) readRateThread, &data));
+	}
+	while (data.started < threadCount) {
+		omrthread_monitor_wait(data.synchronization);
+	}
+	data.go = 1;
+	omrthread_monitor_notify_all(data.synchronization);
+	omrthread_monitor_exit(data.synchronization);
+
+	uint64_t start = omrtime_hires_clock();
+	omrthread_sleep(RWMUTEX_SCALING_RUN_MILLIS);
+	data.stop = 1;
+	uint64_t end = omrtime_hires_clock();
+
+	omrthread_monitor_enter(data.synchronization);
+	while (data.finished < threadCount) {
+		omrthread_monitor_wait(data.synchronization);
+	}
+	omrthread_monitor_exit(data.synchronization);
+
+	EXPECT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_destroy(data.handle));
+	omrthread_monitor_destroy(data.synchronization);
+
+	uint64_t micros = omrtime_hires_delta(start, end, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	return (0 == micros) ? 0 : (data.acquisitions * 1000000) / micros;
+}
+
+TEST(RWMutexScalingTest, DISABLED_readAcquisitionRate)
+{
+	omrTestEnv->log("%8s %20s %20s\n", "threads", "default reads/s", "reader-biased reads/s");
+	for (uintptr_t threadCount = 1; threadCount <= RWMUTEX_SCALING_MAX_THREADS; threadCount *= 2) {
+		uint64_t defaultRate = measureReadRate(J9THREAD_RWMUTEX_DEFAULT, threadCount);
+		uint64_t biasedRate = measureReadRate(J9THREAD_RWMUTEX_READER_BIASED, threadCount);
+		omrTestEnv->log("%8zu %20llu %20llu\n", threadCount, (unsigned long long)defaultRate, (unsigned long long)biasedRate);
+	}
+}
@@ -91,10 +91,11 @@ runRequest(SupportThreadInfo *info)
  * @param functionsToRun an array of functions pointers. Each function will be run one in sequence synchronized
  *        using the monitor within the SupporThreadInfo
  * @param numberFunctions the number of functions in the functionsToRun array
+ * @param flags the flags the rwmutex is created with
  * @returns a pointer to the newly created SupporThreadInfo
  */
 SupportThreadInfo *
-createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t numberFunctions)
+createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t numberFunctions, uintptr_t flags = J9THREAD_RWMUTEX_DEFAULT)
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
 	SupportThreadInfo *info = (SupportThreadInfo *)omrmem_allocate_memory(sizeof(SupportThreadInfo), OMRMEM_CATEGORY_THREADS);
@@ -103,7 +104,7 @@ createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t number
 	info->functionsToRun = functionsToRun;
 	info->numberFunctions = numberFunctions;
 	info->done = FALSE;
-	omrthread_rwmutex_init((omrthread_rwmutex_t *)&info->handle, 0, "supportThreadInfo rwmutex");
+	omrthread_rwmutex_init((omrthread_rwmutex_t *)&info->handle, flags, "supportThreadInfo rwmutex");
 	omrthread_monitor_init_with_name(&info->synchronization, 0, "supportThreadAInfo monitor");
 	return info;
 }
@@ -1136,3 +1137,251 @@ TEST(RWMutex, WritersExcludedByWriterNonBlockTest)
 	triggerNextStepDone(info);
 	freeSupportThreadInfo(info);
 }
+
+/**
+ * validates the following for a reader-biased rwmutex
+ *
+ * readers are excluded while another thread holds the rwmutex for write
+ * once writer exits, reader can enter
+ */
+TEST(RWMutex, ReaderBiasedReadersExcludedTest)
+{
+	SupportThreadInfo *info;
+	omrthread_entrypoint_t functionsToRun[2];
+	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
+	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
+	info = createSupportThreadInfo(functionsToRun, 2, J9THREAD_RWMUTEX_READER_BIASED);
+
+	/* first enter the mutex for write */
+	omrthread_rwmutex_enter_write(info->handle);
+	ASSERT_TRUE(omrthread_rwmutex_is_writelocked(info->handle));
+
+	/* start the concurrent thread that will try to enter for read and
+	 * check that it is blocked
+	 */
+	startConcurrentThread(info);
+	ASSERT_TRUE(0 == info->readCounter);
+
+	/* now release the rwmutex and validate that the thread enters it */
+	omrthread_monitor_enter(info->synchronization);
+	omrthread_rwmutex_exit_write(info->handle);
+	omrthread_monitor_wait_interruptable(info->synchronization, MILLI_TIMEOUT, NANO_TIMEOUT);
+	omrthread_monitor_exit(info->synchronization);
+	ASSERT_TRUE(1 == info->readCounter);
+
+	/* done now so ask thread to release and clean up */
+	triggerNextStepDone(info);
+	ASSERT_TRUE(0 == info->readCounter);
+	freeSupportThreadInfo(info);
+}
+
+/**
+ * validates the following for a reader-biased rwmutex
+ *
+ * writer waits for a reader which entered without the monitor
+ * once reader exits writer can enter
+ */
+TEST(RWMutex, ReaderBiasedWritersExcludedTest)
+{
+	SupportThreadInfo *info;
+	omrthread_entrypoint_t functionsToRun[2];
+	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_write;
+	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_write;
+	info = createSupportThreadInfo(functionsToRun, 2, J9THREAD_RWMUTEX_READER_BIASED);
+
+	/* first enter the mutex for read */
+	omrthread_rwmutex_enter_read(info->handle);
+
+	/* start the concurrent thread that will try to enter for write and
+	 * check that it is blocked
+	 */
+	startConcurrentThread(info);
+	ASSERT_TRUE(0 == info->writeCounter);
+
+	/* now release the rwmutex and validate that the thread enters it */
+	omrthread_monitor_enter(info->synchronization);
+	omrthread_rwmutex_exit_read(info->handle);
+	omrthread_monitor_wait_interruptable(info->synchronization, MILLI_TIMEOUT, NANO_TIMEOUT);
+	omrthread_monitor_exit(info->synchronization);
+	ASSERT_TRUE(1 == info->writeCounter);
+
+	/* done now so ask thread to release and clean up */
+	triggerNextStepDone(info);
+	ASSERT_TRUE(0 == info->writeCounter);
+	freeSupportThreadInfo(info);
+}
+
+/**
+ * validates the following for a reader-biased rwmutex
+ *
+ * try_enter_write does not block while another thread holds the rwmutex for read
+ * and succeeds once the reader has exited
+ */
+TEST(RWMutex, ReaderBiasedWritersExcludedNonBlockTest)
+{
+	intptr_t result = 0;
+	SupportThreadInfo *info;
+	omrthread_entrypoint_t functionsToRun[2];
+	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
+	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
+	info = createSupportThreadInfo(functionsToRun, 2, J9THREAD_RWMUTEX_READER_BIASED);
+
+	/* start the concurrent thread that will enter for read */
+	startConcurrentThread(info);
+	ASSERT_TRUE(1 == info->readCounter);
+
+	/* now try to enter for write making sure we don't block */
+	result = omrthread_rwmutex_try_enter_write(info->handle);
+	ASSERT_TRUE(J9THREAD_RWMUTEX_WOULDBLOCK == result);
+
+	/* the failed attempt must not hold up further readers */
+	omrthread_rwmutex_enter_read(info->handle);
+	omrthread_rwmutex_exit_read(info->handle);
+
+	/* once the reader is gone the writer gets in */
+	triggerNextStep(info);
+	ASSERT_TRUE(0 == info->readCounter);
+	result = omrthread_rwmutex_try_enter_write(info->handle);
+	ASSERT_TRUE(J9THREAD_RWMUTEX_OK == result);
+	omrthread_rwmutex_exit_write(info->handle);
+
+	triggerNextStepDone(info);
+	freeSupportThreadInfo(info);
+}
+
+/**
+ * validates the following for a reader-biased rwmutex
+ *
+ * a thread holding the rwmutex for read can enter it for read again while a writer waits
+ * the writer enters once the reader has exited as many times as it entered
+ */
+TEST(RWMutex, ReaderBiasedRecursiveReadTest)
+{
+	omrthread_rwmutex_t saveHandle;
+	SupportThreadInfo *infoReader;
+	SupportThreadInfo *infoWriter;
+	omrthread_entrypoint_t functionsToRunReader[5];
+	omrthread_entrypoint_t functionsToRunWriter[2];
+
+	functionsToRunReader[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
+	functionsToRunReader[1] = (omrthread_entrypoint_t) &enter_rwmutex_read;
+	functionsToRunReader[2] = (omrthread_entrypoint_t) &exit_rwmutex_read;
+	functionsToRunReader[3] = (omrthread_entrypoint_t) &exit_rwmutex_read;
+	functionsToRunReader[4] = (omrthread_entrypoint_t) &nop;
+	functionsToRunWriter[0] = (omrthread_entrypoint_t) &enter_rwmutex_write;
+	functionsToRunWriter[1] = (omrthread_entrypoint_t) &exit_rwmutex_write;
+
+	infoReader = createSupportThreadInfo(functionsToRunReader, 5, J9THREAD_RWMUTEX_READER_BIASED);
+	infoWriter = createSupportThreadInfo(functionsToRunWriter, 2);
+
+	/* set the two SupporThreadInfo structures so that they use the same rwmutex */
+	saveHandle = infoWriter->handle;
+	infoWriter->handle = infoReader->handle;
+
+	startConcurrentThread(infoReader);
+	ASSERT_TRUE(1 == infoReader->readCounter);
+
+	/* the writer now waits, and new readers must queue behind it */
+	startConcurrentThread(infoWriter);
+	ASSERT_TRUE(0 == infoWriter->writeCounter);
+
+	/* the reader re-enters without deadlocking against the waiting writer */
+	triggerNextStep(infoReader);
+	ASSERT_TRUE(2 == infoReader->readCounter);
+
+	triggerNextStep(infoReader);
+	ASSERT_TRUE(1 == infoReader->readCounter);
+	ASSERT_TRUE(0 == infoWriter->writeCounter);
+
+	omrthread_monitor_enter(infoWriter->synchronization);
+	triggerNextStep(infoReader);
+	omrthread_monitor_wait_interruptable(infoWriter->synchronization, MILLI_TIMEOUT, NANO_TIMEOUT);
+	omrthread_monitor_exit(infoWriter->synchronization);
+	ASSERT_TRUE(0 == infoReader->readCounter);
+	ASSERT_TRUE(1 == infoWriter->writeCounter);
+
+	triggerNextStepDone(infoWriter);
+	ASSERT_TRUE(0 == infoWriter->writeCounter);
+	triggerNextStepDone(infoReader);
+	infoWriter->handle = saveHandle;
+	freeSupportThreadInfo(infoReader);
+	freeSupportThreadInfo(infoWriter);
+}
+
+#define READER_BIASED_STRESS_READERS 4
+#define READER_BIASED_STRESS_ITERATIONS 20000
+
+typedef struct ReaderBiasedStressData {
+	omrthread_rwmutex_t handle;
+	omrthread_monitor_t synchronization;
+	volatile uintptr_t first;
+	volatile uintptr_t second;
+	volatile uintptr_t running;
+	volatile uintptr_t mismatches;
+} ReaderBiasedStressData;
+
+static intptr_t J9THREAD_PROC
+readerBiasedStressReader(ReaderBiasedStressData *data)
+{
+	for (uintptr_t i = 0; i < READER_BIASED_STRESS_ITERATIONS; i++) {
+		omrthread_rwmutex_enter_read(data->handle);
+		if (data->first != data->second) {
+			data->mismatches += 1;
+		}
+		omrthread_rwmutex_exit_read(data->handle);
+	}
+	omrthread_monitor_enter(data->synchronization);
+	data->running -= 1;
+	omrthread_monitor_notify_all(data->synchronization);
+	omrthread_monitor_exit(data->synchronization);
+	return 0;
+}
+
+static intptr_t J9THREAD_PROC
+readerBiasedStressWriter(ReaderBiasedStressData *data)
+{
+	for (uintptr_t i = 0; i < (READER_BIASED_STRESS_ITERATIONS / 10); i++) {
+		omrthread_rwmutex_enter_write(data->handle);
+		data->first += 1;
+		omrthread_yield();
+		data->second += 1;
+		omrthread_rwmutex_exit_write(data->handle);
+	}
+	omrthread_monitor_enter(data->synchronization);
+	data->running -= 1;
+	omrthread_monitor_notify_all(data->synchronization);
+	omrthread_monitor_exit(data->synchronization);
+	return 0;
+}
+
+/**
+ * validates that readers of a reader-biased rwmutex never see a writer's update half done
+ */
+TEST(RWMutex, ReaderBiasedConsistencyTest)
+{
+	ReaderBiasedStressData data;
+	omrthread_t thread = NULL;
+
+	data.first = 0;
+	data.second = 0;
+	data.mismatches = 0;
+	data.running = READER_BIASED_STRESS_READERS + 1;
+	ASSERT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_init(&data.handle, J9THREAD_RWMUTEX_READER_BIASED, "reader biased stress rwmutex"));
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&data.synchronization, 0, "reader biased stress monitor"));
+
+	for (uintptr_t i = 0; i < READER_BIASED_STRESS_READERS; i++) {
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, (omrthread_entrypoint_t) readerBiasedStressReader, &data));
+	}
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, (omrthread_entrypoint_t) readerBiasedStressWriter, &data));
+
+	omrthread_monitor_enter(data.synchronization);
+	while (0 != data.running) {
+		omrthread_monitor_wait(data.synchronization);
+	}
+	omrthread_monitor_exit(data.synchronization);
+
+	ASSERT_EQ((uintptr_t)0, data.mismatches);
+	ASSERT_EQ((uintptr_t)(READER_BIASED_STRESS_ITERATIONS / 10), data.first);
+	ASSERT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_destroy(data.handle));
+	omrthread_monitor_destroy(data.synchronization);
+}
@@ -0,0 +1,253 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Benchmark of the work-stealing omrthread_taskpool_t against a queue of tasks protected by one monitor,
+ * served by the same number of threads, for a binary tree of small tasks which fork their children and
+ * for a loop split into pieces.
+ *
+ * Run with --gtest_also_run_disabled_tests --gtest_filter=TaskPoolScalingTest.* -logLevel=info
+ * (not part of the functional test run).
+ */
+
+#include "AtomicSupport.hpp"
+#include "omrport.h"
+#include "testHelper.hpp"
+#include "thread_api.h"
+
+#define TASKPOOL_SCALING_MAX_WORKERS 8
+#define TASKPOOL_SCALING_TREE_DEPTH 16
+#define TASKPOOL_SCALING_LOOP_SIZE ((uintptr_t)1 << 22)
+#define TASKPOOL_SCALING_LOOP_GRAIN 1024
+#define TASKPOOL_SCALING_LEAF_WORK 200
+
+static volatile uintptr_t sink = 0;
+
+static void
+leafWork(uintptr_t iterations)
+{
+	uintptr_t value = iterations;
+	for (uintptr_t i = 0; i < iterations; i++) {
+		value = (value * 31) + i;
+	}
+	sink = value;
+}
+
+/* ---------------- the monitor-protected queue ---------------- */
+
+typedef struct NaiveTask {
+	uintptr_t depth; /* tree tasks: levels left below this one */
+	uintptr_t start; /* loop tasks: the piece to run */
+	uintptr_t end;
+} NaiveTask;
+
+typedef struct NaiveQueue {
+	omrthread_monitor_t monitor;
+	NaiveTask *tasks; /* ring of capacity entries */
+	uintptr_t capacity;
+	uintptr_t head;
+	uintptr_t count;
+	uintptr_t outstanding; /* queued or running */
+	uintptr_t stop;
+	uintptr_t finished;
+	BOOLEAN tree;
+} NaiveQueue;
+
+static void
+naivePush(NaiveQueue *queue, NaiveTask *task)
+{
+	omrthread_monitor_enter(queue->monitor);
+	queue->tasks[(queue->head + queue->count) % queue->capacity] = *task;
+	queue->count += 1;
+	queue->outstanding += 1;
+	omrthread_monitor_notify(queue->monitor);
+	omrthread_monitor_exit(queue->monitor);
+}
+
+static intptr_t J9THREAD_PROC
+naiveWorker(NaiveQueue *queue)
+{
+	NaiveTask task;
+
+	omrthread_monitor_enter(queue->monitor);
+	while (1) {
+		while ((0 == queue->count) && (0 == queue->stop)) {
+			omrthread_monitor_wait(queue->monitor);
+		}
+		if (0 != queue->stop) {
+			break;
+		}
+		task = queue->tasks[queue->head];
+		queue->head = (queue->head + 1) % queue->capacity;
+		queue->count -= 1;
+		omrthread_monitor_exit(queue->monitor);
+
+		if (queue->tree) {
+			if (0 == task.depth) {
+				leafWork(TASKPOOL_SCALING_LEAF_WORK);
+			} else {
+				NaiveTask child = { task.depth - 1, 0, 0 };
+				naivePush(queue, &child);
+				naivePush(queue, &child);
+			}
+		} else {
+			for (uintptr_t i = task.start; i < task.end; i++) {
+				sink += i;
+			}
+		}
+
+		omrthread_monitor_enter(queue->monitor);
+		queue->outstanding -= 1;
+		if (0 == queue->outstanding) {
+			omrthread_monitor_notify_all(queue->monitor);
+		}
+	}
+	queue->finished += 1;
+	omrthread_monitor_notify_all(queue->monitor);
+	omrthread_monitor_exit(queue->monitor);
+	return 0;
+}
+
+/**
+ * Run the tree or the loop on workerCount threads serving a NaiveQueue.
+ * @return elapsed milliseconds
+ */
+static uint64_t
+measureNaive(uintptr_t workerCount, BOOLEAN tree)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	NaiveQueue queue;
+	omrthread_t thread = NULL;
+
+	queue.capacity = tree ? ((uintptr_t)2 << TASKPOOL_SCALING_TREE_DEPTH) : (TASKPOOL_SCALING_LOOP_SIZE / TASKPOOL_SCALING_LOOP_GRAIN);
+	queue.tasks = new NaiveTask[queue.capacity];
+	queue.head = 0;
+	queue.count = 0;
+	queue.outstanding = 0;
+	queue.stop = 0;
+	queue.finished = 0;
+	queue.tree = tree;
+	EXPECT_EQ(0, omrthread_monitor_init_with_name(&queue.monitor, 0, "naive task queue"));
+	for (uintptr_t i = 0; i < workerCount; i++) {
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, (omrthread_entrypoint_t) naiveWorker, &queue));
+	}
+
+	uint64_t start = omrtime_current_time_millis();
+	if (tree) {
+		NaiveTask root = { TASKPOOL_SCALING_TREE_DEPTH, 0, 0 };
+		naivePush(&queue, &root);
+	} else {
+		for (uintptr_t i = 0; i < TASKPOOL_SCALING_LOOP_SIZE; i += TASKPOOL_SCALING_LOOP_GRAIN) {
+			NaiveTask piece = { 0, i, i + TASKPOOL_SCALING_LOOP_GRAIN };
+			naivePush(&queue, &piece);
+		}
+	}
+	omrthread_monitor_enter(queue.monitor);
+	while (0 != queue.outstanding) {
+		omrthread_monitor_wait(queue.monitor);
+	}
+	uint64_t end = omrtime_current_time_millis();
+
+	queue.stop = 1;
+	omrthread_monitor_notify_all(queue.monitor);
+	while (queue.finished < workerCount) {
+		omrthread_monitor_wait(queue.monitor);
+	}
+	omrthread_monitor_exit(queue.monitor);
+	omrthread_monitor_destroy(queue.monitor);
+	delete[] queue.tasks;
+	return end - start;
+}
+
+/* ---------------- the task pool ---------------- */
+
+static void
+treeTask(omrthread_taskgroup_t group, void *userData)
+{
+	uintptr_t depth = (uintptr_t)userData;
+
+	if (0 == depth) {
+		leafWork(TASKPOOL_SCALING_LEAF_WORK);
+	} else {
+		omrthread_taskgroup_submit(group, treeTask, (void *)(depth - 1));
+		omrthread_taskgroup_submit(group, treeTask, (void *)(depth - 1));
+	}
+}
+
+static intptr_t
+loopPiece(uintptr_t start, uintptr_t end, void *userData)
+{
+	for (uintptr_t i = start; i < end; i++) {
+		sink += i;
+	}
+	return 0;
+}
+
+/**
+ * Run the tree or the loop on a task pool of workerCount workers.
+ * @return elapsed milliseconds
+ */
+static uint64_t
+measurePool(uintptr_t workerCount, BOOLEAN tree)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	omrthread_taskpool_t pool = NULL;
+	omrthread_taskgroup_t group = NULL;
+
+	EXPECT_EQ(J9THREAD_SUCCESS, omrthread_taskpool_create(&pool, workerCount, J9THREAD_TASKPOOL_NUMA_SPREAD, "task pool scaling"));
+	EXPECT_EQ(J9THREAD_SUCCESS, omrthread_taskgroup_create(&group, pool));
+
+	uint64_t start = omrtime_current_time_millis();
+	if (tree) {
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_taskgroup_submit(group, treeTask, (void *)(uintptr_t)TASKPOOL_SCALING_TREE_DEPTH));
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_taskgroup_join(group));
+	} else {
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_taskpool_parallel_for(pool, 0, TASKPOOL_SCALING_LOOP_SIZE, TASKPOOL_SCALING_LOOP_GRAIN, loopPiece, NULL));
+	}
+	uint64_t end = omrtime_current_time_millis();
+
+	omrthread_taskgroup_destroy(group);
+	omrthread_taskpool_destroy(pool);
+	return end - start;
+}
+
+TEST(TaskPoolScalingTest, DISABLED_forkJoinTree)
+{
+	omrTestEnv->log("binary tree of depth %d, %d iterations per leaf\n", TASKPOOL_SCALING_TREE_DEPTH, TASKPOOL_SCALING_LEAF_WORK);
+	omrTestEnv->log("%8s %16s %16s\n", "workers", "queue ms", "task pool ms");
+	for (uintptr_t workerCount = 1; workerCount <= TASKPOOL_SCALING_MAX_WORKERS; workerCount *= 2) {
+		uint64_t naiveMillis = measureNaive(workerCount, TRUE);
+		uint64_t poolMillis = measurePool(workerCount, TRUE);
+		omrTestEnv->log("%8zu %16llu %16llu\n", workerCount, (unsigned long long)naiveMillis, (unsigned long long)poolMillis);
+	}
+}
+
+TEST(TaskPoolScalingTest, DISABLED_parallelFor)
+{
+	omrTestEnv->log("loop of %zu iterations in pieces of %d\n", TASKPOOL_SCALING_LOOP_SIZE, TASKPOOL_SCALING_LOOP_GRAIN);
+	omrTestEnv->log("%8s %16s %16s\n", "workers", "queue ms", "task pool ms");
+	for (uintptr_t workerCount = 1; workerCount <= TASKPOOL_SCALING_MAX_WORKERS; workerCount *= 2) {
+		uint64_t naiveMillis = measureNaive(workerCount, FALSE);
+		uint64_t poolMillis = measurePool(workerCount, FALSE);
+		omrTestEnv->log("%8zu %16llu %16llu\n", workerCount, (unsigned long long)naiveMillis, (unsigned long long)poolMillis);
+	}
+}
@@ -0,0 +1,210 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "AtomicSupport.hpp"
+#include "testHelper.hpp"
+#include "thread_api.h"
+
+#define TASKPOOL_TEST_WORKERS 4
+#define TASKPOOL_TEST_TASKS 1000
+#define TASKPOOL_TEST_DEPTH 12
+#define TASKPOOL_TEST_RANGE 100000
+
+static void
+markTask(omrthread_taskgroup_t group, void *userData)
+{
+	VM_AtomicSupport::add((volatile uintptr_t *)userData, 1);
+}
+
+/**
+ * validates that every task submitted from outside the pool runs exactly once before join returns
+ */
+TEST(TaskPoolTest, submitRunsEveryTask)
+{
+	omrthread_taskpool_t pool = NULL;
+	omrthread_taskgroup_t group = NULL;
+	uintptr_t counts[TASKPOOL_TEST_TASKS];
+
+	memset(counts, 0, sizeof(counts));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_taskpool_create(&pool, TASKPOOL_TEST_WORKERS, J9THREAD_TASKPOOL_DEFAULT, "task pool test"));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_taskgroup_create(&group, pool));
+	for (uintptr_t i = 0; i < TASKPOOL_TEST_TASKS; i++) {
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_taskgroup_submit(group, markTask, &counts[i]));
+	}
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_taskgroup_join(group));
+	for (uintptr_t i = 0; i < TASKPOOL_TEST_TASKS; i++) {
+		ASSERT_EQ((uintptr_t)1, counts[i]) << "task " << i;
+	}
+	omrthread_taskgroup_destroy(group);
+	omrthread_taskpool_destroy(pool);
+}
+
+typedef struct TreeTask {
+	uintptr_t depth;
+	volatile uintptr_t *leaves;
+	omrthread_taskpool_t pool;
+} TreeTask;
+
+/**
+ * Fork two children into a group of their own and join it, down to depth 0.
+ */
+static void
+treeTask(omrthread_taskgroup_t parentGroup, void *userData)
+{
+	TreeTask *node = (TreeTask *)userData;
+
+	if (0 == node->depth) {
+		VM_AtomicSupport::add(node->leaves, 1);
+	} else {
+		omrthread_taskgroup_t group = NULL;
+		TreeTask left = { node->depth - 1, node->leaves, node->pool };
+		TreeTask right = left;
+		omrthread_taskgroup_create(&group, node->pool);
+		omrthread_taskgroup_submit(group, treeTask, &left);
+		omrthread_taskgroup_submit(group, treeTask, &right);
+		omrthread_taskgroup_join(group);
+		omrthread_taskgroup_destroy(group);
+	}
+}
+
+/**
+ * validates nested fork/join: tasks which submit tasks to their own groups and join them from inside the pool
+ */
+TEST(TaskPoolTest, nestedForkJoin)
+{
+	omrthread_taskpool_t pool = NULL;
+	omrthread_taskgroup_t group = NULL;
+	volatile uintptr_t leaves = 0;
+
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_taskpool_create(&pool, TASKPOOL_TEST_WORKERS, J9THREAD_TASKPOOL_DEFAULT, "task pool test"));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_taskgroup_create(&group, pool));
+	TreeTask root = { TASKPOOL_TEST_DEPTH, &leaves, pool };
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_taskgroup_submit(group, treeTask, &root));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_taskgroup_join(group));
+	ASSERT_EQ((uintptr_t)1 << TASKPOOL_TEST_DEPTH, leaves);
+	omrthread_taskgroup_destroy(group);
+	omrthread_taskpool_destroy(pool);
+}
+
+static intptr_t
+markRange(uintptr_t start, uintptr_t end, void *userData)
+{
+	uint8_t *marks = (uint8_t *)userData;
+	for (uintptr_t i = start; i < end; i++) {
+		marks[i] += 1;
+	}
+	return 0;
+}
+
+/**
+ * validates that parallel_for covers every index exactly once, with NUMA placement requested
+ */
+TEST(TaskPoolTest, parallelForCoversRange)
+{
+	omrthread_taskpool_t pool = NULL;
+	uint8_t *marks = new uint8_t[TASKPOOL_TEST_RANGE];
+
+	memset(marks, 0, TASKPOOL_TEST_RANGE);
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_taskpool_create(&pool, TASKPOOL_TEST_WORKERS, J9THREAD_TASKPOOL_NUMA_SPREAD, "task pool test"));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_taskpool_parallel_for(pool, 0, TASKPOOL_TEST_RANGE, 100, markRange, marks));
+	for (uintptr_t i = 0; i < TASKPOOL_TEST_RANGE; i++) {
+		ASSERT_EQ(1, marks[i]) << "index " << i;
+	}
+	/* an empty range runs nothing */
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_taskpool_parallel_for(pool, 10, 10, 100, markRange, marks));
+	ASSERT_EQ(1, marks[10]);
+	omrthread_taskpool_destroy(pool);
+	delete[] marks;
+}
+
+static intptr_t
+stopAtFirstPiece(uintptr_t start, uintptr_t end, void *userData)
+{
+	VM_AtomicSupport::add((volatile uintptr_t *)userData, 1);
+	return 1;
+}
+
+/**
+ * validates that a piece returning non-zero cancels the pieces of the range which have not started
+ */
+TEST(TaskPoolTest, parallelForCancels)
+{
+	omrthread_taskpool_t pool = NULL;
+	volatile uintptr_t pieces = 0;
+
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_taskpool_create(&pool, TASKPOOL_TEST_WORKERS, J9THREAD_TASKPOOL_DEFAULT, "task pool test"));
+	ASSERT_EQ(J9THREAD_TASKGROUP_CANCELLED, omrthread_taskpool_parallel_for(pool, 0, TASKPOOL_TEST_RANGE, 1, stopAtFirstPiece, (void *)&pieces));
+	ASSERT_LT(pieces, (uintptr_t)TASKPOOL_TEST_RANGE);
+	omrthread_taskpool_destroy(pool);
+}
+
+typedef struct BlockingTask {
+	volatile uintptr_t started;
+	volatile uintptr_t release;
+} BlockingTask;
+
+static void
+blockingTask(omrthread_taskgroup_t group, void *userData)
+{
+	BlockingTask *blocker = (BlockingTask *)userData;
+	blocker->started = 1;
+	while (0 == blocker->release) {
+		omrthread_sleep(1);
+	}
+}
+
+/**
+ * validates that cancelling a group skips its queued tasks, and that the group can be used again once joined
+ */
+TEST(TaskPoolTest, cancelSkipsQueuedTasks)
+{
+	omrthread_taskpool_t pool = NULL;
+	omrthread_taskgroup_t group = NULL;
+	BlockingTask blocker = { 0, 0 };
+	volatile uintptr_t count = 0;
+
+	/* one worker, kept busy so the other tasks stay queued */
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_taskpool_create(&pool, 1, J9THREAD_TASKPOOL_DEFAULT, "task pool test"));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_taskgroup_create(&group, pool));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_taskgroup_submit(group, blockingTask, &blocker));
+	while (0 == blocker.started) {
+		omrthread_sleep(1);
+	}
+	for (uintptr_t i = 0; i < TASKPOOL_TEST_TASKS; i++) {
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_taskgroup_submit(group, markTask, (void *)&count));
+	}
+	omrthread_taskgroup_cancel(group);
+	ASSERT_TRUE(omrthread_taskgroup_is_cancelled(group));
+	blocker.release = 1;
+	ASSERT_EQ(J9THREAD_TASKGROUP_CANCELLED, omrthread_taskgroup_join(group));
+	ASSERT_EQ((uintptr_t)0, count);
+
+	ASSERT_FALSE(omrthread_taskgroup_is_cancelled(group));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_taskgroup_submit(group, markTask, (void *)&count));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_taskgroup_join(group));
+	ASSERT_EQ((uintptr_t)1, count);
+
+	omrthread_taskgroup_destroy(group);
+	omrthread_taskpool_destroy(pool);
+}
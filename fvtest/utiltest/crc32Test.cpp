@@ -0,0 +1,181 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <stdio.h>
+
+#include "omrport.h"
+#include "omrutil.h"
+#include "thread_api.h"
+
+#include "omrTest.h"
+
+#define CRC32_TEST_BUFFER_SIZE 4096
+#define CRC32_BENCHMARK_BYTES ((uintptr_t)256 * 1024 * 1024)
+
+static const U_32 implementations[] = { OMRCRC32_TABLE, OMRCRC32_SLICE_BY_8, OMRCRC32_HARDWARE };
+static const char * const implementationNames[] = { "table", "slice-by-8", "hardware" };
+
+class Crc32Test : public ::testing::Test
+{
+protected:
+	static OMRPortLibrary portLibrary;
+
+	static void
+	SetUpTestCase()
+	{
+		ASSERT_EQ(0, omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT));
+		ASSERT_EQ(0, omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)));
+	}
+
+	static void
+	TearDownTestCase()
+	{
+		omrcrc32Init(&portLibrary, OMRCRC32_HARDWARE);
+		portLibrary.port_shutdown_library(&portLibrary);
+		omrthread_detach(NULL);
+	}
+
+	/**
+	 * Switch omrcrc32 to implementations[i].  Only the hardware implementation may fall back to another one.
+	 * @return false, after saying so, if the implementation is not available on this processor
+	 */
+	static bool
+	selectImplementation(size_t i)
+	{
+		U_32 chosen = omrcrc32Init(&portLibrary, implementations[i]);
+		if (chosen != implementations[i]) {
+			EXPECT_EQ((U_32)OMRCRC32_HARDWARE, implementations[i]) << implementationNames[i];
+			printf("%s CRC-32 not available, skipped\n", implementationNames[i]);
+			return false;
+		}
+		return true;
+	}
+};
+
+OMRPortLibrary Crc32Test::portLibrary;
+
+/* one bit at a time, straight from the definition of the reflected CRC-32 */
+static U_32
+referenceCrc32(U_32 crc, const U_8 *bytes, uintptr_t len)
+{
+	crc = ~crc;
+	for (uintptr_t i = 0; i < len; i++) {
+		crc ^= bytes[i];
+		for (int bit = 0; bit < 8; bit++) {
+			crc = (crc >> 1) ^ (0xedb88320 & (0 - (crc & 1)));
+		}
+	}
+	return ~crc;
+}
+
+static void
+fillBuffer(U_8 *buffer, uintptr_t len, U_32 seed)
+{
+	for (uintptr_t i = 0; i < len; i++) {
+		seed = (seed * 1103515245) + 12345;
+		buffer[i] = (U_8)(seed >> 16);
+	}
+}
+
+/**
+ * validates every implementation against the check value of CRC-32 and the null and empty cases
+ */
+TEST_F(Crc32Test, checkValue)
+{
+	U_8 check[] = "123456789";
+
+	for (size_t i = 0; i < sizeof(implementations) / sizeof(implementations[0]); i++) {
+		if (!selectImplementation(i)) {
+			continue;
+		}
+		ASSERT_EQ((U_32)0xcbf43926, omrcrc32(0, check, 9)) << implementationNames[i];
+		ASSERT_EQ((U_32)0, omrcrc32(0, check, 0)) << implementationNames[i];
+		ASSERT_EQ((U_32)0, omrcrc32(0, NULL, 9)) << implementationNames[i];
+	}
+}
+
+/**
+ * validates that every implementation is bit-identical to the reference for each length, alignment
+ * and starting CRC, including a CRC continued over two calls
+ */
+TEST_F(Crc32Test, matchesReference)
+{
+	U_8 *buffer = new U_8[CRC32_TEST_BUFFER_SIZE + 16];
+
+	fillBuffer(buffer, CRC32_TEST_BUFFER_SIZE + 16, 42);
+	for (size_t i = 0; i < sizeof(implementations) / sizeof(implementations[0]); i++) {
+		if (!selectImplementation(i)) {
+			continue;
+		}
+		for (uintptr_t offset = 0; offset < 16; offset++) {
+			for (uintptr_t len = 0; len <= CRC32_TEST_BUFFER_SIZE; len += ((len < 300) ? 1 : 61)) {
+				U_8 *bytes = buffer + offset;
+				U_32 seed = (U_32)(len * 0x9e3779b9);
+				U_32 expected = referenceCrc32(seed, bytes, len);
+				ASSERT_EQ(expected, omrcrc32(seed, bytes, (U_32)len)) << implementationNames[i] << " offset " << offset << " length " << len;
+				uintptr_t split = len / 3;
+				ASSERT_EQ(expected, omrcrc32(omrcrc32(seed, bytes, (U_32)split), bytes + split, (U_32)(len - split))) << implementationNames[i] << " offset " << offset << " length " << len;
+			}
+		}
+	}
+	delete[] buffer;
+}
+
+/**
+ * measures the throughput of each implementation for small, medium and large buffers
+ *
+ * Run with --gtest_also_run_disabled_tests --gtest_filter=Crc32Test.DISABLED_* (not part of the functional test run).
+ */
+TEST_F(Crc32Test, DISABLED_throughput)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+	const uintptr_t sizes[] = { 64, 4096, 1024 * 1024 };
+	U_8 *buffer = new U_8[1024 * 1024];
+	U_32 crc = 0;
+
+	fillBuffer(buffer, 1024 * 1024, 7);
+	printf("%14s %12s %12s\n", "implementation", "buffer", "MB/s");
+	for (size_t i = 0; i < sizeof(implementations) / sizeof(implementations[0]); i++) {
+		U_32 chosen = omrcrc32Init(&portLibrary, implementations[i]);
+		if (chosen != implementations[i]) {
+			printf("%14s not available\n", implementationNames[i]);
+			continue;
+		}
+		for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+			uintptr_t rounds = CRC32_BENCHMARK_BYTES / sizes[s];
+			if (OMRCRC32_TABLE == implementations[i]) {
+				/* the byte-at-a-time loop is too slow to checksum the full amount */
+				rounds /= 8;
+			}
+			uint64_t start = omrtime_hires_clock();
+			for (uintptr_t r = 0; r < rounds; r++) {
+				crc = omrcrc32(crc, buffer, (U_32)sizes[s]);
+			}
+			uint64_t end = omrtime_hires_clock();
+			uint64_t micros = omrtime_hires_delta(start, end, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			printf("%14s %12zu %12llu\n", implementationNames[i], (size_t)sizes[s],
+				(unsigned long long)((0 == micros) ? 0 : ((uint64_t)rounds * sizes[s]) / micros));
+		}
+	}
+	printf("(crc %08x)\n", crc);
+	delete[] buffer;
+}
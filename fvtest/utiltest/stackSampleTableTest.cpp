@@ -0,0 +1,123 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrport.h"
+#include "stacksampletable.h"
+#include "thread_api.h"
+
+#include "omrTest.h"
+
+#define STACK_SAMPLE_TEST_TABLE_SIZE 8
+
+class StackSampleTableTest : public ::testing::Test
+{
+protected:
+	static OMRPortLibrary portLibrary;
+	OMRStackSampleTable table;
+	OMRStackSample samples[STACK_SAMPLE_TEST_TABLE_SIZE];
+
+	static void
+	SetUpTestCase()
+	{
+		ASSERT_EQ(0, omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT));
+		ASSERT_EQ(0, omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)));
+	}
+
+	static void
+	TearDownTestCase()
+	{
+		portLibrary.port_shutdown_library(&portLibrary);
+		omrthread_detach(NULL);
+	}
+
+	virtual void
+	SetUp()
+	{
+		stackSampleTableInit(&table, &portLibrary, samples, STACK_SAMPLE_TEST_TABLE_SIZE);
+	}
+};
+
+OMRPortLibrary StackSampleTableTest::portLibrary;
+
+/**
+ * validates that records for the same (key, stack) pair are aggregated, and that a different key or stack gets its own sample
+ */
+TEST_F(StackSampleTableTest, aggregatesByKeyAndStack)
+{
+	uintptr_t stackA[] = { 0x1000, 0x2000, 0x3000 };
+	uintptr_t stackB[] = { 0x1000, 0x2000, 0x3004 };
+
+	ASSERT_TRUE(stackSampleTableRecord(&table, 1, "one", stackA, 3, 10, 1));
+	ASSERT_TRUE(stackSampleTableRecord(&table, 1, "ignored", stackA, 3, 30, 2));
+	ASSERT_TRUE(stackSampleTableRecord(&table, 2, "two", stackA, 3, 5, 0));
+	ASSERT_TRUE(stackSampleTableRecord(&table, 1, "one", stackB, 3, 50, 0));
+	ASSERT_EQ((uintptr_t)3, stackSampleTableCount(&table));
+	ASSERT_EQ((uintptr_t)4, table.recordedCount);
+
+	OMRStackSample *sorted[STACK_SAMPLE_TEST_TABLE_SIZE];
+	ASSERT_EQ((uintptr_t)3, stackSampleTableSort(&table, sorted));
+	/* heaviest first */
+	ASSERT_EQ((uint64_t)50, sorted[0]->weight);
+	ASSERT_EQ((uintptr_t)0x3004, sorted[0]->frames[2]);
+	ASSERT_EQ((uintptr_t)1, sorted[1]->key);
+	ASSERT_STREQ("one", sorted[1]->name);
+	ASSERT_EQ((uintptr_t)2, sorted[1]->sampleCount);
+	ASSERT_EQ((uint64_t)40, sorted[1]->weight);
+	ASSERT_EQ((uint64_t)30, sorted[1]->maxWeight);
+	ASSERT_EQ((uint64_t)3, sorted[1]->extra);
+	ASSERT_EQ((uintptr_t)2, sorted[2]->key);
+	ASSERT_STREQ("two", sorted[2]->name);
+}
+
+/**
+ * validates that once every sample holds another pair records are dropped and counted, while known pairs still aggregate
+ */
+TEST_F(StackSampleTableTest, fullTableDrops)
+{
+	uintptr_t stack[] = { 0x1000 };
+
+	for (uintptr_t key = 0; key < STACK_SAMPLE_TEST_TABLE_SIZE; key++) {
+		ASSERT_TRUE(stackSampleTableRecord(&table, key, NULL, stack, 1, 1, 0));
+	}
+	ASSERT_FALSE(stackSampleTableRecord(&table, STACK_SAMPLE_TEST_TABLE_SIZE, NULL, stack, 1, 1, 0));
+	ASSERT_EQ((uintptr_t)1, table.droppedCount);
+	ASSERT_TRUE(stackSampleTableRecord(&table, 3, NULL, stack, 1, 1, 0));
+	ASSERT_EQ((uintptr_t)STACK_SAMPLE_TEST_TABLE_SIZE, stackSampleTableCount(&table));
+}
+
+#if defined(LINUX)
+/**
+ * validates that a captured stack starts at the caller of stackSampleTableCapture rather than inside the stack walk
+ */
+TEST_F(StackSampleTableTest, captureSkipsStackWalk)
+{
+	uintptr_t frames[OMR_STACK_SAMPLE_MAX_FRAMES];
+	uintptr_t otherFrames[OMR_STACK_SAMPLE_MAX_FRAMES];
+
+	uintptr_t frameCount = stackSampleTableCapture(&table, frames, OMR_STACK_SAMPLE_MAX_FRAMES);
+	uintptr_t otherFrameCount = stackSampleTableCapture(&table, otherFrames, OMR_STACK_SAMPLE_MAX_FRAMES);
+	ASSERT_LT((uintptr_t)0, frameCount);
+	ASSERT_EQ(frameCount, otherFrameCount);
+	/* the two captures are made from different instructions of this function */
+	ASSERT_NE(frames[0], otherFrames[0]);
+}
+#endif /* defined(LINUX) */
@@ -0,0 +1,186 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <math.h>
+
+#include "omrport.h"
+
+#include "AllocationSampler.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+MM_AllocationSampler *
+MM_AllocationSampler::newInstance(MM_EnvironmentBase *env)
+{
+	MM_AllocationSampler *sampler = (MM_AllocationSampler *)env->getForge()->allocate(sizeof(MM_AllocationSampler), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL != sampler) {
+		new(sampler) MM_AllocationSampler(env);
+		if (!sampler->initialize(env)) {
+			sampler->kill(env);
+			sampler = NULL;
+		}
+	}
+	return sampler;
+}
+
+MM_AllocationSampler::MM_AllocationSampler(MM_EnvironmentBase *env)
+	: MM_BaseNonVirtual()
+	, _meanInterval(env->getExtensions()->allocationSamplingInterval)
+	, _stackSamples(NULL)
+	, _sampleTime(0)
+{
+	_typeId = __FUNCTION__;
+}
+
+bool
+MM_AllocationSampler::initialize(MM_EnvironmentBase *env)
+{
+	_stackSamples = (OMRStackSample *)env->getForge()->allocate(sizeof(OMRStackSample) * ALLOCATION_SAMPLER_TABLE_SIZE, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL == _stackSamples) {
+		return false;
+	}
+	stackSampleTableInit(&_stacks, env->getPortLibrary(), _stackSamples, ALLOCATION_SAMPLER_TABLE_SIZE);
+
+	return true;
+}
+
+void
+MM_AllocationSampler::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _stackSamples) {
+		env->getForge()->free(_stackSamples);
+		_stackSamples = NULL;
+	}
+}
+
+void
+MM_AllocationSampler::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+uintptr_t
+MM_AllocationSampler::nextInterval(MM_EnvironmentBase *env)
+{
+	uint64_t seed = env->_allocationSampleSeed;
+	if (0 == seed) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		seed = ((uint64_t)(uintptr_t)env ^ omrtime_hires_clock()) | 1;
+	}
+
+	/* xorshift64* */
+	seed ^= seed >> 12;
+	seed ^= seed << 25;
+	seed ^= seed >> 27;
+	env->_allocationSampleSeed = seed;
+	uint64_t random = seed * (uint64_t)2685821657736338717ULL;
+
+	/* uniform in (0, 1], so the log is finite */
+	double uniform = (double)((random >> 11) + 1) / 9007199254740992.0;
+	double interval = -log(uniform) * (double)_meanInterval;
+
+	uintptr_t result = UDATA_MAX;
+	if (interval < 1.0) {
+		result = 1;
+	} else if (interval < (double)UDATA_MAX) {
+		result = (uintptr_t)interval;
+	}
+	return result;
+}
+
+void
+MM_AllocationSampler::sample(MM_EnvironmentBase *env, uintptr_t objectBytes)
+{
+	/* the thread's first call only draws its first interval */
+	if (0 != env->_allocationSampleThreshold) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		uint64_t startTime = omrtime_nano_time();
+		uintptr_t frames[OMR_STACK_SAMPLE_MAX_FRAMES];
+		uintptr_t frameCount = stackSampleTableCapture(&_stacks, frames, OMR_STACK_SAMPLE_MAX_FRAMES);
+		stackSampleTableRecord(&_stacks, 0, NULL, frames, frameCount, env->_allocationSampleBytes, objectBytes);
+		env->_allocationSampleBytes = 0;
+		/* the sampler accounts for its own cost so the overhead can be checked against the allocation rate */
+		MM_AtomicOperations::addU64(&_sampleTime, omrtime_nano_time() - startTime);
+	}
+	env->_allocationSampleThreshold = nextInterval(env);
+}
+
+void
+MM_AllocationSampler::getStats(uintptr_t *sampleCount, uintptr_t *stackCount, uintptr_t *droppedCount, uint64_t *sampleTime)
+{
+	*sampleCount = _stacks.recordedCount;
+	*stackCount = stackSampleTableCount(&_stacks);
+	*droppedCount = _stacks.droppedCount;
+	*sampleTime = _sampleTime / 1000;
+}
+
+bool
+MM_AllocationSampler::report(MM_EnvironmentBase *env, const char *fileName)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	intptr_t fd = OMRPORT_TTY_OUT;
+	if (NULL != fileName) {
+		fd = omrfile_open(fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (-1 == fd) {
+			return false;
+		}
+	}
+
+	OMRStackSample **samples = (OMRStackSample **)env->getForge()->allocate(sizeof(OMRStackSample *) * ALLOCATION_SAMPLER_TABLE_SIZE, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	uintptr_t *heapBuffer = (uintptr_t *)env->getForge()->allocate(OMR_STACK_SAMPLE_PRINT_HEAP_SIZE, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	bool result = (NULL != samples) && (NULL != heapBuffer);
+
+	if (result) {
+		uintptr_t stackCount = stackSampleTableSort(&_stacks, samples);
+		uint64_t totalBytes = 0;
+		for (uintptr_t i = 0; i < stackCount; i++) {
+			totalBytes += samples[i]->weight;
+		}
+
+		omrfile_printf(fd, "Allocation samples: %zu samples, %zu stacks, %zu dropped, mean interval %zu bytes, %llu us sampling\n",
+				(uintptr_t)_stacks.recordedCount, stackCount, (uintptr_t)_stacks.droppedCount, _meanInterval, _sampleTime / 1000);
+
+		for (uintptr_t i = 0; i < stackCount; i++) {
+			OMRStackSample *sample = samples[i];
+			uint64_t sampledBytes = sample->weight;
+			uintptr_t sampleCount = sample->sampleCount;
+			uint64_t permille = (0 == totalBytes) ? 0 : ((sampledBytes * 1000) / totalBytes);
+			omrfile_printf(fd, "Stack %zu: %llu bytes (%llu.%llu%%), %zu samples, mean object size %llu bytes\n",
+					i + 1, sampledBytes, permille / 10, permille % 10, sampleCount, sample->extra / sampleCount);
+			stackSampleTablePrintStack(&_stacks, fd, sample, heapBuffer);
+		}
+	}
+
+	if (NULL != heapBuffer) {
+		env->getForge()->free(heapBuffer);
+	}
+	if (NULL != samples) {
+		env->getForge()->free(samples);
+	}
+	if (OMRPORT_TTY_OUT != fd) {
+		omrfile_close(fd);
+	}
+	return result;
+}
@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(ALLOCATIONSAMPLER_HPP_)
+#define ALLOCATIONSAMPLER_HPP_
+
+#include "omrcomp.h"
+#include "stacksampletable.h"
+
+#include "BaseNonVirtual.hpp"
+#include "EnvironmentBase.hpp"
+
+#define ALLOCATION_SAMPLER_TABLE_SIZE 1024 /**< Number of distinct stacks the sampler can aggregate, must be a power of two */
+
+/**
+ * Samples object allocation by native stack.  Every thread counts the bytes it allocates out of line, which includes
+ * each TLH it has filled, and takes a sample once it has allocated a randomly drawn number of bytes.  The intervals are
+ * exponentially distributed around -Xgc:allocationSamplingInterval, so allocation sites are sampled in proportion to
+ * the bytes they allocate whatever the allocation pattern.  Each sample captures the stack of the allocating thread with
+ * omrintrospect_backtrace_thread() and is added, weighted by the bytes it stands for, to an OMRStackSampleTable which
+ * threads update without locking.  report() dumps the table, heaviest stack first.
+ * @ingroup GC_Base_Core
+ */
+class MM_AllocationSampler : public MM_BaseNonVirtual
+{
+/*
+ * Data members
+ */
+public:
+protected:
+private:
+	uintptr_t _meanInterval; /**< mean number of bytes between two samples of a thread */
+	OMRStackSampleTable _stacks; /**< samples by stack, weighted by sampled bytes with the object bytes as the extra value */
+	OMRStackSample *_stackSamples; /**< storage of _stacks */
+	volatile uint64_t _sampleTime; /**< total time, in nanoseconds, allocating threads have spent taking samples */
+
+/*
+ * Function members
+ */
+public:
+	static MM_AllocationSampler *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Charge bytes allocated out of line to the thread, sampling the allocation if they take it past its next sample.
+	 * @param bytesAllocated bytes the allocation added to the thread's total, including a TLH it had to refill
+	 * @param objectBytes size of the object allocated
+	 */
+	MMINLINE void
+	allocated(MM_EnvironmentBase *env, uintptr_t bytesAllocated, uintptr_t objectBytes)
+	{
+		env->_allocationSampleBytes += bytesAllocated;
+		if (env->_allocationSampleBytes >= env->_allocationSampleThreshold) {
+			sample(env, objectBytes);
+		}
+	}
+
+	/**
+	 * Write the aggregated samples, heaviest stack first, with the frames resolved to symbols where possible.
+	 * @param fileName file to write, or NULL for the terminal
+	 * @return true on success, false if the file could not be written
+	 */
+	bool report(MM_EnvironmentBase *env, const char *fileName);
+
+	/**
+	 * @param[out] sampleCount samples recorded
+	 * @param[out] stackCount distinct stacks recorded
+	 * @param[out] droppedCount samples lost because every slot of the table held another stack
+	 * @param[out] sampleTime total time, in microseconds, allocating threads have spent taking samples
+	 */
+	void getStats(uintptr_t *sampleCount, uintptr_t *stackCount, uintptr_t *droppedCount, uint64_t *sampleTime);
+
+	MM_AllocationSampler(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+	/**
+	 * Take a sample for the bytes the thread has allocated since its last one, then draw its next interval.
+	 */
+	void sample(MM_EnvironmentBase *env, uintptr_t objectBytes);
+
+	/**
+	 * @return the number of bytes the thread allocates before its next sample
+	 */
+	uintptr_t nextInterval(MM_EnvironmentBase *env);
+};
+
+#endif /* ALLOCATIONSAMPLER_HPP_ */
@@ -69,6 +69,10 @@ MM_CardTable::tearDown(MM_EnvironmentBase *env)
 {
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 	MM_MemoryManager *memoryManager = extensions->memoryManager;
+	if (NULL != _dirtyCardSummary) {
+		_dirtyCardSummary->kill(env);
+		_dirtyCardSummary = NULL;
+	}
 	/* Get rid of the virtual memory allocated for card table */
 	memoryManager->destroyVirtualMemory(env, &_cardTableMemoryHandle);
 }
@@ -256,6 +260,7 @@ MM_CardTable::dirtyCardWithValue(MM_EnvironmentBase *env, omrobjectptr_t objectR
 		if (newValue != oldValue) {
 			Assert_MM_true((CARD_DIRTY == newValue) || (CARD_CLEAN == oldValue));
 			*card = newValue;
+			summarizeDirtyCard(card);
 		}
 	}
 }
@@ -270,6 +275,7 @@ MM_CardTable::dirtyCardRange(MM_EnvironmentBase *env, void *heapAddrFrom, void *
 		/* If card not already dirty then dirty it */
 		if ((Card)CARD_DIRTY != *card) {
 			*card = (Card)CARD_DIRTY;
+			summarizeDirtyCard(card);
 		}
 	}
 }
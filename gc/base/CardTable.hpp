@@ -34,6 +34,7 @@
 #include "modronbase.h"
 
 #include "BaseVirtual.hpp"
+#include "DirtyCardSummary.hpp"
 #include "MemoryManager.hpp"
 
 class MM_EnvironmentBase;
@@ -57,6 +58,7 @@ class MM_CardTable : public MM_BaseVirtual
 public:
 protected:
 	void *_heapAlloc;
+	MM_DirtyCardSummary *_dirtyCardSummary; /**< Summary of possibly dirty cards kept by the dirty functions below, NULL if not in use */
 private:
 	MM_MemoryHandle _cardTableMemoryHandle;	/**< memory handle for array backing store */
 	Card *_cardTableStart;
@@ -257,6 +259,18 @@ protected:
 	 * @return false if the decommit failed
 	 */
 	bool decommitCardTableMemory(MM_EnvironmentBase *env, Card *lowCard, Card *highCard, Card *lowValidCard, Card *highValidCard);
+
+	/**
+	 * Record a card which has just been set to a non-clean value in the dirty card summary, if there is one.
+	 * @param card[in] The card, already stored
+	 */
+	MMINLINE void
+	summarizeDirtyCard(Card *card)
+	{
+		if (NULL != _dirtyCardSummary) {
+			_dirtyCardSummary->markCard((uintptr_t)(card - _cardTableStart));
+		}
+	}
 	
 	/**
 	 * Create a CardTable object.
@@ -264,6 +278,7 @@ protected:
 	MM_CardTable()
 		: MM_BaseVirtual()
 		, _heapAlloc(NULL)
+		, _dirtyCardSummary(NULL)
 		, _cardTableMemoryHandle()
 		, _cardTableStart(NULL)
 		, _cardTableVirtualStart(NULL)
@@ -36,6 +36,7 @@
 #include "GlobalAllocationManager.hpp"
 #include "GlobalCollector.hpp"
 #include "Heap.hpp"
+#include "HeapMapScanner.hpp"
 #include "HeapRegionManager.hpp"
 #include "OMR_VM.hpp"
 #include "OMR_VMThread.hpp"
@@ -72,6 +73,7 @@ MM_Configuration::initialize(MM_EnvironmentBase* env)
 			if (initializeNUMAManager(env)) {
 				initializeGCThreadCount(env);
 				initializeGCParameters(env);
+				MM_HeapMapScanner::selectKernel(env);
 				extensions->_lightweightNonReentrantLockPool = pool_new(sizeof(J9ThreadMonitorTracing), 0, 0, 0, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_MM, POOL_FOR_PORT(env->getPortLibrary()));
 				result = (NULL != extensions->_lightweightNonReentrantLockPool);
 			}
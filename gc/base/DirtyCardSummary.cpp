@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "DirtyCardSummary.hpp"
+
+#include <string.h>
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "Math.hpp"
+
+MM_DirtyCardSummary *
+MM_DirtyCardSummary::newInstance(MM_EnvironmentBase *env, uintptr_t cardCount)
+{
+	MM_DirtyCardSummary *summary = (MM_DirtyCardSummary *)env->getForge()->allocate(sizeof(MM_DirtyCardSummary), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != summary) {
+		new(summary) MM_DirtyCardSummary();
+		if (!summary->initialize(env, cardCount)) {
+			summary->kill(env);
+			summary = NULL;
+		}
+	}
+	return summary;
+}
+
+bool
+MM_DirtyCardSummary::initialize(MM_EnvironmentBase *env, uintptr_t cardCount)
+{
+	uintptr_t granules = MM_Math::roundToCeiling((uintptr_t)1 << DIRTY_CARD_SUMMARY_GRANULE_SHIFT, cardCount) >> DIRTY_CARD_SUMMARY_GRANULE_SHIFT;
+	uintptr_t blocks = MM_Math::roundToCeiling((uintptr_t)1 << DIRTY_CARD_SUMMARY_BLOCK_SHIFT, cardCount) >> DIRTY_CARD_SUMMARY_BLOCK_SHIFT;
+	_granuleSlots = MM_Math::roundToCeiling(J9BITS_BITS_IN_SLOT, granules) / J9BITS_BITS_IN_SLOT;
+	_blockSlots = MM_Math::roundToCeiling(J9BITS_BITS_IN_SLOT, blocks) / J9BITS_BITS_IN_SLOT;
+
+	/* both levels share one allocation, the block bits follow the granule bits */
+	_granuleBits = (uintptr_t *)env->getForge()->allocate((_granuleSlots + _blockSlots) * sizeof(uintptr_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _granuleBits) {
+		return false;
+	}
+	_blockBits = _granuleBits + _granuleSlots;
+	clear();
+
+	return true;
+}
+
+void
+MM_DirtyCardSummary::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _granuleBits) {
+		env->getForge()->free(_granuleBits);
+		_granuleBits = NULL;
+		_blockBits = NULL;
+	}
+}
+
+void
+MM_DirtyCardSummary::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+void
+MM_DirtyCardSummary::clear()
+{
+	memset(_granuleBits, 0, (_granuleSlots + _blockSlots) * sizeof(uintptr_t));
+}
+
+uintptr_t
+MM_DirtyCardSummary::findPossiblyDirtyCard(uintptr_t cardIndex, uintptr_t topIndex)
+{
+	while (cardIndex < topIndex) {
+		uintptr_t block = cardIndex >> DIRTY_CARD_SUMMARY_BLOCK_SHIFT;
+		uintptr_t blockSlot = _blockBits[block / J9BITS_BITS_IN_SLOT];
+		if (0 == blockSlot) {
+			/* every block in this slot is clean */
+			cardIndex = MM_Math::roundToFloor(J9BITS_BITS_IN_SLOT, block + J9BITS_BITS_IN_SLOT) << DIRTY_CARD_SUMMARY_BLOCK_SHIFT;
+		} else if (0 == (blockSlot & bitMask(block))) {
+			cardIndex = (block + 1) << DIRTY_CARD_SUMMARY_BLOCK_SHIFT;
+		} else {
+			uintptr_t granule = cardIndex >> DIRTY_CARD_SUMMARY_GRANULE_SHIFT;
+			if (0 != (_granuleBits[granule / J9BITS_BITS_IN_SLOT] & bitMask(granule))) {
+				return cardIndex;
+			}
+			cardIndex = (granule + 1) << DIRTY_CARD_SUMMARY_GRANULE_SHIFT;
+		}
+	}
+	return topIndex;
+}
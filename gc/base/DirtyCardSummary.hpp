@@ -0,0 +1,131 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(DIRTYCARDSUMMARY_HPP_)
+#define DIRTYCARDSUMMARY_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+#include "Bits.hpp"
+
+#define DIRTY_CARD_SUMMARY_GRANULE_SHIFT 9 /**< log2 of the cards summarized by one granule bit (512 cards) */
+#define DIRTY_CARD_SUMMARY_BLOCK_SHIFT 12 /**< log2 of the cards summarized by one block bit (4096 cards) */
+
+class MM_EnvironmentBase;
+
+/**
+ * Two level summary of the card table: one bit for each granule of 512 cards and one bit for each
+ * block of 4096 cards. A bit is set when any card it covers may have been dirtied since the summary
+ * was last cleared, so a clear bit proves the whole range is clean and a scan can step over it.
+ *
+ * Bits are only ever set concurrently; clear() must be called when no scan relies on the summary.
+ * Whoever dirties a card stores the card before marking it here.
+ * @ingroup GC_Base
+ */
+class MM_DirtyCardSummary : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	uintptr_t *_granuleBits; /**< one bit per 512 cards */
+	uintptr_t *_blockBits; /**< one bit per 4096 cards */
+	uintptr_t _granuleSlots; /**< size of _granuleBits, in slots */
+	uintptr_t _blockSlots; /**< size of _blockBits, in slots */
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	MMINLINE static uintptr_t bitMask(uintptr_t bitIndex) { return (uintptr_t)1 << (bitIndex % J9BITS_BITS_IN_SLOT); }
+
+	MMINLINE static void
+	setBit(uintptr_t *bits, uintptr_t bitIndex)
+	{
+		volatile uintptr_t *slot = (volatile uintptr_t *)&bits[bitIndex / J9BITS_BITS_IN_SLOT];
+		uintptr_t mask = bitMask(bitIndex);
+		/* bits are set once per cycle, so almost every call only reads */
+		while (0 == (*slot & mask)) {
+			uintptr_t oldValue = *slot;
+			if (oldValue == MM_AtomicOperations::lockCompareExchange(slot, oldValue, oldValue | mask)) {
+				break;
+			}
+		}
+	}
+
+protected:
+	bool initialize(MM_EnvironmentBase *env, uintptr_t cardCount);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+public:
+	/**
+	 * @param[in] env The thread initializing the collector
+	 * @param[in] cardCount The largest number of cards the card table can have
+	 * @return the new summary, or NULL if it could not be allocated
+	 */
+	static MM_DirtyCardSummary *newInstance(MM_EnvironmentBase *env, uintptr_t cardCount);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Record that a card may be dirty.
+	 * @param[in] cardIndex Index of the card from the start of the card table
+	 */
+	MMINLINE void
+	markCard(uintptr_t cardIndex)
+	{
+		setBit(_granuleBits, cardIndex >> DIRTY_CARD_SUMMARY_GRANULE_SHIFT);
+		setBit(_blockBits, cardIndex >> DIRTY_CARD_SUMMARY_BLOCK_SHIFT);
+	}
+
+	/**
+	 * Forget every card marked so far.
+	 */
+	void clear();
+
+	/**
+	 * Find the first card at or after cardIndex which is not known to be clean. Clean blocks
+	 * are skipped a slot of block bits at a time, then clean granules one at a time.
+	 * @param[in] cardIndex Index of the first card to consider
+	 * @param[in] topIndex Index of the card after the last one to consider
+	 * @return cardIndex, or the index of the start of the first granule after it with its bit
+	 * set, or topIndex if every card in the range is clean
+	 */
+	uintptr_t findPossiblyDirtyCard(uintptr_t cardIndex, uintptr_t topIndex);
+
+	MM_DirtyCardSummary()
+		: MM_BaseVirtual()
+		, _granuleBits(NULL)
+		, _blockBits(NULL)
+		, _granuleSlots(0)
+		, _blockSlots(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* DIRTYCARDSUMMARY_HPP_ */
@@ -149,6 +149,9 @@ public:
 	uintptr_t _oolTraceAllocationBytes; /**< Tracks the bytes allocated since the last ool object trace */
 	uintptr_t _traceAllocationBytes;  /**< Tracks the bytes allocated since the last object trace */
 	uintptr_t _traceAllocationBytesCurrentTLH; /**< keep the bytes of times of sampling threshold for last object trace(include allocation bytes inside TLH) */
+	uintptr_t _allocationSampleBytes; /**< Bytes allocated out of line since the last allocation sample */
+	uintptr_t _allocationSampleThreshold; /**< Bytes to allocate before the next allocation sample, 0 until the first interval is drawn */
+	uint64_t _allocationSampleSeed; /**< State of the random generator drawing allocation sample intervals */
 
 	uintptr_t approxScanCacheCount; /**< Local copy of approximate entries in global Cache Scan List. Updated upon allocation of new cache. */
 
@@ -733,6 +736,9 @@ public:
 		,_oolTraceAllocationBytes(0)
 		,_traceAllocationBytes(0)
 		,_traceAllocationBytesCurrentTLH(0)
+		,_allocationSampleBytes(0)
+		,_allocationSampleThreshold(0)
+		,_allocationSampleSeed(0)
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
 		,_lastSyncPointReached(NULL)
@@ -790,6 +796,9 @@ public:
 		,_oolTraceAllocationBytes(0)
 		,_traceAllocationBytes(0)
 		,_traceAllocationBytesCurrentTLH(0)
+		,_allocationSampleBytes(0)
+		,_allocationSampleThreshold(0)
+		,_allocationSampleSeed(0)
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
 		,_lastSyncPointReached(NULL)
@@ -52,6 +52,7 @@ class MM_ClassLoaderRememberedSet;
 class MM_CollectorLanguageInterface;
 class MM_CompactGroupPersistentStats;
 class MM_CompressedCardTable;
+class MM_AllocationSampler;
 class MM_Configuration;
 class MM_EnvironmentBase;
 class MM_FrequentObjectsStats;
@@ -62,6 +63,7 @@ class MM_HeapMap;
 class MM_HeapRegionManager;
 
 class MM_InterRegionRememberedSet;
+class MM_MemoryMaintenanceThread;
 class MM_MemoryManager;
 class MM_MemorySubSpace;
 class MM_ParallelDispatcher;
@@ -263,6 +265,10 @@ public:
 #endif /* OMR_GC_DOUBLE_MAP_ARRAYLETS */
 	uintptr_t requestedPageSize;
 	uintptr_t requestedPageFlags;
+	bool mixedPageSizeHeap; /**< Set by -Xgc:mixedPageSizeHeap.  Reserve the heap with default pages and back it with explicit large pages chunk by chunk, falling back to transparent huge pages or default pages */
+	bool backgroundDecommit; /**< Set by -Xgc:backgroundDecommit.  Memory removed from the heap by contraction is decommitted by MM_MemoryMaintenanceThread outside of the pause */
+	uintptr_t backgroundDecommitCPUPercent; /**< Share of one CPU, in percent, the memory maintenance thread may use (-Xgc:backgroundDecommitCPUPercent=) */
+	MM_MemoryMaintenanceThread* memoryMaintenanceThread; /**< The background decommit thread, NULL unless -Xgc:backgroundDecommit is set and the thread started */
 	uintptr_t gcmetadataPageSize;
 	uintptr_t gcmetadataPageFlags;
 
@@ -298,6 +304,9 @@ public:
 	uintptr_t frequentObjectAllocationSamplingRate; /**< # bytes to sample / # bytes allocated */
 	MM_FrequentObjectsStats* frequentObjectsStats;
 	uint32_t frequentObjectAllocationSamplingDepth; /**< # of frequent objects we'd like to report */
+	bool allocationSampling; /**< Set by -Xgc:allocationSampling.  Capture the native stack of an allocation every allocationSamplingInterval bytes on average */
+	uintptr_t allocationSamplingInterval; /**< Mean number of bytes allocated by a thread between two samples (-Xgc:allocationSamplingInterval=) */
+	MM_AllocationSampler* allocationSampler; /**< Aggregated allocation samples, NULL unless -Xgc:allocationSampling is set */
 
 	uint32_t estimateFragmentation; /**< Enable estimate fragmentation, NO_ESTIMATE_FRAGMENTATION, LOCALGC_ESTIMATE_FRAGMENTATION, GLOBALGC_ESTIMATE_FRAGMENTATION(default) */
 	bool processLargeAllocateStats; /**< Enable process LargeObjectAllocateStats */
@@ -328,6 +337,8 @@ public:
 	uintptr_t tlhIncrementSize;
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
+	bool tlhAdaptiveSizing; /**< if true, each thread's TLH refresh size is capped from its allocation and TLH waste since the previous GC */
+	uintptr_t tlhAdaptiveWasteTarget; /**< percentage of a thread's TLH memory that adaptive TLH sizing aims to keep unused */
 
 	MM_AllocationStats allocationStats; /**< Statistics for allocations. */
 	uintptr_t bytesAllocatedMost;
@@ -337,6 +348,7 @@ public:
 	uintptr_t splitFreeListSplitAmount;
 	uintptr_t splitFreeListNumberChunksPrepared; /**< Used in MPSAOL postProcess. Shared for all MPSAOLs. Do not overwrite during postProcess for any MPSAOL. */
 	bool enableHybridMemoryPool;
+	bool freeListSizeClassIndex; /**< Enabled by -Xgc:freeListSizeClassIndex.  Maintain a power-of-two size class index into the address ordered free list to skip entries too small for an allocate */
 
 	bool largeObjectArea;
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
@@ -376,6 +388,9 @@ public:
 	uintptr_t heapContractionGCTimeThreshold; /**< min percentage of time spent in gc before contraction */
 	uintptr_t heapExpansionStabilizationCount; /**< GC count required before the heap is allowed to expand due to excessvie time after last heap expansion */
 	uintptr_t heapContractionStabilizationCount; /**< GC count required before the heap is allowed to contract due to excessvie time after last heap expansion */
+	bool heapSizingCostModel; /**< Enabled by -Xgc:heapSizingCostModel.  Size the tenure space from allocation rate, live data and pause cost instead of free ratios */
+	uintptr_t heapSizingPauseTarget; /**< Global GC pause, in milliseconds, the cost model sizes the tenure space to stay under (-Xgc:heapSizingPauseTarget=), 0 for none */
+	uintptr_t heapSizingContainerPercent; /**< Percentage of the cgroup memory limit the heap may use under the cost model, if the embedder has enabled the cgroup memory subsystem (-Xgc:heapSizingContainerPercent=) */
 
 	float heapSizeStartupHintConservativeFactor; /**< Use only a fraction of hints stored in SC */
 	float heapSizeStartupHintWeightNewValue;		/**< Learn slowly by historic averaging of stored hints */
@@ -383,6 +398,9 @@ public:
 
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool workStealingMarking; /**< Enabled by -Xgc:workStealingMarking.  Distribute stop-the-world marking work through per-thread work stealing deques rather than only the shared packet lists */
+	bool vectorHeapMapScan; /**< Disabled by -Xgc:noVectorHeapMapScan.  Skip empty heap map slots with SSE4.2/AVX2 kernels when the processor supports them */
+	uintptr_t scanPrefetchDistance; /**< Set by -Xgc:scanPrefetchDistance=.  Number of objects (marking) or slots (scavenging) prefetched ahead of the one being scanned, 0 scans without prefetching */
 
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
@@ -475,9 +493,15 @@ public:
 	bool scvTenureStrategyAdaptive; /**< Flag for enabling the Adaptive scavenger tenure strategy. */
 	bool scvTenureStrategyLookback; /**< Flag for enabling the Lookback scavenger tenure strategy. */
 	bool scvTenureStrategyHistory; /**< Flag for enabling the History scavenger tenure strategy. */
+	bool scvTenureStrategyPredictive; /**< Flag for enabling the Predictive scavenger tenure strategy (-Xgc:scvTenureStrategyPredictive), which replaces the other strategies once there is enough survival history. */
+	uintptr_t scvTenurePredictorHorizon; /**< Number of scavenges the Predictive tenure strategy projects the survivor space over. */
+	uintptr_t scvTenurePredictorPromotionCost; /**< Cost of promoting a byte relative to copying it once, for the Predictive tenure strategy. */
 	bool scavengerEnabled;
 	bool scavengerRsoScanUnsafe;
 	uintptr_t cacheListSplit; /**< the number of ways to split scanCache lists, set by -XXgc:cacheListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool scavengerNumaAffinity; /**< Enabled by -Xgc:scavengerNumaAffinity.  Stripe the heap across NUMA nodes and have each scavenger thread copy into, and prefer to scan, memory on its own node */
+	uintptr_t rememberedSetPuddleBatch; /**< Set by -Xgc:rememberedSetPuddleBatch=<n>.  Number of remembered set puddles created each time a fragment refill finds the remembered set full */
+	uintptr_t rememberedSetMaxFragmentSize; /**< Set by -Xgc:rememberedSetMaxFragmentSize=<bytes>.  Size a thread's remembered set fragment doubles up to as it keeps refilling within a cycle, rounded down to whole slots and at least OMR_SCV_REMSET_FRAGMENT_SIZE. 0 (the default) keeps fragments at their initial size */
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	bool softwareRangeCheckReadBarrier; /**< enable software read barrier instead of hardware guarded loads when running with CS */
 	bool concurrentScavenger; /**< CS enabled/disabled flag */
@@ -558,6 +582,8 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	uintptr_t incrementalCompactBudget; /**< Live bytes a fragmentation triggered compaction may move, or 0 to always compact the entire heap (-Xgc:incrementalCompactBudget=) */
+	uintptr_t incrementalCompactMaxRanges; /**< Maximum number of sweep chunks an incremental compaction selects (-Xgc:incrementalCompactRanges=) */
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	bool payAllocationTax;
@@ -573,6 +599,7 @@ public:
 	uintptr_t concurrentSlack; /**< number of bytes to add to the concurrent kickoff threshold buffer */
 	uintptr_t cardCleanPass2Boost;
 	uintptr_t cardCleaningPasses;
+	bool dirtyCardSummary; /**< Enabled by -Xgc:dirtyCardSummary.  Summarize dirty cards so final card cleaning can skip clean ranges; all card stores must go through MM_CardTable */
 
 	UDATA fvtest_concurrentCardTablePreparationDelay; /**< Delay for concurrent card table preparation in milliseconds */
 
@@ -651,6 +678,8 @@ public:
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	MM_SizeClasses* defaultSizeClasses;
+	bool lazySweepSegregated; /**< Enabled by -Xgc:lazySweepSegregated.  Leave small regions unswept at the end of a segregated collection and let allocating threads sweep them on demand */
+	uintptr_t regionListShardCount; /**< Set by -Xgc:regionListShards=<n>.  Number of independently locked shards of the shared single region queues and free list, 0 or 1 for the plain locking lists */
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 #if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
@@ -687,6 +716,8 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool binaryLogging; /**< Enabled by -Xgc:binaryLogging.  Record verbose:gc file output as binary events, written out by a background thread */
+	uintptr_t binaryLoggingBufferSize; /**< Size of the ring binary verbose:gc events are staged in (-Xgc:binaryLoggingBufferSize=) */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -1405,6 +1436,10 @@ public:
 #endif /* OMR_GC_DOUBLE_MAP_ARRAYLETS */
 		, requestedPageSize(0)
 		, requestedPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
+		, mixedPageSizeHeap(false)
+		, backgroundDecommit(false)
+		, backgroundDecommitCPUPercent(10)
+		, memoryMaintenanceThread(NULL)
 		, gcmetadataPageSize(0)
 		, gcmetadataPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -1431,6 +1466,9 @@ public:
 		, frequentObjectAllocationSamplingRate(100)
 		, frequentObjectsStats(NULL)
 		, frequentObjectAllocationSamplingDepth(0)
+		, allocationSampling(false)
+		, allocationSamplingInterval(2 * 1024 * 1024) /* a sample costs ~10us, mostly unwinding: 0.5% at 1GB/s per thread */
+		, allocationSampler(NULL)
 		, estimateFragmentation(GLOBALGC_ESTIMATE_FRAGMENTATION)
 		, processLargeAllocateStats(true) /* turn on processLargeAllocateStats by default */
 		, largeObjectAllocationProfilingThreshold(512)
@@ -1454,6 +1492,8 @@ public:
 		, tlhIncrementSize(4096)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
+		, tlhAdaptiveSizing(false)
+		, tlhAdaptiveWasteTarget(5)
 		, allocationStats()
 		, bytesAllocatedMost(0)
 		, vmThreadAllocatedMost(NULL)
@@ -1461,6 +1501,7 @@ public:
 		, splitFreeListSplitAmount(0)
 		, splitFreeListNumberChunksPrepared(0)
 		, enableHybridMemoryPool(false)
+		, freeListSizeClassIndex(false)
 		, largeObjectArea(false)
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
 		, largeObjectMinimumSize(64 * 1024)
@@ -1490,11 +1531,17 @@ public:
 		, heapContractionGCTimeThreshold(5)
 		, heapExpansionStabilizationCount(0)
 		, heapContractionStabilizationCount(3)
+		, heapSizingCostModel(false)
+		, heapSizingPauseTarget(0)
+		, heapSizingContainerPercent(75)
 		, heapSizeStartupHintConservativeFactor((float)0.7)
 		, heapSizeStartupHintWeightNewValue((float)0.8)
 		, useGCStartupHints(true)
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
 		, packetListSplit(0)
+		, workStealingMarking(false)
+		, vectorHeapMapScan(true)
+		, scanPrefetchDistance(0)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
 		, rootScannerStatsEnabled(false)
@@ -1570,9 +1617,15 @@ public:
 		, scvTenureStrategyAdaptive(true)
 		, scvTenureStrategyLookback(true)
 		, scvTenureStrategyHistory(true)
+		, scvTenureStrategyPredictive(false)
+		, scvTenurePredictorHorizon(16)
+		, scvTenurePredictorPromotionCost(4)
 		, scavengerEnabled(false)
 		, scavengerRsoScanUnsafe(false)
 		, cacheListSplit(0)
+		, scavengerNumaAffinity(false)
+		, rememberedSetPuddleBatch(1)
+		, rememberedSetMaxFragmentSize(0)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, softwareRangeCheckReadBarrier(false)
 		, concurrentScavenger(false)
@@ -1638,6 +1691,8 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, incrementalCompactBudget(0)
+		, incrementalCompactMaxRanges(64)
 #endif /* OMR_GC_MODRON_COMPACTION */
 		, payAllocationTax(false)
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -1651,6 +1706,7 @@ public:
 		, concurrentSlack(0)
 		, cardCleanPass2Boost(2)
 		, cardCleaningPasses(2)
+		, dirtyCardSummary(false)
 		, fvtest_concurrentCardTablePreparationDelay(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailure(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailureCounter(0)
@@ -1708,6 +1764,8 @@ public:
 #endif /* defined(OMR_GC_REALTIME) || defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		, defaultSizeClasses(NULL)
+		, lazySweepSegregated(false)
+		, regionListShardCount(0)
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
 		, heapRegionStateTable(NULL)
@@ -1735,6 +1793,8 @@ public:
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, binaryLogging(false)
+		, binaryLoggingBufferSize(1024 * 1024)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
@@ -112,6 +112,20 @@ public:
 	 * Return the page flags describing the pages used for the heap memory.
 	 */
 	virtual uintptr_t getPageFlags() = 0;
+
+	/**
+	 * Report how a range of the heap is backed when the heap mixes page sizes (-Xgc:mixedPageSizeHeap).
+	 * The rest of the range is on pages of getPageSize().
+	 * @param[out] explicitBytes bytes of the range backed by explicit large pages
+	 * @param[out] transparentBytes bytes of the range eligible for transparent huge pages
+	 * @return the large page size, or 0 if the heap does not mix page sizes
+	 */
+	virtual uintptr_t getPageBacking(void *lowAddress, void *highAddress, uintptr_t *explicitBytes, uintptr_t *transparentBytes)
+	{
+		*explicitBytes = 0;
+		*transparentBytes = 0;
+		return 0;
+	}
 	
 	virtual void *getHeapBase() = 0;
 	virtual void *getHeapTop() = 0;
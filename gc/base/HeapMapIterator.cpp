@@ -24,6 +24,7 @@
 #include "Bits.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapMap.hpp"
+#include "HeapMapScanner.hpp"
 #include "Math.hpp"
 #include "ObjectModel.hpp"
 
@@ -123,16 +124,73 @@ MM_HeapMapIterator::nextObject()
 			return (nextObject < (omrobjectptr_t)_heapChunkTop ? nextObject : NULL);
 		}
 
-		/* The termination point may not be at the end of the map slot - adjust accordingly */
-		_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_BIT * (J9BITS_BITS_IN_SLOT - _bitIndexHead);
+		nextHeapMapSlot();
+	}
+
+	return (omrobjectptr_t)NULL;
+}
+
+uintptr_t
+MM_HeapMapIterator::nextObjects(omrobjectptr_t *objects, uintptr_t count)
+{
+	uintptr_t found = 0;
 
-		/* Move to the next mark map slot */
-		_heapMapSlotCurrent += 1;
-		_bitIndexHead = 0;
-		if(_heapSlotCurrent < _heapChunkTop) {
-			_heapMapSlotValue = *_heapMapSlotCurrent;
+	if (_useLargeObjectOptimization) {
+		omrobjectptr_t object = NULL;
+		while ((found < count) && (NULL != (object = nextObject()))) {
+			objects[found] = object;
+			found += 1;
 		}
+		return found;
 	}
 
-	return (omrobjectptr_t)NULL;
+	while ((found < count) && (_heapSlotCurrent < _heapChunkTop)) {
+		/* Every set bit of the cached slot is an object, so they are taken off one at a time, lowest first, without
+		 * shifting the slot value or touching the heap.  Bits already handed out are cleared, which leaves the cached
+		 * value valid for _heapSlotCurrent if the batch fills up in the middle of the slot.
+		 */
+		uintptr_t heapMapSlotValue = _heapMapSlotValue;
+		while ((J9MODRON_HMI_SLOT_EMPTY != heapMapSlotValue) && (found < count)) {
+			omrobjectptr_t object = (omrobjectptr_t)(_heapSlotCurrent + (J9MODRON_HEAP_SLOTS_PER_HEAPMAP_BIT * MM_Bits::leadingZeroes(heapMapSlotValue)));
+			if (object >= (omrobjectptr_t)_heapChunkTop) {
+				/* Ensure we don't return an object outside the defined range */
+				_heapSlotCurrent = _heapChunkTop;
+				return found;
+			}
+			objects[found] = object;
+			found += 1;
+			heapMapSlotValue &= heapMapSlotValue - 1;
+		}
+		_heapMapSlotValue = heapMapSlotValue;
+
+		if (J9MODRON_HMI_SLOT_EMPTY == heapMapSlotValue) {
+			nextHeapMapSlot();
+		}
+	}
+
+	return found;
+}
+
+void
+MM_HeapMapIterator::nextHeapMapSlot()
+{
+	/* The termination point may not be at the end of the map slot - adjust accordingly */
+	_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_BIT * (J9BITS_BITS_IN_SLOT - _bitIndexHead);
+
+	/* Move to the next mark map slot */
+	_heapMapSlotCurrent += 1;
+	_bitIndexHead = 0;
+	if(_heapSlotCurrent < _heapChunkTop) {
+		_heapMapSlotValue = *_heapMapSlotCurrent;
+		if (J9MODRON_HMI_SLOT_EMPTY == _heapMapSlotValue) {
+			/* Skip the whole empty run at once - the slot holding the (possibly unaligned) top is the last one to look at */
+			uintptr_t remainingMapSlots = MM_Math::roundToCeiling(J9MODRON_HMI_HEAPMAP_ALIGNMENT, (uintptr_t)_heapChunkTop - (uintptr_t)_heapSlotCurrent) / J9MODRON_HMI_HEAPMAP_ALIGNMENT;
+			uintptr_t *nonEmptySlot = MM_HeapMapScanner::findNonEmptySlot(_heapMapSlotCurrent + 1, _heapMapSlotCurrent + remainingMapSlots);
+			_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT * (nonEmptySlot - _heapMapSlotCurrent);
+			_heapMapSlotCurrent = nonEmptySlot;
+			if(_heapSlotCurrent < _heapChunkTop) {
+				_heapMapSlotValue = *_heapMapSlotCurrent;
+			}
+		}
+	}
 }
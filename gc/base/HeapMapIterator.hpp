@@ -55,9 +55,23 @@ private:
 	MM_GCExtensionsBase * const _extensions; /**< The GC extensions for the JVM */
 	bool _useLargeObjectOptimization;	/**< Set to true if we want to read objects from the heap and determine their size in order to skip mark map bits which are inside the object.  If this is set to false, we will blindly return the addresses representing the set bits in the mark map */
 
+	/**
+	 * Move to the next heap map slot, skipping any run of empty slots.
+	 */
+	void nextHeapMapSlot();
+
 public:
 	omrobjectptr_t nextObject();
 
+	/**
+	 * Fill a batch with the next objects, in address order.  Without the large object optimization the batch is
+	 * filled straight from the cached heap map slot, so no object in the heap is read.
+	 * @param[out] objects the batch to fill
+	 * @param[in] count the size of the batch
+	 * @return the number of objects found, less than count only once the chunk has been walked
+	 */
+	uintptr_t nextObjects(omrobjectptr_t *objects, uintptr_t count);
+
 	bool setHeapMap(MM_HeapMap *heapMap);
 
 	bool reset(MM_HeapMap *heapMap, uintptr_t *heapChunkBase, uintptr_t *heapChunkTop);
@@ -73,14 +87,14 @@ public:
 	 * @note heapMap, heapChunkBase and heapChunkTop are not specified, so reset()
 	 *  must be called explicitly by the caller of this constructor.
 	 */
-	MM_HeapMapIterator(MM_GCExtensionsBase *extensions)
+	MM_HeapMapIterator(MM_GCExtensionsBase *extensions, bool useLargeObjectOptimization = true)
 		: _heapSlotCurrent(NULL)
 		, _heapChunkTop(NULL)
 		, _heapMapSlotCurrent(NULL)
 		, _bitIndexHead(0)
 		, _heapMapSlotValue(0)
 		, _extensions(extensions)
-		, _useLargeObjectOptimization(true)
+		, _useLargeObjectOptimization(useLargeObjectOptimization)
 	{}
 
 };
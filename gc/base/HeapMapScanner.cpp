@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#include "HeapMapScanner.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+#if defined(J9HAMMER) && defined(__GNUC__)
+#define OMR_GC_HEAPMAP_SCAN_X86_KERNELS
+#include <immintrin.h>
+#endif /* defined(J9HAMMER) && defined(__GNUC__) */
+
+static uintptr_t *
+findNonEmptySlotScalar(uintptr_t *slot, uintptr_t *slotTop)
+{
+	while ((slot < slotTop) && (0 == *slot)) {
+		slot += 1;
+	}
+	return slot;
+}
+
+#if defined(OMR_GC_HEAPMAP_SCAN_X86_KERNELS)
+/* The vector loops only find the first non-empty step, the scalar loop then finds the slot within it */
+
+__attribute__((target("sse4.2")))
+static uintptr_t *
+findNonEmptySlotSSE42(uintptr_t *slot, uintptr_t *slotTop)
+{
+	const uintptr_t slotsPerStep = (2 * sizeof(__m128i)) / sizeof(uintptr_t);
+	while ((uintptr_t)(slotTop - slot) >= slotsPerStep) {
+		__m128i bits = _mm_or_si128(_mm_loadu_si128((__m128i *)slot), _mm_loadu_si128((__m128i *)slot + 1));
+		if (!_mm_testz_si128(bits, bits)) {
+			break;
+		}
+		slot += slotsPerStep;
+	}
+	return findNonEmptySlotScalar(slot, slotTop);
+}
+
+__attribute__((target("avx2")))
+static uintptr_t *
+findNonEmptySlotAVX2(uintptr_t *slot, uintptr_t *slotTop)
+{
+	const uintptr_t slotsPerStep = (2 * sizeof(__m256i)) / sizeof(uintptr_t);
+	while ((uintptr_t)(slotTop - slot) >= slotsPerStep) {
+		__m256i bits = _mm256_or_si256(_mm256_loadu_si256((__m256i *)slot), _mm256_loadu_si256((__m256i *)slot + 1));
+		if (!_mm256_testz_si256(bits, bits)) {
+			break;
+		}
+		slot += slotsPerStep;
+	}
+	return findNonEmptySlotScalar(slot, slotTop);
+}
+#endif /* defined(OMR_GC_HEAPMAP_SCAN_X86_KERNELS) */
+
+MM_HeapMapScanner::FindNonEmptySlotFunction MM_HeapMapScanner::_findNonEmptySlot = findNonEmptySlotScalar;
+const char *MM_HeapMapScanner::_kernelName = "scalar";
+
+void
+MM_HeapMapScanner::selectKernel(MM_EnvironmentBase *env)
+{
+	_findNonEmptySlot = findNonEmptySlotScalar;
+	_kernelName = "scalar";
+
+#if defined(OMR_GC_HEAPMAP_SCAN_X86_KERNELS)
+	if (env->getExtensions()->vectorHeapMapScan) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		OMRProcessorDesc desc;
+		if (0 == omrsysinfo_get_processor_description(&desc)) {
+			/* the OS must also save the AVX state (OSXSAVE) before the 256-bit registers can be used */
+			if (omrsysinfo_processor_has_feature(&desc, OMR_FEATURE_X86_AVX2) && omrsysinfo_processor_has_feature(&desc, OMR_FEATURE_X86_OSXSAVE)) {
+				_findNonEmptySlot = findNonEmptySlotAVX2;
+				_kernelName = "avx2";
+			} else if (omrsysinfo_processor_has_feature(&desc, OMR_FEATURE_X86_SSE4_2)) {
+				_findNonEmptySlot = findNonEmptySlotSSE42;
+				_kernelName = "sse4.2";
+			}
+		}
+	}
+#endif /* defined(OMR_GC_HEAPMAP_SCAN_X86_KERNELS) */
+}
@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(HEAPMAPSCANNER_HPP_)
+#define HEAPMAPSCANNER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+class MM_EnvironmentBase;
+
+/**
+ * Kernels which skip runs of empty heap map (mark map) slots.  Sparse regions of the mark map
+ * dominate sweep and compact, so the empty slots are tested several at a time: 256 bits per step
+ * with SSE4.2 and 512 bits per step with AVX2 on x86-64, one slot at a time otherwise.  The kernel
+ * is chosen once from the processor description (see selectKernel()).
+ * @ingroup GC_Base
+ */
+class MM_HeapMapScanner
+{
+	/*
+	 * Data members
+	 */
+public:
+	typedef uintptr_t *(*FindNonEmptySlotFunction)(uintptr_t *slot, uintptr_t *slotTop);
+
+private:
+	static FindNonEmptySlotFunction _findNonEmptySlot; /**< Kernel chosen by selectKernel() */
+	static const char *_kernelName; /**< Name of the chosen kernel, for verbose output */
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Choose the fastest kernel the processor supports, or the scalar one if vector scanning
+	 * is disabled (-Xgc:noVectorHeapMapScan).
+	 */
+	static void selectKernel(MM_EnvironmentBase *env);
+
+	/**
+	 * @return the name of the kernel in use ("scalar", "sse4.2" or "avx2")
+	 */
+	static const char *getKernelName() { return _kernelName; }
+
+	/**
+	 * Find the first non-empty heap map slot in [slot, slotTop).  The first slot is tested inline
+	 * since dense maps rarely have an empty run to skip.
+	 * @return the address of the first non-empty slot, or slotTop if all slots are empty
+	 */
+	MMINLINE static uintptr_t *
+	findNonEmptySlot(uintptr_t *slot, uintptr_t *slotTop)
+	{
+		if ((slot >= slotTop) || (0 != *slot)) {
+			return slot;
+		}
+		return _findNonEmptySlot(slot + 1, slotTop);
+	}
+};
+
+#endif /* HEAPMAPSCANNER_HPP_ */
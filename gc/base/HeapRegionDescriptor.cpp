@@ -43,6 +43,9 @@ MM_HeapRegionDescriptor::MM_HeapRegionDescriptor(MM_EnvironmentBase *env, void *
 	, _regionType(MM_HeapRegionDescriptor::RESERVED)
 	, _memoryPool(NULL)
 	, _numaNode(0)
+	, _pageSize(0)
+	, _explicitLargePageBytes(0)
+	, _transparentHugePageBytes(0)
 	, _regionProperties(MM_HeapRegionDescriptor::MANAGED)
 {
 	_typeId = __FUNCTION__;
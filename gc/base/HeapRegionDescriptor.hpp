@@ -99,6 +99,10 @@ private:
 	MM_MemoryPool *_memoryPool; /**< The memory pool associated with this region.  This may be NULL */
 
 	uintptr_t _numaNode; /**< The NUMA node this region is associated with */
+
+	uintptr_t _pageSize; /**< The page size backing the whole region, 0 until recorded */
+	uintptr_t _explicitLargePageBytes; /**< Bytes of the region backed by explicit large pages in a mixed page size heap */
+	uintptr_t _transparentHugePageBytes; /**< Bytes of the region eligible for transparent huge pages in a mixed page size heap */
 	
 	uint32_t _regionProperties; /**< A bitmap of the RegionProperties this region possesses */
 
@@ -260,6 +264,43 @@ public:
 	getNumaNode() {
 		return _numaNode;
 	}
+
+	/**
+	 * Record the pages backing the memory in the region
+	 * @param pageSize the page size backing the whole region
+	 * @param explicitLargePageBytes bytes backed by explicit large pages, smaller than the region if it mixes page sizes
+	 * @param transparentHugePageBytes bytes eligible for transparent huge pages
+	 */
+	void
+	setPageBacking(uintptr_t pageSize, uintptr_t explicitLargePageBytes, uintptr_t transparentHugePageBytes) {
+		_pageSize = pageSize;
+		_explicitLargePageBytes = explicitLargePageBytes;
+		_transparentHugePageBytes = transparentHugePageBytes;
+	}
+
+	/**
+	 * @return the page size backing the whole region, or 0 if it has not been recorded
+	 */
+	uintptr_t
+	getPageSize() {
+		return _pageSize;
+	}
+
+	/**
+	 * @return bytes of the region backed by explicit large pages
+	 */
+	uintptr_t
+	getExplicitLargePageBytes() {
+		return _explicitLargePageBytes;
+	}
+
+	/**
+	 * @return bytes of the region eligible for transparent huge pages
+	 */
+	uintptr_t
+	getTransparentHugePageBytes() {
+		return _transparentHugePageBytes;
+	}
 	
 	/**
 	 * @return true if the region is a type which can contain objects
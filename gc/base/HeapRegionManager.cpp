@@ -30,6 +30,8 @@
 #include "Bits.hpp"
 #include "Forge.hpp"
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
 #include "HeapRegionDescriptor.hpp"
 
 class MemorySubSpace;
@@ -162,6 +164,7 @@ MM_HeapRegionManager::internalCreateAuxiliaryRegionDescriptor(MM_EnvironmentBase
 	if (NULL != desc) {
 		desc->associateWithSubSpace(subSpace);
 		desc->setRegionType(MM_HeapRegionDescriptor::ADDRESS_ORDERED);
+		recordPageBacking(env, desc);
 		insertHeapRegion(env, desc);
 	}
 	return desc;
@@ -208,6 +211,23 @@ MM_HeapRegionManager::reassociateRegionWithSubSpace(MM_EnvironmentBase* env, MM_
 	writeUnlock();
 }
 
+void
+MM_HeapRegionManager::recordPageBacking(MM_EnvironmentBase* env, MM_HeapRegionDescriptor* region)
+{
+	MM_Heap* heap = env->getExtensions()->heap;
+	if (NULL != heap) {
+		uintptr_t explicitBytes = 0;
+		uintptr_t transparentBytes = 0;
+		uintptr_t largePageSize = heap->getPageBacking(region->getLowAddress(), region->getHighAddress(), &explicitBytes, &transparentBytes);
+		uintptr_t pageSize = heap->getPageSize();
+
+		if ((0 != largePageSize) && (explicitBytes == region->getSize())) {
+			pageSize = largePageSize;
+		}
+		region->setPageBacking(pageSize, explicitBytes, transparentBytes);
+	}
+}
+
 MM_HeapRegionDescriptor*
 MM_HeapRegionManager::getFirstTableRegion()
 {
@@ -310,6 +310,14 @@ public:
 	 */
 	void reassociateRegionWithSubSpace(MM_EnvironmentBase* env, MM_HeapRegionDescriptor* region, MM_MemorySubSpace* subSpace);
 
+	/**
+	 * Record the pages backing the memory of the region in its descriptor.  Called once the memory
+	 * of the region has been committed or the region has been resized.
+	 * @param[in] env The current thread
+	 * @param[in] region The region to record the page backing of
+	 */
+	void recordPageBacking(MM_EnvironmentBase* env, MM_HeapRegionDescriptor* region);
+
 
 	MM_HeapRegionDescriptor* auxillaryDescriptorForAddress(const void* address);
 	MMINLINE void resizeAuxillaryRegion(MM_EnvironmentBase* env, MM_HeapRegionDescriptor* region, void* lowAddress, void* highAddress)
@@ -318,6 +326,7 @@ public:
 		_totalHeapSize -= region->getSize();
 		region->reinitialize(env, lowAddress, highAddress);
 		_totalHeapSize += region->getSize();
+		recordPageBacking(env, region);
 		writeUnlock();
 	}
 
@@ -0,0 +1,194 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "HeapSizingCostModel.hpp"
+
+#include "Math.hpp"
+
+#define HEAP_SIZING_MB ((double)(1024 * 1024))
+
+void
+MM_HeapSizingCostModel::reset()
+{
+	_sampleCount = 0;
+	_allocationRate = 0.0;
+	_liveLive = 0.0;
+	_liveSpace = 0.0;
+	_spaceSpace = 0.0;
+	_livePause = 0.0;
+	_spacePause = 0.0;
+}
+
+void
+MM_HeapSizingCostModel::setTargets(uintptr_t gcTimeTarget, uint64_t pauseTargetMicros, uintptr_t granule)
+{
+	_gcTimeTarget = OMR_MAX(1, OMR_MIN(gcTimeTarget, 99));
+	_pauseTargetMicros = pauseTargetMicros;
+	_granule = OMR_MAX(granule, 1);
+}
+
+/**
+ * Solve the decayed least squares fit of pause = markCost * liveMB + sweepCost * spaceMB.
+ * When the samples cannot separate the two terms (the space size and the live data moved together)
+ * or one of them comes out negative, the pause is charged to the other term alone.
+ */
+void
+MM_HeapSizingCostModel::fitPause(double *markCost, double *sweepCost)
+{
+	double mark = 0.0;
+	double sweep = 0.0;
+	double determinant = (_liveLive * _spaceSpace) - (_liveSpace * _liveSpace);
+
+	if (determinant > (1.0e-6 * _liveLive * _spaceSpace)) {
+		mark = ((_livePause * _spaceSpace) - (_spacePause * _liveSpace)) / determinant;
+		sweep = ((_spacePause * _liveLive) - (_livePause * _liveSpace)) / determinant;
+		if (mark < 0.0) {
+			mark = 0.0;
+			sweep = _spacePause / _spaceSpace;
+		} else if (sweep < 0.0) {
+			sweep = 0.0;
+			mark = _livePause / _liveLive;
+		}
+	} else if (_liveLive > 0.0) {
+		mark = _livePause / _liveLive;
+	} else if (_spaceSpace > 0.0) {
+		sweep = _spacePause / _spaceSpace;
+	}
+
+	*markCost = mark;
+	*sweepCost = sweep;
+}
+
+bool
+MM_HeapSizingCostModel::decide(const MM_HeapSizingSample *sample, MM_HeapSizingStats *decision)
+{
+	decision->_sample = *sample;
+	decision->_limit = HEAP_SIZING_LIMIT_NONE;
+
+	if (0 != sample->intervalMicros) {
+		double rate = (double)sample->allocatedBytes / (double)sample->intervalMicros;
+		if (0 == _sampleCount) {
+			_allocationRate = rate;
+		} else {
+			_allocationRate = (rate * HEAP_SIZING_ALLOCATION_RATE_WEIGHT) + (_allocationRate * (1.0 - HEAP_SIZING_ALLOCATION_RATE_WEIGHT));
+		}
+		_sampleCount += 1;
+	}
+
+	if (0 == _sampleCount) {
+		return false;
+	}
+
+	double live = (double)sample->liveBytes;
+	double liveMB = live / HEAP_SIZING_MB;
+	double spaceMB = (double)sample->currentSize / HEAP_SIZING_MB;
+	double pause = (double)sample->pauseMicros;
+	_liveLive = (_liveLive * HEAP_SIZING_PAUSE_HISTORY_DECAY) + (liveMB * liveMB);
+	_liveSpace = (_liveSpace * HEAP_SIZING_PAUSE_HISTORY_DECAY) + (liveMB * spaceMB);
+	_spaceSpace = (_spaceSpace * HEAP_SIZING_PAUSE_HISTORY_DECAY) + (spaceMB * spaceMB);
+	_livePause = (_livePause * HEAP_SIZING_PAUSE_HISTORY_DECAY) + (liveMB * pause);
+	_spacePause = (_spacePause * HEAP_SIZING_PAUSE_HISTORY_DECAY) + (spaceMB * pause);
+
+	double markCost = 0.0;
+	double sweepCost = 0.0;
+	fitPause(&markCost, &sweepCost);
+	double markPerByte = markCost / HEAP_SIZING_MB;
+	double sweepPerByte = sweepCost / HEAP_SIZING_MB;
+
+	uintptr_t ceilingSize = sample->maximumSize;
+	HeapSizingLimit ceilingLimit = HEAP_SIZING_LIMIT_MAXIMUM;
+	if ((0 != sample->containerBudget) && (sample->containerBudget < ceilingSize)) {
+		ceilingSize = sample->containerBudget;
+		ceilingLimit = HEAP_SIZING_LIMIT_CONTAINER;
+	}
+
+	/* free bytes needed per microsecond of pause to keep GC at the time target */
+	double gcTimeTarget = (double)_gcTimeTarget / 100.0;
+	double freePerPauseMicro = _allocationRate * (1.0 - gcTimeTarget) / gcTimeTarget;
+
+	/* size = live + freePerPauseMicro * (markPerByte * live + sweepPerByte * size) */
+	double target = 0.0;
+	HeapSizingLimit limit = HEAP_SIZING_LIMIT_COST;
+	double denominator = 1.0 - (freePerPauseMicro * sweepPerByte);
+	if (denominator <= 0.0) {
+		/* sweeping a larger space costs more than the extra free space saves: no size meets the target */
+		target = (double)ceilingSize;
+		limit = ceilingLimit;
+	} else {
+		target = (live + (freePerPauseMicro * markPerByte * live)) / denominator;
+	}
+
+	if ((0 != _pauseTargetMicros) && (sweepPerByte > 0.0)) {
+		double pauseTargetSize = ((double)_pauseTargetMicros - (markPerByte * live)) / sweepPerByte;
+		if (pauseTargetSize < target) {
+			target = pauseTargetSize;
+			limit = HEAP_SIZING_LIMIT_PAUSE;
+		}
+	}
+
+	double floorSize = live + ((live * HEAP_SIZING_MINIMUM_HEADROOM_PERCENT) / 100.0) + (double)sample->bytesRequired;
+	floorSize = OMR_MAX(floorSize, (double)sample->minimumSize);
+	if (target < floorSize) {
+		target = floorSize;
+		limit = HEAP_SIZING_LIMIT_MINIMUM;
+	}
+	if (target >= (double)ceilingSize) {
+		target = (double)ceilingSize;
+		limit = ceilingLimit;
+	}
+
+	uintptr_t targetSize = MM_Math::roundToCeiling(_granule, (uintptr_t)target);
+	if (HEAP_SIZING_LIMIT_PAUSE == limit) {
+		/* rounding up would take the pause past the target */
+		targetSize = OMR_MAX(MM_Math::roundToFloor(_granule, (uintptr_t)target), MM_Math::roundToCeiling(_granule, (uintptr_t)floorSize));
+	}
+	if (targetSize > ceilingSize) {
+		targetSize = MM_Math::roundToFloor(_granule, ceilingSize);
+	}
+
+	decision->_allocationRate = (uint64_t)(_allocationRate * 1000000.0);
+	decision->_markMicrosPerMB = (uint64_t)markCost;
+	decision->_sweepMicrosPerMB = (uint64_t)sweepCost;
+	decision->_predictedPauseMicros = (uint64_t)((markPerByte * live) + (sweepPerByte * (double)targetSize));
+	decision->_targetSize = targetSize;
+	decision->_limit = limit;
+	return true;
+}
+
+const char *
+MM_HeapSizingCostModel::getLimitAsString(HeapSizingLimit limit)
+{
+	switch (limit) {
+	case HEAP_SIZING_LIMIT_COST:
+		return "cost";
+	case HEAP_SIZING_LIMIT_PAUSE:
+		return "pause";
+	case HEAP_SIZING_LIMIT_MINIMUM:
+		return "minimum";
+	case HEAP_SIZING_LIMIT_MAXIMUM:
+		return "maximum";
+	case HEAP_SIZING_LIMIT_CONTAINER:
+		return "container";
+	default:
+		return "none";
+	}
+}
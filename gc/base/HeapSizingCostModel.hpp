@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(HEAPSIZINGCOSTMODEL_HPP_)
+#define HEAPSIZINGCOSTMODEL_HPP_
+
+#include "omrcomp.h"
+
+#include "HeapSizingStats.hpp"
+
+#define HEAP_SIZING_ALLOCATION_RATE_WEIGHT 0.5 /**< weight of the newest interval in the smoothed allocation rate */
+#define HEAP_SIZING_PAUSE_HISTORY_DECAY 0.8 /**< weight kept by older pauses each time a pause is added to the pause model */
+#define HEAP_SIZING_MINIMUM_HEADROOM_PERCENT 10 /**< free space always left above the live data, as a percentage of it */
+
+/**
+ * Chooses the size of a space from the cost of collecting it, rather than from free space ratios.
+ *
+ * Between two global collections the application uses allocatedBytes of the space in intervalMicros,
+ * so with F bytes free a collection comes every F / rate. With a pause of P, GC takes
+ * P / (P + F / rate) of the time; keeping this at the GC time target T needs F = rate * P * (1 - T) / T.
+ * The pause is modelled as mark * live + sweep * size, fitted by least squares over recent
+ * collections, which makes the free space needed grow with the size, and lets a pause target cap it.
+ * The result is bounded by the live data plus headroom, the space limits and the container budget.
+ *
+ * The model only sees MM_HeapSizingSample, so the decisions reported to verbose GC can be replayed
+ * offline (see fvtest/gctest/TestHeapSizingReplay.cpp).
+ */
+class MM_HeapSizingCostModel
+{
+	/*
+	 * Data members
+	 */
+private:
+	uintptr_t _gcTimeTarget; /**< percentage of time GC may take */
+	uint64_t _pauseTargetMicros; /**< pause the target size must not exceed, 0 for none */
+	uintptr_t _granule; /**< target sizes are multiples of this */
+	uintptr_t _sampleCount; /**< samples given to decide() since the last reset() */
+	double _allocationRate; /**< smoothed allocation rate, bytes per microsecond */
+	/* decayed sums of the pause regression, sizes in MB and pauses in microseconds */
+	double _liveLive;
+	double _liveSpace;
+	double _spaceSpace;
+	double _livePause;
+	double _spacePause;
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	void fitPause(double *markCost, double *sweepCost);
+protected:
+public:
+	/**
+	 * Forget every sample seen so far.
+	 */
+	void reset();
+
+	/**
+	 * @param gcTimeTarget percentage of time GC may take (1 to 99)
+	 * @param pauseTargetMicros pause the target size must not exceed, 0 for none
+	 * @param granule target sizes are rounded to multiples of this
+	 */
+	void setTargets(uintptr_t gcTimeTarget, uint64_t pauseTargetMicros, uintptr_t granule);
+
+	/**
+	 * Add the sample to the model and choose a target size for the space.
+	 * @param[in] sample inputs taken at this global collection
+	 * @param[out] decision filled with the target and the values it was derived from
+	 * @return false if no allocation rate is known yet, and decision->_targetSize is not set
+	 */
+	bool decide(const MM_HeapSizingSample *sample, MM_HeapSizingStats *decision);
+
+	static const char *getLimitAsString(HeapSizingLimit limit);
+
+	MM_HeapSizingCostModel()
+		: _gcTimeTarget(0)
+		, _pauseTargetMicros(0)
+		, _granule(1)
+	{
+		reset();
+	}
+};
+
+#endif /* HEAPSIZINGCOSTMODEL_HPP_ */
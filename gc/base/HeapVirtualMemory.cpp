@@ -30,6 +30,7 @@
 #include "GlobalCollector.hpp"
 #include "HeapRegionManager.hpp"
 #include "Math.hpp"
+#include "MemoryMaintenanceThread.hpp"
 #include "MemoryManager.hpp"
 #include "MemorySubSpace.hpp"
 #include "PhysicalArena.hpp"
@@ -204,6 +205,13 @@ MM_HeapVirtualMemory::getPageFlags()
 	return memoryManager->getPageFlags(&_vmemHandle);
 }
 
+uintptr_t
+MM_HeapVirtualMemory::getPageBacking(void* lowAddress, void* highAddress, uintptr_t* explicitBytes, uintptr_t* transparentBytes)
+{
+	MM_MemoryManager* memoryManager = MM_GCExtensionsBase::getExtensions(_omrVM)->memoryManager;
+	return memoryManager->getPageBacking(&_vmemHandle, lowAddress, highAddress, explicitBytes, transparentBytes);
+}
+
 /**
  * Answer the largest size the heap will ever consume.
  * The value returned represents the difference between the lowest and highest possible address range
@@ -320,6 +328,11 @@ MM_HeapVirtualMemory::commitMemory(void* address, uintptr_t size)
 	MM_GCExtensionsBase* extensions = MM_GCExtensionsBase::getExtensions(_omrVM);
 	MM_MemoryManager* memoryManager = extensions->memoryManager;
 
+	if (NULL != extensions->memoryMaintenanceThread) {
+		/* the range may still be waiting to be decommitted from an earlier contraction */
+		extensions->memoryMaintenanceThread->cancelDecommit(address, size);
+	}
+
 	bool resultCommitMemory = memoryManager->commitMemory(&_vmemHandle, address, size);
 
 	if (resultCommitMemory && extensions->pretouchHeapOnExpand) {
@@ -54,6 +54,7 @@ public:
 
 	virtual uintptr_t getPageSize();
 	virtual uintptr_t getPageFlags();
+	virtual uintptr_t getPageBacking(void* lowAddress, void* highAddress, uintptr_t* explicitBytes, uintptr_t* transparentBytes);
 	virtual void* getHeapBase();
 	virtual void* getHeapTop();
 #if defined(OMR_GC_DOUBLE_MAP_ARRAYLETS)
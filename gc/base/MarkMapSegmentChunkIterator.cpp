@@ -45,10 +45,15 @@ GC_MarkMapSegmentChunkIterator::nextChunk(MM_HeapMap *markMap, UDATA **base, UDA
 		/* If that is the case, we move on to the next chunk */
 		_markedObjectIterator.reset(markMap, _nextChunkBase, chunkTop);
 		omrobjectptr_t firstObject = _markedObjectIterator.nextObject();
+		bool isFirstChunk = (_segmentBase == _nextChunkBase);
 
 		_nextChunkBase = chunkTop;
 
-		if (firstObject != NULL) {
+		if (isFirstChunk) {
+			*base = _segmentBase;
+			*top = chunkTop;
+			return true;
+		} else if (firstObject != NULL) {
 			*base = (UDATA *)firstObject;
 			*top = chunkTop;
 			if (_extensions->isVLHGC()) {
@@ -51,6 +51,7 @@ private:
 	UDATA _segmentBytesRemaining;
 	MM_HeapMapIterator _markedObjectIterator;
 	UDATA *_nextChunkBase;
+	UDATA * const _segmentBase;
 
 public:
 	void *operator new(size_t size, void *memoryPtr) { return memoryPtr; };
@@ -60,12 +61,14 @@ public:
 		_chunkSize(chunkSize),
 		_segmentBytesRemaining((UDATA)highAddress - (UDATA)lowAddress),
 		_markedObjectIterator(extensions),
-		_nextChunkBase((UDATA *)lowAddress)
+		_nextChunkBase((UDATA *)lowAddress),
+		_segmentBase((UDATA *)lowAddress)
 	{};
 
 	/**
 	 * @note Any chunk returned from this method must have either an object or a free header beginning at
-	 * the first slot in the chunk. 
+	 * the first slot in the chunk. The first chunk always starts at the segment base, so that unmarked
+	 * objects ahead of the first marked one are covered as well.
 	 * 
 	 * @param markMap[in] The mark map to use when finding the next chunk
 	 * @param base (OUT parameter) a pointer to the base of the next chunk will be stored into this address
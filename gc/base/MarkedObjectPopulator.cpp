@@ -50,6 +50,7 @@ MM_MarkedObjectPopulator::populateObjectHeapBufferedIteratorCache(omrobjectptr_t
 	uintptr_t *startPtr = (uintptr_t*) state->data1;
 	uintptr_t *endPtr = (uintptr_t*) state->data2;
 	Assert_MM_true(false == state->skipFirstObject);
+	Assert_MM_true(0 < count);
 	
 	if (NULL != startPtr) {
 		MM_HeapMap *markMap = state->extensions->previousMarkMap;
@@ -57,24 +58,14 @@ MM_MarkedObjectPopulator::populateObjectHeapBufferedIteratorCache(omrobjectptr_t
 		
 		/* TODO: what to do if we've been asked to include dead objects? There's no obvious way to include them. Perhaps it doesn't matter? Or we can infer them? */
 		MM_HeapMapIterator iterator(state->extensions, markMap, startPtr, endPtr, false);
+		size = iterator.nextObjects(cache, count);
 
-		omrobjectptr_t object = NULL;
-		
-		for (uintptr_t i = 0; i < count; i++) {
-			object = iterator.nextObject();
-			if (NULL == object) {
-				break;
-			}
-
-			cache[i] = object;
-			size++;
-		}
-
-		if (NULL == object) {
-			/* set startPtr to NULL */
+		if (size < count) {
+			/* a short batch means the range is exhausted; set startPtr to NULL */
 			state->data1 = 0;
 		} else {
 			/* set startPtr to just past the last object seen */
+			omrobjectptr_t object = cache[size - 1];
 #if defined(OMR_GC_MINIMUM_OBJECT_SIZE)
 			state->data1 = ((uintptr_t)object) + OMR_MINIMUM_OBJECT_SIZE;
 #else /* OMR_GC_MINIMUM_OBJECT_SIZE */
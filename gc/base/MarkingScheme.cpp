@@ -46,6 +46,7 @@
 #else
 #include "WorkPacketsStandard.hpp"
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#include "WorkPacketsStealing.hpp"
 
 /**
  * Allocate and initialize a new instance of the receiver.
@@ -321,15 +322,69 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 void
 MM_MarkingScheme::completeScan(MM_EnvironmentBase *env)
 {
+	uintptr_t prefetchDistance = _extensions->scanPrefetchDistance;
 	do {
-		omrobjectptr_t objectPtr = NULL;
-		while (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
-			env->_markStats._bytesScanned += scanObject(env, objectPtr);
-			env->_markStats._objectsScanned += 1;
+		if (0 != prefetchDistance) {
+			completeScanWithPrefetch(env, prefetchDistance);
+		} else {
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
+				env->_markStats._bytesScanned += scanObject(env, objectPtr);
+				env->_markStats._objectsScanned += 1;
+			}
 		}
 	} while (_workPackets->handleWorkPacketOverflow(env));
 }
 
+/**
+ * Pipelined form of the completeScan() loop.  Each object popped from the work stack is prefetched
+ * and parked in a small FIFO; it is scanned once prefetchDistance younger objects have been popped,
+ * by which time its header and slots should have arrived in cache.  Only the non-blocking pop is
+ * used while the FIFO holds objects, so a thread never joins the termination protocol of the work
+ * packets with unscanned objects in hand.
+ */
+void
+MM_MarkingScheme::completeScanWithPrefetch(MM_EnvironmentBase *env, uintptr_t prefetchDistance)
+{
+	omrobjectptr_t pending[MM_SCAN_PREFETCH_DISTANCE_MAX];
+	uintptr_t head = 0;
+	uintptr_t count = 0;
+
+	while (true) {
+		omrobjectptr_t objectPtr = (omrobjectptr_t)env->_workStack.popNoWait(env);
+		if (NULL == objectPtr) {
+			if (0 == count) {
+				/* FIFO is empty, safe to wait for work or for the scan to complete */
+				objectPtr = (omrobjectptr_t)env->_workStack.pop(env);
+				if (NULL == objectPtr) {
+					break;
+				}
+			} else {
+				/* no more work at hand, scan the oldest pending object; it may push more */
+				objectPtr = pending[head];
+				head = (head + 1) % prefetchDistance;
+				count -= 1;
+				env->_markStats._bytesScanned += scanObject(env, objectPtr);
+				env->_markStats._objectsScanned += 1;
+				continue;
+			}
+		}
+
+		MM_PREFETCH_FOR_READ(objectPtr);
+		if (count < prefetchDistance) {
+			pending[(head + count) % prefetchDistance] = objectPtr;
+			count += 1;
+		} else {
+			/* FIFO is full, the newest object takes the place of the oldest, which is scanned now */
+			omrobjectptr_t oldestPtr = pending[head];
+			pending[head] = objectPtr;
+			head = (head + 1) % prefetchDistance;
+			env->_markStats._bytesScanned += scanObject(env, oldestPtr);
+			env->_markStats._objectsScanned += 1;
+		}
+	}
+}
+
 /****************************************
  * Marking Core Functionality
  ****************************************/
@@ -403,6 +458,8 @@ MM_MarkingScheme::createWorkPackets(MM_EnvironmentBase *env)
 			workPackets = MM_WorkPacketsConcurrent::newInstance(env);
 #endif /* defined OMR_GC_MODRON_CONCURRENT_MARK */
 		}
+	} else if (_extensions->workStealingMarking) {
+		workPackets = MM_WorkPacketsStealing::newInstance(env);
 	} else {
 		workPackets = MM_WorkPacketsStandard::newInstance(env);
 	}
@@ -76,6 +76,12 @@ private:
 	 */
 	MMINLINE uintptr_t scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
 
+	/**
+	 * Private internal. Called exclusively from completeScan() when -Xgc:scanPrefetchDistance= is set;
+	 * scans objects prefetchDistance pops after prefetching them.
+	 */
+	void completeScanWithPrefetch(MM_EnvironmentBase *env, uintptr_t prefetchDistance);
+
 	MM_WorkPackets *createWorkPackets(MM_EnvironmentBase *env);
 
 protected:
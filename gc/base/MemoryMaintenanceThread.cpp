@@ -0,0 +1,326 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrport.h"
+#include "omrutil.h"
+
+#include "MemoryMaintenanceThread.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "Math.hpp"
+
+#include <string.h>
+
+MM_MemoryMaintenanceThread *
+MM_MemoryMaintenanceThread::newInstance(MM_EnvironmentBase *env)
+{
+	MM_MemoryMaintenanceThread *maintenanceThread = (MM_MemoryMaintenanceThread *)env->getForge()->allocate(sizeof(MM_MemoryMaintenanceThread), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != maintenanceThread) {
+		new(maintenanceThread) MM_MemoryMaintenanceThread(env);
+		if (!maintenanceThread->initialize(env)) {
+			maintenanceThread->kill(env);
+			maintenanceThread = NULL;
+		}
+	}
+	return maintenanceThread;
+}
+
+MM_MemoryMaintenanceThread::MM_MemoryMaintenanceThread(MM_EnvironmentBase *env)
+	: MM_BaseNonVirtual()
+	, _extensions(env->getExtensions())
+	, _monitor(NULL)
+	, _threadState(MAINTENANCE_THREAD_NONE)
+	, _sliceBase(0)
+	, _sliceTop(0)
+	, _cpuPercent(env->getExtensions()->backgroundDecommitCPUPercent)
+	, _deferredBytes(0)
+	, _releasedBytes(0)
+	, _reclaimedBytes(0)
+	, _backgroundTime(0)
+{
+	_typeId = __FUNCTION__;
+	memset(_pending, 0, sizeof(_pending));
+}
+
+bool
+MM_MemoryMaintenanceThread::initialize(MM_EnvironmentBase *env)
+{
+	return 0 == omrthread_monitor_init_with_name(&_monitor, 0, "MM_MemoryMaintenanceThread::_monitor");
+}
+
+void
+MM_MemoryMaintenanceThread::tearDown(MM_EnvironmentBase *env)
+{
+	shutdown();
+	if (NULL != _monitor) {
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+}
+
+void
+MM_MemoryMaintenanceThread::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_MemoryMaintenanceThread::startup(MM_EnvironmentBase *env)
+{
+	bool success = false;
+
+	/* hold the monitor over start-up so the thread cannot report its state before we wait for it */
+	omrthread_monitor_enter(_monitor);
+	_threadState = MAINTENANCE_THREAD_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_NORMAL,
+		0,
+		threadEntryPoint,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (MAINTENANCE_THREAD_STARTING == _threadState) {
+			omrthread_monitor_wait(_monitor);
+		}
+		success = (MAINTENANCE_THREAD_RUNNING == _threadState);
+	} else {
+		_threadState = MAINTENANCE_THREAD_NONE;
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return success;
+}
+
+void
+MM_MemoryMaintenanceThread::shutdown()
+{
+	if (NULL != _monitor) {
+		omrthread_monitor_enter(_monitor);
+		if (MAINTENANCE_THREAD_RUNNING == _threadState) {
+			_threadState = MAINTENANCE_THREAD_TERMINATION_REQUESTED;
+			omrthread_monitor_notify_all(_monitor);
+			while (MAINTENANCE_THREAD_TERMINATED != _threadState) {
+				omrthread_monitor_wait(_monitor);
+			}
+		}
+		_threadState = MAINTENANCE_THREAD_NONE;
+		omrthread_monitor_exit(_monitor);
+	}
+}
+
+bool
+MM_MemoryMaintenanceThread::deferDecommit(MM_EnvironmentBase *env, MM_Heap *heap, void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress)
+{
+	bool deferred = false;
+
+	if (0 != size) {
+		omrthread_monitor_enter(_monitor);
+		if (MAINTENANCE_THREAD_RUNNING == _threadState) {
+			PendingRange *range = findFreeRange();
+			if (NULL != range) {
+				range->heap = heap;
+				range->base = (uintptr_t)address;
+				range->top = (uintptr_t)address + size;
+				range->lowValidAddress = lowValidAddress;
+				range->highValidAddress = highValidAddress;
+				_deferredBytes += size;
+				omrthread_monitor_notify_all(_monitor);
+				deferred = true;
+			}
+		}
+		omrthread_monitor_exit(_monitor);
+	}
+
+	return deferred;
+}
+
+void
+MM_MemoryMaintenanceThread::cancelDecommit(void *address, uintptr_t size)
+{
+	uintptr_t base = (uintptr_t)address;
+	uintptr_t top = base + size;
+
+	omrthread_monitor_enter(_monitor);
+	/* the slice being decommitted is off the pending list already, let the thread finish it before the caller commits over it */
+	while ((_sliceBase < top) && (base < _sliceTop)) {
+		omrthread_monitor_wait(_monitor);
+	}
+
+	for (uintptr_t i = 0; i < MEMORY_MAINTENANCE_MAX_RANGES; i++) {
+		PendingRange *range = &_pending[i];
+		if ((NULL == range->heap) || (range->top <= base) || (top <= range->base)) {
+			continue;
+		}
+
+		_reclaimedBytes += OMR_MIN(range->top, top) - OMR_MAX(range->base, base);
+		if (top < range->top) {
+			/* the part above the committed range is still to be decommitted, it now has valid memory below it */
+			PendingRange *above = range;
+			if (range->base < base) {
+				above = findFreeRange();
+			}
+			if (NULL == above) {
+				/* no entry to split into, the part above simply stays committed */
+				_reclaimedBytes += range->top - top;
+			} else {
+				above->heap = range->heap;
+				above->base = top;
+				above->top = range->top;
+				above->lowValidAddress = (void *)top;
+				above->highValidAddress = range->highValidAddress;
+			}
+		}
+		if (range->base < base) {
+			range->top = base;
+			range->highValidAddress = (void *)base;
+		} else if (top >= range->top) {
+			range->heap = NULL;
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+void
+MM_MemoryMaintenanceThread::getStats(uint64_t *deferredBytes, uint64_t *releasedBytes, uint64_t *reclaimedBytes, uint64_t *pendingBytes, uint64_t *backgroundTime)
+{
+	omrthread_monitor_enter(_monitor);
+	*deferredBytes = _deferredBytes;
+	*releasedBytes = _releasedBytes;
+	*reclaimedBytes = _reclaimedBytes;
+	*backgroundTime = _backgroundTime;
+	*pendingBytes = _sliceTop - _sliceBase;
+	for (uintptr_t i = 0; i < MEMORY_MAINTENANCE_MAX_RANGES; i++) {
+		if (NULL != _pending[i].heap) {
+			*pendingBytes += _pending[i].top - _pending[i].base;
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+int J9THREAD_PROC
+MM_MemoryMaintenanceThread::threadEntryPoint(void *maintenanceThread)
+{
+	((MM_MemoryMaintenanceThread *)maintenanceThread)->threadLoop();
+	return 0;
+}
+
+void
+MM_MemoryMaintenanceThread::threadLoop()
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+
+	omrthread_monitor_enter(_monitor);
+	_threadState = MAINTENANCE_THREAD_RUNNING;
+	omrthread_monitor_notify_all(_monitor);
+
+	while (MAINTENANCE_THREAD_TERMINATION_REQUESTED != _threadState) {
+		PendingRange *range = NULL;
+		for (uintptr_t i = 0; (NULL == range) && (i < MEMORY_MAINTENANCE_MAX_RANGES); i++) {
+			if (NULL != _pending[i].heap) {
+				range = &_pending[i];
+			}
+		}
+
+		if (NULL == range) {
+			omrthread_monitor_wait(_monitor);
+		} else {
+			uint64_t sliceTime = decommitSlice(range);
+			if (_cpuPercent < 100) {
+				/* stay idle long enough that the slice was only _cpuPercent of the time since it started */
+				int64_t idleUntil = omrtime_nano_time() + (int64_t)(sliceTime * (100 - _cpuPercent) / _cpuPercent);
+				int64_t idleTime = idleUntil - omrtime_nano_time();
+				while ((MAINTENANCE_THREAD_TERMINATION_REQUESTED != _threadState) && (0 < idleTime)) {
+					omrthread_monitor_wait_timed(_monitor, idleTime / 1000000, (intptr_t)(idleTime % 1000000));
+					idleTime = idleUntil - omrtime_nano_time();
+				}
+			}
+		}
+	}
+
+	_threadState = MAINTENANCE_THREAD_TERMINATED;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_exit(_monitor);
+}
+
+uint64_t
+MM_MemoryMaintenanceThread::decommitSlice(PendingRange *range)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+	MM_Heap *heap = range->heap;
+	uintptr_t sliceBase = range->base;
+	uintptr_t sliceTop = range->top;
+	void *lowValidAddress = range->lowValidAddress;
+	void *highValidAddress = range->highValidAddress;
+
+	uintptr_t pageSize = heap->getPageSize();
+	if ((sliceTop - sliceBase) > MEMORY_MAINTENANCE_SLICE_SIZE) {
+		sliceTop = MM_Math::roundToCeiling(pageSize, sliceBase + MEMORY_MAINTENANCE_SLICE_SIZE);
+	}
+	if (sliceTop < range->top) {
+		/* the rest of the range follows memory that is being decommitted */
+		highValidAddress = (void *)sliceTop;
+		range->base = sliceTop;
+		range->lowValidAddress = NULL;
+	} else {
+		sliceTop = range->top;
+		range->heap = NULL;
+	}
+	_sliceBase = sliceBase;
+	_sliceTop = sliceTop;
+	omrthread_monitor_exit(_monitor);
+
+	omrthread_t self = omrthread_self();
+	int64_t cpuStart = omrthread_get_self_cpu_time(self);
+	int64_t start = omrtime_nano_time();
+	heap->decommitMemory((void *)sliceBase, sliceTop - sliceBase, lowValidAddress, highValidAddress);
+	int64_t end = omrtime_nano_time();
+	int64_t cpuEnd = omrthread_get_self_cpu_time(self);
+
+	uint64_t elapsed = (end > start) ? (uint64_t)(end - start) : 0;
+	/* wall clock time stands in on platforms without per thread CPU time */
+	uint64_t sliceTime = ((0 <= cpuStart) && (cpuStart <= cpuEnd)) ? (uint64_t)(cpuEnd - cpuStart) : elapsed;
+
+	omrthread_monitor_enter(_monitor);
+	_releasedBytes += sliceTop - sliceBase;
+	_backgroundTime += elapsed / 1000;
+	_sliceBase = 0;
+	_sliceTop = 0;
+	omrthread_monitor_notify_all(_monitor);
+
+	return sliceTime;
+}
+
+MM_MemoryMaintenanceThread::PendingRange *
+MM_MemoryMaintenanceThread::findFreeRange()
+{
+	for (uintptr_t i = 0; i < MEMORY_MAINTENANCE_MAX_RANGES; i++) {
+		if (NULL == _pending[i].heap) {
+			return &_pending[i];
+		}
+	}
+	return NULL;
+}
@@ -0,0 +1,145 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(MEMORYMAINTENANCETHREAD_HPP_)
+#define MEMORYMAINTENANCETHREAD_HPP_
+
+#include "omrcomp.h"
+#include "omrthread.h"
+
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+class MM_Heap;
+
+#define MEMORY_MAINTENANCE_MAX_RANGES 32 /**< Number of heap ranges that can wait for the thread at once */
+#define MEMORY_MAINTENANCE_SLICE_SIZE ((uintptr_t)4 * 1024 * 1024) /**< Most the thread decommits before checking its CPU budget */
+
+/**
+ * Background thread which gives memory removed from the heap back to the operating system outside of the GC pause.
+ * Contraction hands the range over with deferDecommit() once it is out of every memory pool, and any commit of heap
+ * memory calls cancelDecommit() first, so a range is never released after it has been given back to the heap.
+ * The thread works in slices and sleeps between them so it stays within -Xgc:backgroundDecommitCPUPercent of a CPU.
+ * @ingroup GC_Base_Core
+ */
+class MM_MemoryMaintenanceThread : public MM_BaseNonVirtual
+{
+/*
+ * Data members
+ */
+public:
+protected:
+private:
+	typedef enum MaintenanceThreadState {
+		MAINTENANCE_THREAD_NONE = 0,
+		MAINTENANCE_THREAD_STARTING,
+		MAINTENANCE_THREAD_RUNNING,
+		MAINTENANCE_THREAD_TERMINATION_REQUESTED,
+		MAINTENANCE_THREAD_TERMINATED,
+	} MaintenanceThreadState;
+
+	typedef struct PendingRange {
+		MM_Heap *heap; /**< heap to decommit the range from, NULL if the entry is unused */
+		uintptr_t base;
+		uintptr_t top;
+		void *lowValidAddress; /**< as passed to MM_Heap::decommitMemory() for the range */
+		void *highValidAddress; /**< as passed to MM_Heap::decommitMemory() for the range */
+	} PendingRange;
+
+	MM_GCExtensionsBase *_extensions;
+	omrthread_monitor_t _monitor; /**< protects everything below */
+	volatile MaintenanceThreadState _threadState;
+	PendingRange _pending[MEMORY_MAINTENANCE_MAX_RANGES];
+	uintptr_t _sliceBase; /**< start of the slice the thread is decommitting without the monitor, 0 if none */
+	uintptr_t _sliceTop;
+	uintptr_t _cpuPercent; /**< share of one CPU the thread may use */
+
+	uint64_t _deferredBytes; /**< total bytes handed to the thread */
+	uint64_t _releasedBytes; /**< total bytes the thread has decommitted */
+	uint64_t _reclaimedBytes; /**< total bytes given back to the heap before the thread got to them */
+	uint64_t _backgroundTime; /**< total time, in microseconds, the thread has spent decommitting */
+
+/*
+ * Function members
+ */
+public:
+	static MM_MemoryMaintenanceThread *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Start the thread, waiting until it reports that it is running.
+	 * @return true on success, false if the thread could not be created
+	 */
+	bool startup(MM_EnvironmentBase *env);
+
+	/**
+	 * Stop the thread, waiting for it to exit.  Ranges still pending are left committed.
+	 */
+	void shutdown();
+
+	/**
+	 * Hand a range removed from the heap to the thread rather than decommitting it in the caller.
+	 * The arguments are the ones the caller would otherwise pass to heap->decommitMemory().
+	 * @return true if the thread took the range, false if the caller must decommit it itself
+	 */
+	bool deferDecommit(MM_EnvironmentBase *env, MM_Heap *heap, void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress);
+
+	/**
+	 * Remove [address, address + size) from the ranges waiting to be decommitted, waiting for the thread if it is
+	 * decommitting part of it right now.  Called before the range is committed again.
+	 */
+	void cancelDecommit(void *address, uintptr_t size);
+
+	/**
+	 * Snapshot of the thread's work so far.
+	 * @param[out] deferredBytes total bytes handed to the thread
+	 * @param[out] releasedBytes total bytes decommitted by the thread
+	 * @param[out] reclaimedBytes total bytes given back to the heap before they were decommitted
+	 * @param[out] pendingBytes bytes still waiting to be decommitted
+	 * @param[out] backgroundTime total time, in microseconds, spent decommitting outside of the pause
+	 */
+	void getStats(uint64_t *deferredBytes, uint64_t *releasedBytes, uint64_t *reclaimedBytes, uint64_t *pendingBytes, uint64_t *backgroundTime);
+
+	MM_MemoryMaintenanceThread(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+	static int J9THREAD_PROC threadEntryPoint(void *maintenanceThread);
+	void threadLoop();
+
+	/**
+	 * Take the next slice off the pending ranges and decommit it with the monitor released.
+	 * @return the CPU time, in nanoseconds, the slice took
+	 */
+	uint64_t decommitSlice(PendingRange *range);
+
+	/**
+	 * @return an unused entry in _pending, or NULL if all of them hold ranges
+	 */
+	PendingRange *findFreeRange();
+};
+
+#endif /* MEMORYMAINTENANCETHREAD_HPP_ */
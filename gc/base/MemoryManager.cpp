@@ -30,6 +30,8 @@
 #include "MemcheckWrapper.hpp"
 #endif /* defined(OMR_VALGRIND_MEMCHECK) */
 
+#define MIXED_PAGE_SIZE_HEAP_TRANSPARENT_PAGE_SIZE ((uintptr_t)2 * 1024 * 1024)
+
 MM_MemoryManager*
 MM_MemoryManager::newInstance(MM_EnvironmentBase* env)
 {
@@ -73,6 +75,24 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 	uintptr_t pageFlags = extensions->requestedPageFlags;
 	Assert_MM_true(0 != pageSize);
 
+	/* A mixed page size heap is reserved with default pages, the large pages are chosen chunk by chunk as it is committed */
+	uintptr_t mixedLargePageSize = 0;
+	if (extensions->mixedPageSizeHeap) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		uintptr_t* supportedPageSizes = omrvmem_supported_page_sizes();
+		uintptr_t* supportedPageFlags = omrvmem_supported_page_flags();
+		if (isLargePage(env, pageSize)) {
+			mixedLargePageSize = pageSize;
+		} else if (0 != supportedPageSizes[1]) {
+			mixedLargePageSize = supportedPageSizes[1];
+		} else {
+			/* no explicit large pages are configured, chunks can still be backed by transparent huge pages */
+			mixedLargePageSize = MIXED_PAGE_SIZE_HEAP_TRANSPARENT_PAGE_SIZE;
+		}
+		pageSize = supportedPageSizes[0];
+		pageFlags = supportedPageFlags[0];
+	}
+
 	uintptr_t allocateSize = size;
 
 	uintptr_t concurrentScavengerPageSize = 0;
@@ -310,7 +330,12 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 		}
 	}
 
-	if((NULL != instance) && extensions->largePageFailOnError && (instance->getPageSize() != extensions->requestedPageSize)) {
+	if ((NULL != instance) && (0 != mixedLargePageSize)) {
+		/* the heap stays on default pages if it can not be mixed */
+		instance->enableMixedPageBacking(env, mixedLargePageSize);
+	}
+
+	if((NULL != instance) && (0 == mixedLargePageSize) && extensions->largePageFailOnError && (instance->getPageSize() != extensions->requestedPageSize)) {
 		extensions->heapInitializationFailureReason = MM_GCExtensionsBase::HEAP_INITIALIZATION_FAILURE_REASON_CAN_NOT_SATISFY_REQUESTED_PAGE_SIZE;
 		instance->kill(env);
 		instance = NULL;
@@ -605,6 +630,15 @@ MM_MemoryManager::decommitMemory(MM_MemoryHandle* handle, void* address, uintptr
 	return memory->decommitMemory(address, size, lowValidAddress, highValidAddress);
 }
 
+uintptr_t
+MM_MemoryManager::getPageBacking(MM_MemoryHandle* handle, void* lowAddress, void* highAddress, uintptr_t* explicitBytes, uintptr_t* transparentBytes)
+{
+	Assert_MM_true(NULL != handle);
+	MM_VirtualMemory* memory = handle->getVirtualMemory();
+	Assert_MM_true(NULL != memory);
+	return memory->getPageBacking(lowAddress, highAddress, explicitBytes, transparentBytes);
+}
+
 bool
 MM_MemoryManager::isLargePage(MM_EnvironmentBase* env, uintptr_t pageSize)
 {
@@ -234,6 +234,18 @@ public:
 	 */
 	bool decommitMemory(MM_MemoryHandle* handle, void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
 
+	/**
+	 * Report how a range of the virtual memory instance is backed
+	 *
+	 * @param pointer to memory handle
+	 * @param lowAddress start of the range
+	 * @param highAddress end of the range
+	 * @param[out] explicitBytes bytes of the range backed by explicit large pages
+	 * @param[out] transparentBytes bytes of the range eligible for transparent huge pages
+	 * @return the large page size, or 0 if the instance does not mix page sizes
+	 */
+	uintptr_t getPageBacking(MM_MemoryHandle* handle, void* lowAddress, void* highAddress, uintptr_t* explicitBytes, uintptr_t* transparentBytes);
+
 #if defined(OMR_GC_VLHGC) || defined(OMR_GC_MODRON_SCAVENGER)
 	/*
 	 * Set the NUMA affinity for the specified range within the receiver.
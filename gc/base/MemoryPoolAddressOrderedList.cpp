@@ -142,6 +142,19 @@ MM_MemoryPoolAddressOrderedList::initialize(MM_EnvironmentBase *env)
 	}
 	_hintInactive = previousInactiveHint;
 
+	/* The size class index relies on the parallel sweep connecting the free list in address order */
+	_sizeClassIndexEnabled = ext->freeListSizeClassIndex && !ext->isVLHGC();
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	_sizeClassIndexEnabled = _sizeClassIndexEnabled && !ext->concurrentSweep;
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+	_sizeClassIndexCount = 0;
+	if (_sizeClassIndexEnabled) {
+		/* No free entry can be larger than the heap, so size classes beyond it are never populated */
+		uintptr_t heapSizeClass = MM_Math::floorLog2(OMR_MAX(_extensions->heap->getMaximumMemorySize(), getSizeClassLowerBound(0)));
+		_sizeClassIndexCount = OMR_MIN(heapSizeClass - FREE_LIST_SIZE_CLASS_INDEX_SHIFT + 1, (uintptr_t)FREE_LIST_SIZE_CLASS_INDEX_MAX_COUNT);
+	}
+	clearSizeClassIndex();
+
 	return true;
 }
 
@@ -413,6 +426,115 @@ MM_MemoryPoolAddressOrderedList::updateHintsBeyondEntry(MM_HeapLinkedFreeHeader
 	}
 }
 
+/****************************************
+ * Size Class Index Functionality
+ ****************************************
+ */
+
+/**
+ * Forget all size class index entries.  Every lookup will search from the head of the free list
+ * until the index is populated again (by sweep or by allocation walks).
+ */
+void
+MM_MemoryPoolAddressOrderedList::clearSizeClassIndex()
+{
+	for (uintptr_t sizeClass = 0; sizeClass < _sizeClassIndexCount; sizeClass++) {
+		_sizeClassIndex[sizeClass] = NULL;
+	}
+	_sizeClassIndexPopulated = 0;
+}
+
+/**
+ * Find the free entry from which a search for lookupSize bytes can start.
+ * @param lookupSize size in bytes being searched for
+ * @param[out] sizeClassLowerBound lower bound of the size class used (all entries up to the returned one are smaller), 0 if none
+ * @return the free entry to start the search from, NULL if the search must start at the head of the free list
+ */
+MMINLINE MM_HeapLinkedFreeHeader *
+MM_MemoryPoolAddressOrderedList::findSizeClassIndex(uintptr_t lookupSize, uintptr_t *sizeClassLowerBound)
+{
+	MM_HeapLinkedFreeHeader *freeEntry = NULL;
+	*sizeClassLowerBound = 0;
+
+	if ((0 != _sizeClassIndexCount) && (lookupSize >= getSizeClassLowerBound(0))) {
+		uintptr_t sizeClass = OMR_MIN(MM_Math::floorLog2(lookupSize) - FREE_LIST_SIZE_CLASS_INDEX_SHIFT, _sizeClassIndexCount - 1);
+		freeEntry = _sizeClassIndex[sizeClass];
+		/* Entries below the head have been consumed by TLH allocates from the head - treat them as the head */
+		if ((NULL == _heapFreeList) || (freeEntry < _heapFreeList)) {
+			freeEntry = NULL;
+		} else {
+			*sizeClassLowerBound = getSizeClassLowerBound(sizeClass);
+		}
+	}
+
+	return freeEntry;
+}
+
+/**
+ * Replace a free entry referenced by the size class index.  The new entry must be the free entry
+ * that takes the place of the old one (its recycled remainder or its predecessor), or NULL.
+ */
+MMINLINE void
+MM_MemoryPoolAddressOrderedList::updateSizeClassIndex(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry)
+{
+	for (uintptr_t sizeClass = 0; sizeClass < _sizeClassIndexCount; sizeClass++) {
+		if (oldFreeEntry == _sizeClassIndex[sizeClass]) {
+			_sizeClassIndex[sizeClass] = newFreeEntry;
+		}
+	}
+}
+
+/**
+ * Advance the size class index after a walk of the free list.
+ * Index entries are ordered by size class, so the walk from the largest class stops at the first entry already beyond freeEntry.
+ * @param freeEntry free entry reached by the walk
+ * @param largestFreeEntrySize size of the largest free entry at or below freeEntry
+ */
+MMINLINE void
+MM_MemoryPoolAddressOrderedList::advanceSizeClassIndex(MM_HeapLinkedFreeHeader *freeEntry, uintptr_t largestFreeEntrySize)
+{
+	uintptr_t firstSizeClass = 0;
+	if (largestFreeEntrySize >= getSizeClassLowerBound(0)) {
+		firstSizeClass = MM_Math::floorLog2(largestFreeEntrySize) - FREE_LIST_SIZE_CLASS_INDEX_SHIFT + 1;
+	}
+
+	uintptr_t sizeClass = _sizeClassIndexCount;
+	while (sizeClass > firstSizeClass) {
+		sizeClass -= 1;
+		if (_sizeClassIndex[sizeClass] >= freeEntry) {
+			break;
+		}
+		_sizeClassIndex[sizeClass] = freeEntry;
+	}
+}
+
+/**
+ * Populate the size classes that the sweep has just saturated.  Called as chunks are connected to the free list.
+ * @param freeEntry last connected free entry whose size (and the size of all entries below it) is already final
+ * @param largestFreeEntrySize largest free entry connected so far
+ */
+void
+MM_MemoryPoolAddressOrderedList::populateSizeClassIndex(MM_HeapLinkedFreeHeader *freeEntry, uintptr_t largestFreeEntrySize)
+{
+	while ((_sizeClassIndexPopulated < _sizeClassIndexCount) && (getSizeClassLowerBound(_sizeClassIndexPopulated) <= largestFreeEntrySize)) {
+		_sizeClassIndex[_sizeClassIndexPopulated] = freeEntry;
+		_sizeClassIndexPopulated += 1;
+	}
+}
+
+/**
+ * Populate the size classes that no connected free entry can satisfy.  Called once the sweep has connected the whole free list.
+ * @param lastFreeEntry last free entry of the free list
+ */
+void
+MM_MemoryPoolAddressOrderedList::completeSizeClassIndex(MM_HeapLinkedFreeHeader *lastFreeEntry)
+{
+	while (_sizeClassIndexPopulated < _sizeClassIndexCount) {
+		_sizeClassIndex[_sizeClassIndexPopulated] = lastFreeEntry;
+		_sizeClassIndexPopulated += 1;
+	}
+}
+
 /****************************************
  * Allocation
  ****************************************
@@ -426,6 +548,7 @@ MM_MemoryPoolAddressOrderedList::internalAllocate(MM_EnvironmentBase *env, uintp
 	uintptr_t recycleEntrySize;
 	uintptr_t walkCount;
 	J9ModronAllocateHint *allocateHintUsed;
+	bool sizeClassIndexWalk;
 	void *addrBase;
 	uintptr_t largestFreeEntry = 0;
 	
@@ -441,6 +564,7 @@ retry:
 	previousFreeEntry = NULL;
 	walkCount = 0;
 	allocateHintUsed = NULL;
+	sizeClassIndexWalk = false;
 	candidateHintSize = 0;
 
 	/* Large object - use a hint if it is available */
@@ -450,6 +574,18 @@ retry:
 		candidateHintSize = allocateHintUsed->size;
 	}
 
+	/* Skip ahead with the size class index if it gets further than the hint */
+	if (_sizeClassIndexEnabled) {
+		uintptr_t sizeClassLowerBound = 0;
+		MM_HeapLinkedFreeHeader *sizeClassEntry = findSizeClassIndex(sizeInBytesRequired, &sizeClassLowerBound);
+		if ((NULL == allocateHintUsed) || (sizeClassEntry > currentFreeEntry)) {
+			sizeClassIndexWalk = true;
+			if (NULL != sizeClassEntry) {
+				currentFreeEntry = sizeClassEntry;
+				candidateHintSize = sizeClassLowerBound - 1;
+			}
+		}
+	}
 
 	while(currentFreeEntry) {
 		if (doesNeedAlignment(env, currentFreeEntry)) {
@@ -480,6 +616,11 @@ retry:
 		Assert_MM_true((NULL == currentFreeEntry) || (currentFreeEntry > previousFreeEntry));
 	}
 
+	/* Nothing walked over is large enough for the classes above candidateHintSize - let the next search skip it */
+	if (sizeClassIndexWalk && (0 != walkCount)) {
+		advanceSizeClassIndex(previousFreeEntry, candidateHintSize);
+	}
+
 	/* Check if an entry was found */
 	if(!currentFreeEntry) {
 #if defined(OMR_GC_CONCURRENT_SWEEP)
@@ -514,6 +655,9 @@ retry:
 			_prevFirstUnalignedFreeEntry = recycleEntry;
 		}
 		updateHint(currentFreeEntry, recycleEntry);
+		if (_sizeClassIndexEnabled) {
+			updateSizeClassIndex(currentFreeEntry, recycleEntry);
+		}
 		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
 	} else {
 		if (currentFreeEntry->getNext(compressed) == _firstUnalignedFreeEntry) {
@@ -528,6 +672,9 @@ retry:
 
 		/* Removed from the free list - Kill the hint if necessary */
 		removeHint(currentFreeEntry);
+		if (_sizeClassIndexEnabled) {
+			updateSizeClassIndex(currentFreeEntry, previousFreeEntry);
+		}
 	}
 	
 	/* Collector object allocate stats for Survivor are not interesting (_largeObjectCollectorAllocateStats is null for Survivor) */	
@@ -748,6 +895,7 @@ MM_MemoryPoolAddressOrderedList::reset(Cause cause)
 	MM_MemoryPool::reset(cause);
 
 	clearHints();
+	clearSizeClassIndex();
 	_heapFreeList = (MM_HeapLinkedFreeHeader *)NULL;
 	_scannableBytes = 0;
 	_nonScannableBytes = 0;
@@ -849,6 +997,9 @@ MM_MemoryPoolAddressOrderedList::expandWithRange(MM_EnvironmentBase *env, uintpt
 		return ;
 	}
 
+	/* Entries below the index may grow or be inserted - the index is rebuilt on demand */
+	clearSizeClassIndex();
+
 	/* Find the free entries in the list the appear before/after the range being added */
 	previousFreeEntry = NULL;
 	nextFreeEntry = _heapFreeList;
@@ -955,6 +1106,9 @@ MM_MemoryPoolAddressOrderedList::contractWithRange(MM_EnvironmentBase *env, uint
 		return NULL;
 	}
 
+	/* The contracted free entry may be referenced by the index */
+	clearSizeClassIndex();
+
 	/* Find the free entry that encompasses the range to contract */
 	/* TODO: Could we use hints to find a better starting address?  Are hints still valid? */
 	previousFreeEntry = NULL;
@@ -1048,6 +1202,9 @@ MM_MemoryPoolAddressOrderedList::addFreeEntries(MM_EnvironmentBase *env,
 		currentFreeEntry = currentFreeEntry->getNext(compressed);
 	}
 
+	/* Added entries may land below (or coalesce with) entries referenced by the index */
+	clearSizeClassIndex();
+
 	/* Find the first free entry, if any, within specified range */
 	MM_HeapLinkedFreeHeader *previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
@@ -1141,6 +1298,9 @@ MM_MemoryPoolAddressOrderedList::removeFreeEntriesWithinRange(MM_EnvironmentBase
 	retListMemoryCount = 0;
 	retListMemorySize = 0;
 
+	/* Removed entries may be referenced by the index */
+	clearSizeClassIndex();
+
 	/* Find the first free entry, if any, within specified range */
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
@@ -1503,6 +1663,8 @@ MM_MemoryPoolAddressOrderedList::moveHeap(MM_EnvironmentBase *env, void *srcBase
 	bool const compressed = compressObjectReferences();
 	MM_HeapLinkedFreeHeader *currentFreeEntry, *previousFreeEntry;
 
+	clearSizeClassIndex();
+
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
 	while(currentFreeEntry) {
@@ -1553,6 +1715,9 @@ MM_MemoryPoolAddressOrderedList::recycleHeapChunk(void* chunkBase, void* chunkTo
 
 	_heapLock.acquire();
 
+	/* The chunk may be inserted below entries referenced by the index */
+	clearSizeClassIndex();
+
 	if ((NULL == _heapFreeList) || (chunkBase < (void*)_heapFreeList)) {
 		/* Add to front of freelist */
 		recycled = recycleHeapChunk(chunkBase, chunkTop, NULL, _heapFreeList);
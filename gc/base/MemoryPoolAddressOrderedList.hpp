@@ -41,6 +41,10 @@ class MM_ConcurrentSweepScheme;
 
 #define FREE_ENTRY_END ((MM_HeapLinkedFreeHeader *)OMRPORT_VMEM_MAX_ADDRESS)
 
+/* Size class index: class k covers free entry sizes [2^(k + SHIFT), 2^(k + SHIFT + 1)) */
+#define FREE_LIST_SIZE_CLASS_INDEX_SHIFT 10
+#define FREE_LIST_SIZE_CLASS_INDEX_MAX_COUNT ((sizeof(uintptr_t) * 8) - FREE_LIST_SIZE_CLASS_INDEX_SHIFT)
+
 /**
  * @todo Provide class documentation
  * @ingroup GC_Base_Core
@@ -60,6 +64,12 @@ private:
 	struct J9ModronAllocateHint* _hintInactive;
 	struct J9ModronAllocateHint _hintStorage[HINT_ELEMENT_COUNT];
 	uintptr_t _hintLru;
+
+	/* Size class index support */
+	bool _sizeClassIndexEnabled; /**< true if the size class index is maintained for this pool (-Xgc:freeListSizeClassIndex) */
+	MM_HeapLinkedFreeHeader *_sizeClassIndex[FREE_LIST_SIZE_CLASS_INDEX_MAX_COUNT]; /**< per size class, a free entry such that it and all entries below it are smaller than the class lower bound (NULL if the search must start at the head) */
+	uintptr_t _sizeClassIndexCount; /**< number of size classes in use, bounded by the maximum heap size */
+	uintptr_t _sizeClassIndexPopulated; /**< number of leading size classes already populated by the current sweep */
 	
 	MM_LargeObjectAllocateStats *_largeObjectCollectorAllocateStats;  /**< Same as _largeObjectAllocateStats except specifically for collector allocates */
 
@@ -78,6 +88,22 @@ private:
 	void updateHint(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry);
 	void clearHints();
 	void updateHintsBeyondEntry(MM_HeapLinkedFreeHeader *freeEntry);
+
+	void clearSizeClassIndex();
+	MM_HeapLinkedFreeHeader *findSizeClassIndex(uintptr_t lookupSize, uintptr_t *sizeClassLowerBound);
+	void updateSizeClassIndex(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry);
+	void advanceSizeClassIndex(MM_HeapLinkedFreeHeader *freeEntry, uintptr_t largestFreeEntrySize);
+	void populateSizeClassIndex(MM_HeapLinkedFreeHeader *freeEntry, uintptr_t largestFreeEntrySize);
+	void completeSizeClassIndex(MM_HeapLinkedFreeHeader *lastFreeEntry);
+
+	/**
+	 * Lower bound (in bytes) of the free entry sizes covered by a size class.
+	 */
+	MMINLINE uintptr_t getSizeClassLowerBound(uintptr_t sizeClass)
+	{
+		return ((uintptr_t)1) << (sizeClass + FREE_LIST_SIZE_CLASS_INDEX_SHIFT);
+	}
+
 	void *internalAllocate(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 	bool internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 
@@ -230,6 +256,9 @@ public:
 	MM_MemoryPoolAddressOrderedList(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize) :
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize)
 		,_heapFreeList(NULL)
+		,_sizeClassIndexEnabled(false)
+		,_sizeClassIndexCount(0)
+		,_sizeClassIndexPopulated(0)
 		,_largeObjectCollectorAllocateStats(NULL)
 		,_firstUnalignedFreeEntry(FREE_ENTRY_END)
 		,_prevFirstUnalignedFreeEntry(FREE_ENTRY_END)
@@ -240,6 +269,9 @@ public:
 	MM_MemoryPoolAddressOrderedList(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize, const char *name) :
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize, name)
 		,_heapFreeList(NULL)
+		,_sizeClassIndexEnabled(false)
+		,_sizeClassIndexCount(0)
+		,_sizeClassIndexPopulated(0)
 		,_largeObjectCollectorAllocateStats(NULL)
 		,_firstUnalignedFreeEntry(FREE_ENTRY_END)
 		,_prevFirstUnalignedFreeEntry(FREE_ENTRY_END)
@@ -28,6 +28,9 @@
 #include "AllocateDescription.hpp"
 #include "GCExtensionsBase.hpp"
 #include "GlobalCollector.hpp"
+#include "Heap.hpp"
+#include "HeapResizeStats.hpp"
+#include "Math.hpp"
 #include "PhysicalSubArena.hpp"
 #include "MemorySpace.hpp"
 
@@ -95,8 +98,10 @@ void
 MM_MemorySubSpaceUniSpace::checkResize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool _systemGC)
 {
 	uintptr_t oldVMState = env->pushVMstate(OMRVMSTATE_GC_CHECK_RESIZE);
-	if (!timeForHeapContract(env, allocDescription, _systemGC)) {
-		timeForHeapExpand(env, allocDescription);
+	if (!_extensions->heapSizingCostModel || !timeForCostModelResize(env, allocDescription)) {
+		if (!timeForHeapContract(env, allocDescription, _systemGC)) {
+			timeForHeapExpand(env, allocDescription);
+		}
 	}
 	env->popVMstate(oldVMState);
 }
@@ -350,6 +355,142 @@ MM_MemorySubSpaceUniSpace::timeForHeapContract(MM_EnvironmentBase *env, MM_Alloc
 }
 
 
+/**
+ * Determine how much we should expand or contract subspace by to reach the target size chosen by the
+ * heap sizing cost model, and store the result in _expansionSize or _contractionSize.
+ * The target is chosen once per global collection; later calls in the same collection only recalculate
+ * the resize from it. The space may stay up to HEAP_SIZING_CONTRACT_TOLERANCE_PERCENT above the target,
+ * so small changes of the target do not alternate expansions and contractions.
+ *
+ * @return false if the model has no target yet, and the free ratio heuristics should decide
+ */
+bool
+MM_MemorySubSpaceUniSpace::timeForCostModelResize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription)
+{
+#if defined(OMR_GC_MODRON_STANDARD)
+	if (!_extensions->isStandardGC()) {
+		return false;
+	}
+
+	MM_HeapResizeStats *resizeStats = _extensions->heap->getResizeStats();
+	MM_HeapSizingStats *decision = resizeStats->getHeapSizingStats();
+	uintptr_t gcCount = _extensions->globalGCStats.gcCount;
+	uintptr_t bytesRequired = (NULL != allocDescription) ? allocDescription->getBytesRequested() : 0;
+
+	if (gcCount != decision->_gcCount) {
+		decision->_gcCount = gcCount;
+		if (!decideCostModelTarget(env, bytesRequired, decision)) {
+			decision->_limit = HEAP_SIZING_LIMIT_NONE;
+		}
+	}
+
+	if (HEAP_SIZING_LIMIT_NONE == decision->_limit) {
+		return false;
+	}
+
+	_expansionSize = 0;
+	_contractionSize = 0;
+
+	uintptr_t currentSize = getActiveMemorySize();
+	uintptr_t targetSize = decision->_targetSize;
+	bool allocationSatisfied = true;
+	if (NULL != allocDescription) {
+		allocationSatisfied = (env->getMemorySpace()->findLargestFreeEntry(env, allocDescription) >= bytesRequired);
+	}
+
+	if (targetSize > currentSize) {
+		if ((NULL != _physicalSubArena) && _physicalSubArena->canExpand(env) && (0 != maxExpansionInSpace(env))) {
+			uintptr_t expandSize = adjustExpansionWithinFreeLimits(env, targetSize - currentSize);
+			expandSize = adjustExpansionWithinUserIncrement(env, expandSize);
+			_expansionSize = adjustExpansionWithinSoftMax(env, expandSize, 0);
+			if (0 != _expansionSize) {
+				resizeStats->setLastExpandReason(BELOW_COST_MODEL_TARGET);
+			}
+		}
+	} else if (allocationSatisfied && ((currentSize - targetSize) > ((targetSize / 100) * HEAP_SIZING_CONTRACT_TOLERANCE_PERCENT))) {
+		if ((NULL != _physicalSubArena) && _physicalSubArena->canContract(env) && (0 != maxContraction(env))
+			&& ((resizeStats->getLastHeapExpansionGCCount() + _extensions->heapContractionStabilizationCount) <= gcCount)
+		) {
+			/* contract towards the target at the pace of the free ratio heuristics */
+			uintptr_t contractionGranule = _extensions->regionSize;
+			uintptr_t maxContract = (uintptr_t)(currentSize * _extensions->globalMaximumContraction);
+			uintptr_t minContract = (uintptr_t)(currentSize * _extensions->globalMinimumContraction);
+			maxContract = OMR_MAX(MM_Math::roundToCeiling(contractionGranule, maxContract), contractionGranule);
+			uintptr_t contractSize = MM_Math::roundToFloor(contractionGranule, OMR_MIN(currentSize - targetSize, maxContract));
+			if (contractSize >= minContract) {
+				_contractionSize = contractSize;
+				resizeStats->setLastContractReason(ABOVE_COST_MODEL_TARGET);
+			}
+		}
+	}
+
+	if (!allocationSatisfied && (NULL != _physicalSubArena) && _physicalSubArena->canExpand(env) && (0 != maxExpansionInSpace(env))) {
+		/* the allocation still has to be satisfied, whatever the target */
+		_expansionSize = adjustExpansionWithinSoftMax(env, OMR_MAX(_expansionSize, bytesRequired), bytesRequired);
+		resizeStats->setLastExpandReason(EXPAND_DESPERATE);
+	}
+
+	return true;
+#else /* defined(OMR_GC_MODRON_STANDARD) */
+	return false;
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
+}
+
+/**
+ * Gather the inputs of the heap sizing cost model for the current global collection and let it choose
+ * a target size for the subspace.
+ * @param[out] decision the target and the inputs it was chosen from, reported to verbose GC
+ * @return false if the model could not choose a target yet
+ */
+bool
+MM_MemorySubSpaceUniSpace::decideCostModelTarget(MM_EnvironmentBase *env, uintptr_t bytesRequired, MM_HeapSizingStats *decision)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_Heap *heap = _extensions->heap;
+	MM_HeapResizeStats *resizeStats = heap->getResizeStats();
+	uint64_t startTime = resizeStats->getGlobalGCStartTime();
+	uint64_t lastEndTime = resizeStats->getLastGlobalGCEndTime();
+	uint64_t now = omrtime_hires_clock();
+
+	if (0 == startTime) {
+		/* the collector does not record the model inputs */
+		return false;
+	}
+
+	MM_HeapSizingSample sample;
+	sample.intervalMicros = ((0 != lastEndTime) && (startTime > lastEndTime)) ? omrtime_hires_delta(lastEndTime, startTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS) : 0;
+	sample.pauseMicros = (now > startTime) ? omrtime_hires_delta(startTime, now, OMRPORT_TIME_DELTA_IN_MICROSECONDS) : 0;
+	sample.allocatedBytes = MM_Math::saturatingSubtract(resizeStats->getUsedBytesAtGlobalGCStart(), resizeStats->getUsedBytesAfterGlobalGC());
+	sample.currentSize = getActiveMemorySize();
+	sample.liveBytes = MM_Math::saturatingSubtract(sample.currentSize, getApproximateActiveFreeMemorySize());
+	sample.minimumSize = _minimumSize;
+	sample.maximumSize = _maximumSize;
+	uintptr_t actualSoftMx = heap->getActualSoftMxSize(env);
+	if (0 != actualSoftMx) {
+		sample.maximumSize = OMR_MIN(sample.maximumSize, actualSoftMx);
+	}
+	sample.bytesRequired = bytesRequired;
+
+	/* the rest of the heap comes out of the same container budget. Enabling cgroup subsystems changes
+	 * process wide port library state, so the limit is only used if the embedder has enabled the memory subsystem.
+	 */
+	uint64_t containerLimit = 0;
+	sample.containerBudget = 0;
+	if ((0 != omrsysinfo_cgroup_are_subsystems_enabled(OMR_CGROUP_SUBSYSTEM_MEMORY)) && (0 == omrsysinfo_cgroup_get_memlimit(&containerLimit))) {
+		uint64_t heapBudget = (containerLimit / 100) * _extensions->heapSizingContainerPercent;
+		uintptr_t otherSpaces = MM_Math::saturatingSubtract(heap->getActiveMemorySize(), sample.currentSize);
+		heapBudget = OMR_MIN(heapBudget, (uint64_t)UDATA_MAX);
+		sample.containerBudget = OMR_MAX(MM_Math::saturatingSubtract((uintptr_t)heapBudget, otherSpaces), 1);
+	} else {
+		containerLimit = 0;
+	}
+	decision->_containerLimit = containerLimit;
+
+	uintptr_t gcTimeTarget = (_extensions->heapExpansionGCTimeThreshold + _extensions->heapContractionGCTimeThreshold) / 2;
+	_heapSizingModel.setTargets(gcTimeTarget, (uint64_t)_extensions->heapSizingPauseTarget * 1000, _extensions->regionSize);
+	return _heapSizingModel.decide(&sample, decision);
+}
+
 /**
  * Determine the amount of heap to contract.
  * Calculate the contraction size while factoring in the pending allocate and whether a contract based on
@@ -29,10 +29,12 @@
 #if !defined(MEMORYSUBSPACEUNISPACE_HPP_)
 #define MEMORYSUBSPACEUNISPACE_HPP_
 
+#include "HeapSizingCostModel.hpp"
 #include "MemorySubSpace.hpp"
 
 #define HEAP_FREE_RATIO_EXPAND_DIVISOR		100
 #define HEAP_FREE_RATIO_EXPAND_MULTIPLIER	17
+#define HEAP_SIZING_CONTRACT_TOLERANCE_PERCENT	10 /**< how far above the cost model target the space may stay without contracting */
 
 /**
  * Functionality that is common for Flat/Concurrent but not applicable for SemiSpace.
@@ -41,6 +43,11 @@
  */
 class MM_MemorySubSpaceUniSpace : public MM_MemorySubSpace
 {
+private:
+	MM_HeapSizingCostModel _heapSizingModel; /**< chooses the target size under -Xgc:heapSizingCostModel */
+
+	bool decideCostModelTarget(MM_EnvironmentBase *env, uintptr_t bytesRequired, MM_HeapSizingStats *decision);
+
 protected:
 	uintptr_t adjustExpansionWithinFreeLimits(MM_EnvironmentBase *env, uintptr_t expandSize);
 	uintptr_t adjustExpansionWithinSoftMax(MM_EnvironmentBase *env, uintptr_t expandSize, uintptr_t minimumBytesRequired);
@@ -51,6 +58,7 @@ protected:
 	uintptr_t calculateTargetContractSize(MM_EnvironmentBase *env, uintptr_t allocSize, bool ratioContract);
 	bool timeForHeapContract(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool systemGC);
 	bool timeForHeapExpand(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);	
+	bool timeForCostModelResize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
 	uintptr_t performExpand(MM_EnvironmentBase *env);
 	uintptr_t performContract(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
 	uintptr_t getHeapFreeMaximumHeuristicMultiplier(MM_EnvironmentBase *env);
@@ -67,6 +75,7 @@ public:
 		bool usesGlobalCollector, uintptr_t minimumSize, uintptr_t initialSize, uintptr_t maximumSize, uintptr_t memoryFlags, uint32_t objectFlags)
 	:
 		MM_MemorySubSpace(env, NULL, physicalSubArena, usesGlobalCollector, minimumSize, initialSize, maximumSize, memoryFlags, objectFlags)
+		, _heapSizingModel()
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -129,6 +129,11 @@ GC_OMRVMInterface::flushCachesForGC(MM_EnvironmentBase *env)
 			allocatedBytesMax = allocatedBytes;
 			vmThreadMax = omrVMThread;
 		}
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+		if (extensions->tlhAdaptiveSizing) {
+			threadEnv->_objectAllocationInterface->updateTLHSizing(threadEnv);
+		}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
 		GC_OMRVMThreadInterface::flushCachesForGC(threadEnv);
 	}
 
@@ -42,6 +42,7 @@ class MM_FrequentObjectsStats;
 class MM_MemoryPool;
 class MM_MemorySpace;
 class MM_MemorySubSpace;
+class MM_TLHSizingStats;
 
 /**
  * Abstract class definition for the object allocation interface.
@@ -123,6 +124,17 @@ public:
 
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
 	virtual void *allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool);
+
+	/**
+	 * Close the receiver's adaptive TLH sizing interval (-Xgc:adaptiveTLHSizing).
+	 * Called for every thread when caches are flushed for GC, before they are flushed.
+	 */
+	virtual void updateTLHSizing(MM_EnvironmentBase *env) {};
+
+	/**
+	 * @return the TLH usage of the last sizing interval which has not been reported yet, or NULL
+	 */
+	virtual MM_TLHSizingStats *getTLHSizingStats() { return NULL; }
 #endif /* OMR_GC_THREAD_LOCAL_HEAP */
 
 	virtual void flushCache(MM_EnvironmentBase *env);
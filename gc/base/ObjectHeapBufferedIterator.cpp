@@ -81,6 +81,28 @@ GC_ObjectHeapBufferedIterator::nextObject()
 	return next;
 }
 
+uintptr_t
+GC_ObjectHeapBufferedIterator::nextObjects(omrobjectptr_t **objects)
+{
+	if (_cacheCount == 0) {
+		return 0;
+	}
+
+	if (_cacheIndex == _cacheCount) {
+		_cacheIndex = 0;
+		_cacheCount = _populator->populateObjectHeapBufferedIteratorCache(_cache, _cacheSizeToUse, &_state);
+
+		if (_cacheCount == 0) {
+			return 0;
+		}
+	}
+
+	uintptr_t count = _cacheCount - _cacheIndex;
+	*objects = &_cache[_cacheIndex];
+	_cacheIndex = _cacheCount;
+	return count;
+}
+
 const MM_ObjectHeapBufferedIteratorPopulator*
 GC_ObjectHeapBufferedIterator::getPopulator()
 {
@@ -80,6 +80,15 @@ public:
 	GC_ObjectHeapBufferedIterator(MM_GCExtensionsBase *extensions, MM_HeapRegionDescriptor *region, bool includeDeadObjects = false, uintptr_t maxElementsToCache = CACHE_SIZE);
 	GC_ObjectHeapBufferedIterator(MM_GCExtensionsBase *extensions, MM_HeapRegionDescriptor *region, void *base, void *top, bool includeDeadObjects = false, uintptr_t maxElementsToCache = CACHE_SIZE);
 	omrobjectptr_t nextObject();
+
+	/**
+	 * Hand out every object left in the cache at once, refilling it first if it has been used up, so the caller can
+	 * work on a whole span of objects rather than one at a time.  Objects are in address order and the span may be
+	 * mixed freely with nextObject().
+	 * @param[out] objects set to the first object of the span, which stays valid until the iterator is next used
+	 * @return the number of objects in the span, 0 once the range has been walked
+	 */
+	uintptr_t nextObjects(omrobjectptr_t **objects);
 	void advance(uintptr_t sizeInBytes);
 	void reset(uintptr_t *base, uintptr_t *top);
 };
@@ -50,8 +50,12 @@ class MM_ParallelObjectDoTask : public MM_ParallelTask
 	 */
 private:
 	MM_HeapWalkerObjectFunc _function;
+	MM_ParallelHeapWalkerObjectsFunc _objectsFunction;
+	MM_ParallelHeapWalkerThreadFunc _threadStart;
 	void *_userData;
 	uintptr_t _walkFlags;
+	uintptr_t _partitionSize;
+	bool _walkMarkedObjects;
 
 	MM_ParallelHeapWalker *_heapWalker;
 
@@ -69,11 +73,32 @@ public:
 	/*
 	 * Create a ParallelObjectAndVMSlotsDoTask object.
 	 */
-	MM_ParallelObjectDoTask(MM_EnvironmentBase *env, MM_ParallelHeapWalker *heapWalker, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool parallel)
+	MM_ParallelObjectDoTask(MM_EnvironmentBase *env, MM_ParallelHeapWalker *heapWalker, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool parallel, MM_ParallelHeapWalkerThreadFunc threadStart = NULL, uintptr_t partitionSize = 0)
 		: MM_ParallelTask(env, env->getExtensions()->dispatcher)
 		, _function(function)
+		, _objectsFunction(NULL)
+		, _threadStart(threadStart)
 		, _userData(userData)
 		, _walkFlags(walkFlags)
+		, _partitionSize(partitionSize)
+		, _walkMarkedObjects(false)
+		, _heapWalker(heapWalker)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+	/*
+	 * Create a ParallelObjectDoTask object which walks the heap a span of objects at a time.
+	 */
+	MM_ParallelObjectDoTask(MM_EnvironmentBase *env, MM_ParallelHeapWalker *heapWalker, MM_ParallelHeapWalkerObjectsFunc objectsFunction, void *userData, uintptr_t walkFlags, MM_ParallelHeapWalkerThreadFunc threadStart, uintptr_t partitionSize, bool walkMarkedObjects)
+		: MM_ParallelTask(env, env->getExtensions()->dispatcher)
+		, _function(NULL)
+		, _objectsFunction(objectsFunction)
+		, _threadStart(threadStart)
+		, _userData(userData)
+		, _walkFlags(walkFlags)
+		, _partitionSize(partitionSize)
+		, _walkMarkedObjects(walkMarkedObjects)
 		, _heapWalker(heapWalker)
 	{
 		_typeId = __FUNCTION__;
@@ -100,19 +125,24 @@ MM_ParallelHeapWalker::newInstance(MM_ParallelGlobalGC *globalCollector, MM_Mark
  * Walk through all live objects of the heap in parallel and apply the provided function.
  */
 void
-MM_ParallelHeapWalker::allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags)
+MM_ParallelHeapWalker::allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, uintptr_t partitionSize, MM_ParallelHeapWalkerObjectsFunc objectsFunction, bool walkMarkedObjects)
 {
 	Trc_MM_ParallelHeapWalker_allObjectsDoParallel_Entry(env->getLanguageVMThread());
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 
 	/* determine the size of the segment chunks to use for parallel walks */
 	uintptr_t threadCount = env->_currentTask->getThreadCount();
-	uintptr_t heapChunkFactor = 1;
-	if ((threadCount > 1) && _markMap->isMarkMapValid()) {
-		heapChunkFactor = threadCount * 8;
+	uintptr_t heapSize = extensions->heap->getMemorySize();
+	uintptr_t heapChunkFactor;
+	uintptr_t parallelChunkSize;
+	if (_markMap->isMarkMapValid() && (0 != partitionSize)) {
+		/* the caller's partitioning wins, even when walking single threaded */
+		parallelChunkSize = MM_Math::roundToCeiling(extensions->heapAlignment, OMR_MIN(partitionSize, heapSize));
+		heapChunkFactor = heapSize / parallelChunkSize;
+	} else {
+		heapChunkFactor = (_markMap->isMarkMapValid() && (threadCount > 1)) ? (threadCount * 8) : 1;
+		parallelChunkSize = MM_Math::roundToCeiling(extensions->heapAlignment, heapSize / heapChunkFactor);
 	}
-	uintptr_t parallelChunkSize = extensions->heap->getMemorySize() / heapChunkFactor;
-	parallelChunkSize = MM_Math::roundToCeiling(extensions->heapAlignment, parallelChunkSize);
 
 	/* Perform the parallel object heap iteration */
 	uintptr_t objectsWalked = 0;
@@ -125,11 +155,18 @@ MM_ParallelHeapWalker::allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalk
 
 	while (NULL != (region = regionIterator.nextRegion())) {
 		if (walkFlags == (region->getTypeFlags() & walkFlags)) {
-			GC_ParallelObjectHeapIterator objectHeapIterator(env, region, region->getLowAddress(), region->getHighAddress(), _markMap, parallelChunkSize);
-			omrobjectptr_t object = NULL;
-			while ((object = objectHeapIterator.nextObject()) != NULL) {
-				function(omrVMThread, region, object, userData);
-				objectsWalked += 1;
+			GC_ParallelObjectHeapIterator objectHeapIterator(env, region, region->getLowAddress(), region->getHighAddress(), _markMap, parallelChunkSize, walkMarkedObjects);
+			omrobjectptr_t *objects = NULL;
+			uintptr_t count = 0;
+			while (0 != (count = objectHeapIterator.nextObjects(&objects))) {
+				if (NULL != objectsFunction) {
+					objectsFunction(omrVMThread, region, objects, count, userData);
+				} else {
+					for (uintptr_t i = 0; i < count; i++) {
+						function(omrVMThread, region, objects[i], userData);
+					}
+				}
+				objectsWalked += count;
 			}
 		}
 	}
@@ -158,11 +195,35 @@ MM_ParallelHeapWalker::allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObject
 	}
 }
 
+/**
+ * Walk through all live objects of the heap on up to threadCount GC threads, in units of partitionSize bytes.
+ */
+void
+MM_ParallelHeapWalker::allObjectsDoPartitioned(MM_EnvironmentBase *env, MM_ParallelHeapWalkerObjectsFunc objectsFunction, MM_ParallelHeapWalkerThreadFunc threadStart, void *userData, uintptr_t walkFlags, uintptr_t partitionSize, uintptr_t threadCount, bool prepareHeapForWalk)
+{
+	GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
+	bool wasMarkMapValid = _markMap->isMarkMapValid();
+	if (prepareHeapForWalk) {
+		_globalCollector->prepareHeapForWalk(env);
+		/* the walk mark has just marked every live object, so its bits can split the regions into partitions */
+		_markMap->setMarkMapValid(true);
+	}
+
+	/* only the walk mark is known to have marked exactly the live objects */
+	MM_ParallelObjectDoTask objectDoTask(env, this, objectsFunction, userData, walkFlags, threadStart, partitionSize, prepareHeapForWalk);
+	env->getExtensions()->dispatcher->run(env, &objectDoTask, threadCount);
+
+	_markMap->setMarkMapValid(wasMarkMapValid);
+}
+
 /**
  * gets the heap walker and calls the actual objectSlotsDo function
  */
 void
 MM_ParallelObjectDoTask::run(MM_EnvironmentBase *env)
 {
-	_heapWalker->allObjectsDoParallel(env, _function, _userData, _walkFlags);
+	if (NULL != _threadStart) {
+		_threadStart(env->getOmrVMThread(), _userData);
+	}
+	_heapWalker->allObjectsDoParallel(env, _function, _userData, _walkFlags, _partitionSize, _objectsFunction, _walkMarkedObjects);
 }
@@ -32,6 +32,16 @@ class MM_EnvironmentBase;
 class MM_ParallelGlobalGC;
 class MM_MarkMap;
 
+/**
+ * Called once by every thread taking part in a parallel walk, before it walks any object.
+ */
+typedef void (*MM_ParallelHeapWalkerThreadFunc)(OMR_VMThread *, void *);
+
+/**
+ * Called with each span of consecutive objects, in address order, that a thread finds in a parallel walk.
+ */
+typedef void (*MM_ParallelHeapWalkerObjectsFunc)(OMR_VMThread *, MM_HeapRegionDescriptor *, omrobjectptr_t *, uintptr_t, void *);
+
 class MM_ParallelHeapWalker : public MM_HeapWalker
 {
 	/*
@@ -51,8 +61,22 @@ protected:
 public:	
 	/**
 	 * Walk through all live objects of the heap in parallel and apply the provided function.
+	 * @param partitionSize size of the units of work the heap is split into, or 0 to derive it from the thread count.
+	 * Units smaller than a region can only be found while the mark map is valid, otherwise every region is a single unit.
+	 * @param objectsFunction if not NULL, called with each span of objects instead of calling function for every object
+	 * @param walkMarkedObjects set when exactly the live objects are marked, so they can be found from the mark map alone
+	 */
+	void allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, uintptr_t partitionSize = 0, MM_ParallelHeapWalkerObjectsFunc objectsFunction = NULL, bool walkMarkedObjects = false);
+
+	/**
+	 * Walk through all live objects of the heap on up to threadCount GC threads, splitting the heap into
+	 * units of partitionSize bytes (see allObjectsDoParallel), and pass them to objectsFunction a span at a
+	 * time. Each participating thread calls threadStart (if not NULL) before it walks its first unit. When
+	 * prepareHeapForWalk is set the mark done to prepare the heap also provides the partition boundaries,
+	 * and the objects are found from the mark map rather than by walking the heap. The caller must hold
+	 * exclusive VM access.
 	 */
-	void allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags);
+	void allObjectsDoPartitioned(MM_EnvironmentBase *env, MM_ParallelHeapWalkerObjectsFunc objectsFunction, MM_ParallelHeapWalkerThreadFunc threadStart, void *userData, uintptr_t walkFlags, uintptr_t partitionSize, uintptr_t threadCount, bool prepareHeapForWalk);
 
 	/**
 	 * Walk through all live objects of the heap and apply the provided function.
@@ -90,6 +90,15 @@ MM_ParallelMarkTask::cleanup(MM_EnvironmentBase *env)
 		env->_workPacketStats.workPacketsReleased,
 		env->_workPacketStats.workPacketsExchanged,
 		0/* TODO CRG figure out to get the array split size*/);
+
+	if (env->getExtensions()->workStealingMarking) {
+		Trc_MM_ParallelMarkTask_workStealingStats(
+			env->getLanguageVMThread(),
+			(uint32_t)env->getWorkerID(),
+			env->_workPacketStats._stealAttemptCount,
+			env->_workPacketStats.workPacketsStolen,
+			(uint32_t)omrtime_hires_delta(0, env->_workPacketStats._stealTime, OMRPORT_TIME_DELTA_IN_MILLISECONDS));
+	}
 }
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
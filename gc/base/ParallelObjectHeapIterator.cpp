@@ -33,6 +33,7 @@
 
 /**
  * Loop until either the end of the segment is hit, or a new chunk is acquired.
+ * Once the end is hit, the underlying iterator is left with nothing to walk.
  * @return true if a new chunk was acquired
  * @return false otherwise
  */
@@ -42,6 +43,11 @@ GC_ParallelObjectHeapIterator::getNextChunk()
 	/* Loop until we hit the last chunk, or we find one we are responsible for */
 	while (_segmentChunkIterator.nextChunk(_markMap, &_chunkBase, &_chunkTop)) {
 		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(_env)) {
+			if (_walkMarkedObjects) {
+				/* Only marked objects are walked, so each of them belongs to the chunk its mark bit is in */
+				_markedObjectIterator.reset(_markMap, _chunkBase, _chunkTop);
+				return true;
+			}
 			/* _chunkTop will be used later. Reseting the top address of the iterator to the end of the segment,
 			 * so that iteration of the current chunk may go beyond _chunkTop, until first marked object is found.
 			 * Thus we also iterate through dead objects at the begining of the each chunk. Dead objects at the
@@ -51,7 +57,12 @@ GC_ParallelObjectHeapIterator::getNextChunk()
 			return true;
 		}
 	}
-	return false;	
+	if (_walkMarkedObjects) {
+		_markedObjectIterator.reset(_markMap, _chunkTop, _chunkTop);
+	} else {
+		_objectHeapIterator.reset(NULL, NULL);
+	}
+	return false;
 }
 
 /**
@@ -62,6 +73,15 @@ GC_ParallelObjectHeapIterator::nextObject()
 {
 	omrobjectptr_t nextObject = NULL;
 
+	if (_walkMarkedObjects) {
+		while (NULL == (nextObject = _markedObjectIterator.nextObject())) {
+			if (!getNextChunk()) {
+				return NULL;
+			}
+		}
+		return nextObject;
+	}
+
 	while (true) {
 		/* Try to get the next object unless we hit end of the segment (what is the top address of the iterator) */
 		if (NULL == (nextObject = _objectHeapIterator.nextObject())) {
@@ -81,6 +101,48 @@ GC_ParallelObjectHeapIterator::nextObject()
 	}
 }
 
+/**
+ * @see GC_ObjectHeapBufferedIterator::nextObjects()
+ */
+uintptr_t
+GC_ParallelObjectHeapIterator::nextObjects(omrobjectptr_t **objects)
+{
+	uintptr_t count = 0;
+
+	if (_walkMarkedObjects) {
+		while (0 == (count = _markedObjectIterator.nextObjects(_markedObjects, MARKED_OBJECT_BATCH_SIZE))) {
+			if (!getNextChunk()) {
+				return 0;
+			}
+		}
+		*objects = _markedObjects;
+		return count;
+	}
+
+	while (true) {
+		if (_chunkComplete) {
+			_chunkComplete = false;
+			if (!getNextChunk()) {
+				return 0;
+			}
+		}
+		omrobjectptr_t *span = NULL;
+		if (0 == (count = _objectHeapIterator.nextObjects(&span))) {
+			return 0;
+		}
+		/* The chunk ends at the first marked object beyond its top, see nextObject() */
+		uintptr_t chunkCount = 0;
+		while ((chunkCount < count) && (((UDATA *)span[chunkCount] < _chunkTop) || !_markMap->isBitSet(span[chunkCount]))) {
+			chunkCount += 1;
+		}
+		_chunkComplete = (chunkCount < count);
+		if (0 != chunkCount) {
+			*objects = span;
+			return chunkCount;
+		}
+	}
+}
+
 /**
  * @see GC_ObjectHeapBufferedIterator::nextObjectNoAdvance()
  * @todo Provide implementation
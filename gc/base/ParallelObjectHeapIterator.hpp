@@ -33,6 +33,7 @@
 
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "HeapMapIterator.hpp"
 #include "MarkMapSegmentChunkIterator.hpp"
 #include "MemorySubSpace.hpp"
 #include "ObjectHeapBufferedIterator.hpp"
@@ -48,6 +49,9 @@ class MM_MarkMap;
  * segment before using this iterator.
  * @note Also assumes that the environment passed in has already been set up
  * with a parallel task, and worker threads are active.
+ * @note When every object in the segment is marked, and only those, the iterator can
+ * be told to walk the mark map alone.  Objects are then found without reading the heap
+ * and handed out in batches by nextObjects().
  * @ingroup GC_Base
  */
 class GC_ParallelObjectHeapIterator : public GC_ObjectHeapIterator
@@ -56,6 +60,10 @@ class GC_ParallelObjectHeapIterator : public GC_ObjectHeapIterator
 	 * Data members
 	 */
 private:
+	enum {
+		MARKED_OBJECT_BATCH_SIZE = 256 /**< Number of objects nextObjects() gathers at once from the mark map */
+	};
+
 	MM_EnvironmentBase *_env;
 	GC_ObjectHeapBufferedIterator _objectHeapIterator;
 	GC_MarkMapSegmentChunkIterator _segmentChunkIterator;
@@ -63,6 +71,10 @@ private:
 	MM_MarkMap *_markMap;
 	UDATA *_chunkBase;
 	UDATA *_chunkTop;
+	bool _chunkComplete; /**< set once nextObjects() has handed out the last object of the current chunk */
+	bool _walkMarkedObjects; /**< set to find objects from their mark bits rather than by walking the heap */
+	MM_HeapMapIterator _markedObjectIterator; /**< walks the current chunk when _walkMarkedObjects is set */
+	omrobjectptr_t _markedObjects[MARKED_OBJECT_BATCH_SIZE];
 
 protected:
 public:
@@ -75,11 +87,19 @@ private:
 protected:
 public:
 	virtual omrobjectptr_t nextObject();
+
+	/**
+	 * Hand out the next span of objects in the chunks this thread acquires, in address order.
+	 * @param[out] objects set to the first object of the span, which stays valid until the iterator is next used
+	 * @return the number of objects in the span, 0 once every chunk of the segment has been handed out
+	 * @see GC_ObjectHeapBufferedIterator::nextObjects()
+	 */
+	uintptr_t nextObjects(omrobjectptr_t **objects);
 	virtual omrobjectptr_t nextObjectNoAdvance();
 	virtual void advance(UDATA size);
 	virtual void reset(UDATA *base, UDATA *top);
 	
-	GC_ParallelObjectHeapIterator(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region, void *base, void *top, MM_MarkMap *markMap, UDATA parallelChunkSize)
+	GC_ParallelObjectHeapIterator(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region, void *base, void *top, MM_MarkMap *markMap, UDATA parallelChunkSize, bool walkMarkedObjects = false)
 		: GC_ObjectHeapIterator()
 		, _env(env)
 		, _objectHeapIterator(env->getExtensions(), region, base, top, false, 1)
@@ -88,12 +108,13 @@ public:
 		, _markMap(markMap)
 		, _chunkBase(NULL)
 		, _chunkTop(NULL)
+		, _chunkComplete(false)
+		, _walkMarkedObjects(walkMarkedObjects)
+		, _markedObjectIterator(env->getExtensions(), false)
 	{
 		/* Metronome currently has no notion of address-ordered-list */
 		Assert_MM_true(!env->getExtensions()->isMetronomeGC());
-		if (!getNextChunk()) {
-			_objectHeapIterator.reset(NULL, NULL);
-		}
+		getNextChunk();
 	}
 };
 
@@ -24,6 +24,9 @@
 #include "PhysicalSubArena.hpp"
 
 #include "Debug.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "MemoryMaintenanceThread.hpp"
 #include "PhysicalArena.hpp"
 
 /**
@@ -44,6 +47,20 @@ MM_PhysicalSubArena::tearDown(MM_EnvironmentBase *env)
 {
 }
 
+/**
+ * Decommit a range removed from the heap.
+ * With -Xgc:backgroundDecommit the range is handed to the memory maintenance thread so the pause does not pay for it,
+ * the thread's queue being full or the thread not running falls back to decommitting here.
+ */
+void
+MM_PhysicalSubArena::decommitMemory(MM_EnvironmentBase *env, void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress)
+{
+	MM_MemoryMaintenanceThread *maintenanceThread = env->getExtensions()->memoryMaintenanceThread;
+	if ((NULL == maintenanceThread) || !maintenanceThread->deferDecommit(env, _heap, address, size, lowValidAddress, highValidAddress)) {
+		_heap->decommitMemory(address, size, lowValidAddress, highValidAddress);
+	}
+}
+
 /**
  * Determine whether the sub arena is allowed to expand.
  * The generic implementation forwards the request to the parent, or returns true if there is none.
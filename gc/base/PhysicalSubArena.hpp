@@ -69,6 +69,11 @@ protected:
 	/* a helper to get the root region manager from the heap, since it was needed in so many place */
 	MM_HeapRegionManager *getHeapRegionManager() {return _heap->getHeapRegionManager();}
 
+	/**
+	 * Decommit a range the receiver has removed from the heap, leaving it to the memory maintenance thread if there is one.
+	 */
+	void decommitMemory(MM_EnvironmentBase *env, void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress);
+
 public:
 	virtual void kill(MM_EnvironmentBase *env) = 0;
 
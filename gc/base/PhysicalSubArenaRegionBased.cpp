@@ -167,7 +167,7 @@ MM_PhysicalSubArenaRegionBased::doContractInSubSpace(MM_EnvironmentBase *env, ui
 		void *highValidAddress = manager->findLowestValidAddressAbove(regionToRelease);
 		
 		/* decommits the memory */
-		_heap->decommitMemory(contractBase, regionSize, lowValidAddress, highValidAddress);
+		decommitMemory(env, contractBase, regionSize, lowValidAddress, highValidAddress);
 		
 		void *contractTop = (void *)(((uintptr_t)contractBase) + regionSize);
 		/* Broadcast that heap has been removed */
@@ -240,6 +240,7 @@ MM_PhysicalSubArenaRegionBased::doExpandInSubSpace(MM_EnvironmentBase *env, uint
 			break;
 		}
 
+		manager->recordPageBacking(env, newRegion);
 		didExpandBy += regionSize;
 
 		/* Ensures that expansion is single-threaded */
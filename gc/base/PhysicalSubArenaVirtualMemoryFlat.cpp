@@ -308,7 +308,7 @@ MM_PhysicalSubArenaVirtualMemoryFlat::contract(MM_EnvironmentBase *env, uintptr_
 	genericSubSpace->removeExistingMemory(env, this, contractSize, (void *)contractBase, (void *)contractTop);
 
 	/* Everything is ok - decommit the memory */
-	_heap->decommitMemory((void *)contractBase, contractSize, lowValidAddress, highValidAddress);
+	decommitMemory(env, (void *)contractBase, contractSize, lowValidAddress, highValidAddress);
 
 	/* Success - the area has been contracted.  Update internal values */
 	_highAddress = (void *)contractBase;
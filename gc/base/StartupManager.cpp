@@ -27,6 +27,7 @@
 #if defined(OMR_GC)
 #include "GCExtensionsBase.hpp"
 #include "ConfigurationFlat.hpp"
+#include "Math.hpp"
 #endif /* OMR_GC */
 
 #define OMR_GC_BUFFER_SIZE 256
@@ -37,6 +38,10 @@
 #if defined(OMR_GC_MODRON_COMPACTION)
 #define OMR_XCOMPACTGC "-Xcompactgc"
 #define OMR_XCOMPACTGC_LENGTH 11
+#define OMR_XGCINCREMENTAL_COMPACT_BUDGET "-Xgc:incrementalCompactBudget="
+#define OMR_XGCINCREMENTAL_COMPACT_BUDGET_LENGTH 30
+#define OMR_XGCINCREMENTAL_COMPACT_RANGES "-Xgc:incrementalCompactRanges="
+#define OMR_XGCINCREMENTAL_COMPACT_RANGES_LENGTH 30
 #endif /* OMR_GC_MODRON_COMPACTION */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 #define OMR_XGCPOLICY "-Xgcpolicy:"
@@ -48,6 +53,62 @@
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCBINARY_LOGGING_BUFFER_SIZE "-Xgc:binaryLoggingBufferSize="
+#define OMR_XGCBINARY_LOGGING_BUFFER_SIZE_LENGTH 29
+#define OMR_XGCBINARY_LOGGING "-Xgc:binaryLogging"
+#define OMR_XGCBINARY_LOGGING_LENGTH 18
+#define OMR_XGCFREELIST_SIZE_CLASS_INDEX "-Xgc:freeListSizeClassIndex"
+#define OMR_XGCFREELIST_SIZE_CLASS_INDEX_LENGTH 27
+#define OMR_XGCWORK_STEALING_MARKING "-Xgc:workStealingMarking"
+#define OMR_XGCWORK_STEALING_MARKING_LENGTH 24
+#define OMR_XGCNO_VECTOR_HEAP_MAP_SCAN "-Xgc:noVectorHeapMapScan"
+#define OMR_XGCNO_VECTOR_HEAP_MAP_SCAN_LENGTH 24
+#define OMR_XGCSCAN_PREFETCH_DISTANCE "-Xgc:scanPrefetchDistance="
+#define OMR_XGCSCAN_PREFETCH_DISTANCE_LENGTH 26
+#define OMR_XGCMIXED_PAGE_SIZE_HEAP "-Xgc:mixedPageSizeHeap"
+#define OMR_XGCMIXED_PAGE_SIZE_HEAP_LENGTH 22
+#define OMR_XGCBACKGROUND_DECOMMIT_CPU_PERCENT "-Xgc:backgroundDecommitCPUPercent="
+#define OMR_XGCBACKGROUND_DECOMMIT_CPU_PERCENT_LENGTH 34
+#define OMR_XGCBACKGROUND_DECOMMIT "-Xgc:backgroundDecommit"
+#define OMR_XGCBACKGROUND_DECOMMIT_LENGTH 23
+#define OMR_XGCALLOCATION_SAMPLING_INTERVAL "-Xgc:allocationSamplingInterval="
+#define OMR_XGCALLOCATION_SAMPLING_INTERVAL_LENGTH 32
+#define OMR_XGCALLOCATION_SAMPLING "-Xgc:allocationSampling"
+#define OMR_XGCALLOCATION_SAMPLING_LENGTH 23
+#define OMR_XGCHEAP_SIZING_COST_MODEL "-Xgc:heapSizingCostModel"
+#define OMR_XGCHEAP_SIZING_COST_MODEL_LENGTH 24
+#define OMR_XGCHEAP_SIZING_PAUSE_TARGET "-Xgc:heapSizingPauseTarget="
+#define OMR_XGCHEAP_SIZING_PAUSE_TARGET_LENGTH 27
+#define OMR_XGCHEAP_SIZING_CONTAINER_PERCENT "-Xgc:heapSizingContainerPercent="
+#define OMR_XGCHEAP_SIZING_CONTAINER_PERCENT_LENGTH 32
+#define OMR_XGCSCAVENGER_NUMA_AFFINITY "-Xgc:scavengerNumaAffinity"
+#define OMR_XGCSCAVENGER_NUMA_AFFINITY_LENGTH 26
+#define OMR_XGCREMEMBERED_SET_PUDDLE_BATCH "-Xgc:rememberedSetPuddleBatch="
+#define OMR_XGCREMEMBERED_SET_PUDDLE_BATCH_LENGTH 30
+#define OMR_XGCREMEMBERED_SET_MAX_FRAGMENT_SIZE "-Xgc:rememberedSetMaxFragmentSize="
+#define OMR_XGCREMEMBERED_SET_MAX_FRAGMENT_SIZE_LENGTH 34
+#define OMR_XGCSCV_TENURE_STRATEGY_PREDICTIVE "-Xgc:scvTenureStrategyPredictive"
+#define OMR_XGCSCV_TENURE_STRATEGY_PREDICTIVE_LENGTH 32
+#define OMR_XGCSCV_TENURE_PREDICTOR_HORIZON "-Xgc:scvTenurePredictorHorizon="
+#define OMR_XGCSCV_TENURE_PREDICTOR_HORIZON_LENGTH 31
+#define OMR_XGCSCV_TENURE_PREDICTOR_PROMOTION_COST "-Xgc:scvTenurePredictorPromotionCost="
+#define OMR_XGCSCV_TENURE_PREDICTOR_PROMOTION_COST_LENGTH 37
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#define OMR_XGCLAZY_SWEEP_SEGREGATED "-Xgc:lazySweepSegregated"
+#define OMR_XGCLAZY_SWEEP_SEGREGATED_LENGTH 24
+#define OMR_XGCREGION_LIST_SHARDS "-Xgc:regionListShards="
+#define OMR_XGCREGION_LIST_SHARDS_LENGTH 22
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+#define OMR_XGCADAPTIVE_TLH_SIZING "-Xgc:adaptiveTLHSizing"
+#define OMR_XGCADAPTIVE_TLH_SIZING_LENGTH 22
+#define OMR_XGCTLH_WASTE_TARGET "-Xgc:tlhWasteTarget="
+#define OMR_XGCTLH_WASTE_TARGET_LENGTH 20
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#define OMR_XGCDIRTY_CARD_SUMMARY "-Xgc:dirtyCardSummary"
+#define OMR_XGCDIRTY_CARD_SUMMARY_LENGTH 21
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
 
@@ -264,6 +325,22 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		extensions->nocompactOnSystemGC = 0;
 		extensions->compactOnSystemGC = 0;
 	}
+	else if (0 == strncmp(option, OMR_XGCINCREMENTAL_COMPACT_BUDGET, OMR_XGCINCREMENTAL_COMPACT_BUDGET_LENGTH)) {
+		uintptr_t value = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCINCREMENTAL_COMPACT_BUDGET_LENGTH, &value)) {
+			result = false;
+		} else {
+			extensions->incrementalCompactBudget = value;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCINCREMENTAL_COMPACT_RANGES, OMR_XGCINCREMENTAL_COMPACT_RANGES_LENGTH)) {
+		uintptr_t value = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCINCREMENTAL_COMPACT_RANGES_LENGTH, &value)) || (0 == value)) {
+			result = false;
+		} else {
+			extensions->incrementalCompactMaxRanges = value;
+		}
+	}
 #endif /* OMR_GC_MODRON_COMPACTION */
 	else if (0 == strncmp(option, OMR_XVERBOSEGCLOG, OMR_XVERBOSEGCLOG_LENGTH)) {
 		verboseFileName = (char *) omrmem_allocate_memory(strlen(option+OMR_XVERBOSEGCLOG_LENGTH)+1, OMRMEM_CATEGORY_MM);
@@ -276,6 +353,129 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
 	}
+	else if (0 == strncmp(option, OMR_XGCBINARY_LOGGING_BUFFER_SIZE, OMR_XGCBINARY_LOGGING_BUFFER_SIZE_LENGTH)) {
+		if (!getUDATAMemoryValue(option + OMR_XGCBINARY_LOGGING_BUFFER_SIZE_LENGTH, &extensions->binaryLoggingBufferSize)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCBINARY_LOGGING, OMR_XGCBINARY_LOGGING_LENGTH)) {
+		extensions->binaryLogging = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCFREELIST_SIZE_CLASS_INDEX, OMR_XGCFREELIST_SIZE_CLASS_INDEX_LENGTH)) {
+		extensions->freeListSizeClassIndex = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCWORK_STEALING_MARKING, OMR_XGCWORK_STEALING_MARKING_LENGTH)) {
+		extensions->workStealingMarking = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCNO_VECTOR_HEAP_MAP_SCAN, OMR_XGCNO_VECTOR_HEAP_MAP_SCAN_LENGTH)) {
+		extensions->vectorHeapMapScan = false;
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAN_PREFETCH_DISTANCE, OMR_XGCSCAN_PREFETCH_DISTANCE_LENGTH)) {
+		if ((0 >= getUDATAValue(option + OMR_XGCSCAN_PREFETCH_DISTANCE_LENGTH, &extensions->scanPrefetchDistance)) || (MM_SCAN_PREFETCH_DISTANCE_MAX < extensions->scanPrefetchDistance)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCMIXED_PAGE_SIZE_HEAP, OMR_XGCMIXED_PAGE_SIZE_HEAP_LENGTH)) {
+		extensions->mixedPageSizeHeap = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCBACKGROUND_DECOMMIT_CPU_PERCENT, OMR_XGCBACKGROUND_DECOMMIT_CPU_PERCENT_LENGTH)) {
+		uintptr_t value = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCBACKGROUND_DECOMMIT_CPU_PERCENT_LENGTH, &value)) || (0 == value) || (100 < value)) {
+			result = false;
+		} else {
+			extensions->backgroundDecommitCPUPercent = value;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCBACKGROUND_DECOMMIT, OMR_XGCBACKGROUND_DECOMMIT_LENGTH)) {
+		extensions->backgroundDecommit = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCALLOCATION_SAMPLING_INTERVAL, OMR_XGCALLOCATION_SAMPLING_INTERVAL_LENGTH)) {
+		uintptr_t value = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCALLOCATION_SAMPLING_INTERVAL_LENGTH, &value) || (0 == value)) {
+			result = false;
+		} else {
+			extensions->allocationSamplingInterval = value;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCALLOCATION_SAMPLING, OMR_XGCALLOCATION_SAMPLING_LENGTH)) {
+		extensions->allocationSampling = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCHEAP_SIZING_COST_MODEL, OMR_XGCHEAP_SIZING_COST_MODEL_LENGTH)) {
+		extensions->heapSizingCostModel = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCHEAP_SIZING_PAUSE_TARGET, OMR_XGCHEAP_SIZING_PAUSE_TARGET_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCHEAP_SIZING_PAUSE_TARGET_LENGTH, &extensions->heapSizingPauseTarget)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCHEAP_SIZING_CONTAINER_PERCENT, OMR_XGCHEAP_SIZING_CONTAINER_PERCENT_LENGTH)) {
+		uintptr_t value = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCHEAP_SIZING_CONTAINER_PERCENT_LENGTH, &value)) || (0 == value) || (100 < value)) {
+			result = false;
+		} else {
+			extensions->heapSizingContainerPercent = value;
+		}
+	}
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_NUMA_AFFINITY, OMR_XGCSCAVENGER_NUMA_AFFINITY_LENGTH)) {
+		extensions->scavengerNumaAffinity = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCREMEMBERED_SET_PUDDLE_BATCH, OMR_XGCREMEMBERED_SET_PUDDLE_BATCH_LENGTH)) {
+		if ((0 >= getUDATAValue(option + OMR_XGCREMEMBERED_SET_PUDDLE_BATCH_LENGTH, &extensions->rememberedSetPuddleBatch)) || (0 == extensions->rememberedSetPuddleBatch)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCREMEMBERED_SET_MAX_FRAGMENT_SIZE, OMR_XGCREMEMBERED_SET_MAX_FRAGMENT_SIZE_LENGTH)) {
+		uintptr_t value = 0;
+		/* fragments hold whole slots and start at OMR_SCV_REMSET_FRAGMENT_SIZE bytes */
+		if (!getUDATAMemoryValue(option + OMR_XGCREMEMBERED_SET_MAX_FRAGMENT_SIZE_LENGTH, &value) || (value < OMR_SCV_REMSET_FRAGMENT_SIZE)) {
+			result = false;
+		} else {
+			extensions->rememberedSetMaxFragmentSize = MM_Math::roundToFloor(sizeof(uintptr_t), value);
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSCV_TENURE_STRATEGY_PREDICTIVE, OMR_XGCSCV_TENURE_STRATEGY_PREDICTIVE_LENGTH)) {
+		extensions->scvTenureStrategyPredictive = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSCV_TENURE_PREDICTOR_HORIZON, OMR_XGCSCV_TENURE_PREDICTOR_HORIZON_LENGTH)) {
+		if ((0 >= getUDATAValue(option + OMR_XGCSCV_TENURE_PREDICTOR_HORIZON_LENGTH, &extensions->scvTenurePredictorHorizon)) || (0 == extensions->scvTenurePredictorHorizon)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSCV_TENURE_PREDICTOR_PROMOTION_COST, OMR_XGCSCV_TENURE_PREDICTOR_PROMOTION_COST_LENGTH)) {
+		if ((0 >= getUDATAValue(option + OMR_XGCSCV_TENURE_PREDICTOR_PROMOTION_COST_LENGTH, &extensions->scvTenurePredictorPromotionCost)) || (0 == extensions->scvTenurePredictorPromotionCost)) {
+			result = false;
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	else if (0 == strncmp(option, OMR_XGCLAZY_SWEEP_SEGREGATED, OMR_XGCLAZY_SWEEP_SEGREGATED_LENGTH)) {
+		extensions->lazySweepSegregated = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCREGION_LIST_SHARDS, OMR_XGCREGION_LIST_SHARDS_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCREGION_LIST_SHARDS_LENGTH, &extensions->regionListShardCount)) {
+			result = false;
+		}
+	}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	else if (0 == strncmp(option, OMR_XGCADAPTIVE_TLH_SIZING, OMR_XGCADAPTIVE_TLH_SIZING_LENGTH)) {
+		extensions->tlhAdaptiveSizing = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCTLH_WASTE_TARGET, OMR_XGCTLH_WASTE_TARGET_LENGTH)) {
+		uintptr_t value = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCTLH_WASTE_TARGET_LENGTH, &value)) || (0 == value) || (100 < value)) {
+			result = false;
+		} else {
+			extensions->tlhAdaptiveWasteTarget = value;
+		}
+	}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	else if (0 == strncmp(option, OMR_XGCDIRTY_CARD_SUMMARY, OMR_XGCDIRTY_CARD_SUMMARY_LENGTH)) {
+		extensions->dirtyCardSummary = true;
+	}
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 #if defined(OMR_GC_MORDON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
 		char *gcpolicy = option + OMR_XGCPOLICY_LENGTH;
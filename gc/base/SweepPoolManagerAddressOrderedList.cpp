@@ -22,6 +22,10 @@
 
 #include "SweepPoolManagerAddressOrderedList.hpp"
 
+#include "MemoryPoolAddressOrderedList.hpp"
+#include "ParallelSweepChunk.hpp"
+#include "SweepPoolState.hpp"
+
 /**
  * Allocate and initialize a new instance of the receiver.
  * @return a new instance of the receiver, or NULL on failure.
@@ -42,3 +46,54 @@ MM_SweepPoolManagerAddressOrderedList::newInstance(MM_EnvironmentBase *env)
 
 	return sweepPoolManager;
 }
+
+/**
+ * Connect a chunk into the free list and populate the size classes of the pool's
+ * size class index that are now satisfied by a connected free entry.
+ * The previous free entry may still grow by coalescing with the chunk, so the index
+ * can only be populated up to the entry before it.
+ */
+void
+MM_SweepPoolManagerAddressOrderedList::connectChunk(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk)
+{
+	MM_MemoryPoolAddressOrderedList *memoryPool = (MM_MemoryPoolAddressOrderedList *)chunk->memoryPool;
+	MM_SweepPoolState *sweepState = getPoolState(memoryPool);
+	MM_HeapLinkedFreeHeader *previousPreviousFreeEntry = sweepState->_connectPreviousPreviousFreeEntry;
+
+	MM_SweepPoolManagerAddressOrderedListBase::connectChunk(env, chunk);
+
+	if (memoryPool->_sizeClassIndexEnabled) {
+		memoryPool->populateSizeClassIndex(previousPreviousFreeEntry, sweepState->_largestFreeEntry);
+	}
+}
+
+/**
+ * Flush the trailing free entry of the last chunk and populate the size classes it satisfies.
+ */
+void
+MM_SweepPoolManagerAddressOrderedList::flushFinalChunk(MM_EnvironmentBase *envModron, MM_MemoryPool *memoryPoolBase)
+{
+	MM_MemoryPoolAddressOrderedList *memoryPool = (MM_MemoryPoolAddressOrderedList *)memoryPoolBase;
+	MM_SweepPoolState *sweepState = getPoolState(memoryPool);
+	MM_HeapLinkedFreeHeader *previousFreeEntry = sweepState->_connectPreviousFreeEntry;
+
+	MM_SweepPoolManagerAddressOrderedListBase::flushFinalChunk(envModron, memoryPoolBase);
+
+	if (memoryPool->_sizeClassIndexEnabled) {
+		memoryPool->populateSizeClassIndex(previousFreeEntry, sweepState->_largestFreeEntry);
+	}
+}
+
+/**
+ * Terminate the free list and point the size classes no free entry can satisfy at its last entry.
+ */
+void
+MM_SweepPoolManagerAddressOrderedList::connectFinalChunk(MM_EnvironmentBase *envModron, MM_MemoryPool *memoryPoolBase)
+{
+	MM_SweepPoolManagerAddressOrderedListBase::connectFinalChunk(envModron, memoryPoolBase);
+
+	MM_MemoryPoolAddressOrderedList *memoryPool = (MM_MemoryPoolAddressOrderedList *)memoryPoolBase;
+	if (memoryPool->_sizeClassIndexEnabled) {
+		memoryPool->completeSizeClassIndex(getPoolState(memoryPool)->_connectPreviousFreeEntry);
+	}
+}
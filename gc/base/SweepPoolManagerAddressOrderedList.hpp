@@ -48,6 +48,10 @@ public:
 
 	static MM_SweepPoolManagerAddressOrderedList *newInstance(MM_EnvironmentBase *env);
 
+	virtual void connectChunk(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk);
+	virtual void flushFinalChunk(MM_EnvironmentBase *envModron, MM_MemoryPool *memoryPool);
+	virtual void connectFinalChunk(MM_EnvironmentBase *envModron, MM_MemoryPool *memoryPool);
+
 	/**
 	 * Create a SweepPoolManager object.
 	 */
@@ -36,6 +36,7 @@
 
 #include "AllocateDescription.hpp"
 #include "AllocationContext.hpp"
+#include "AllocationSampler.hpp"
 #include "EnvironmentBase.hpp"
 #include "Forge.hpp"
 #include "FrequentObjectsStats.hpp"
@@ -211,6 +212,11 @@ MM_TLHAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_AllocateDe
 	uintptr_t sizeInBytesAllocated = (_stats.bytesAllocated(false) - _bytesAllocatedBase);
 	env->_oolTraceAllocationBytes += sizeInBytesAllocated;
 	env->_traceAllocationBytes += sizeInBytesAllocated;
+
+	MM_AllocationSampler *allocationSampler = env->getExtensions()->allocationSampler;
+	if ((NULL != allocationSampler) && (NULL != result)) {
+		allocationSampler->allocated(env, sizeInBytesAllocated, allocDescription->getContiguousBytes());
+	}
 	return result;
 }
 
@@ -304,6 +310,21 @@ MM_TLHAllocationInterface::flushCache(MM_EnvironmentBase *env)
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
 }
 
+void
+MM_TLHAllocationInterface::updateTLHSizing(MM_EnvironmentBase *env)
+{
+	MM_TLHSizingStats intervalStats;
+	bool updated = _tlhAllocationSupport.updateRefreshSizeLimit(env, &intervalStats);
+
+#if defined(OMR_GC_NON_ZERO_TLH)
+	updated = _tlhAllocationSupportNonZero.updateRefreshSizeLimit(env, &intervalStats) || updated;
+#endif /* defined(OMR_GC_NON_ZERO_TLH) */
+
+	if (updated) {
+		_tlhSizingStats = intervalStats;
+	}
+}
+
 void
 MM_TLHAllocationInterface::restartCache(MM_EnvironmentBase *env)
 {
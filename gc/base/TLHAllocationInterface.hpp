@@ -63,6 +63,7 @@ private:
 
 	bool _cachedAllocationsEnabled; /**< Are cached allocations enabled? */
 	uintptr_t _bytesAllocatedBase; /**< Bytes allocated at the start of an allocation request.  Relative to _stats.bytesAllocated(). */
+	MM_TLHSizingStats _tlhSizingStats; /**< TLH usage of the last sizing interval, cleared once reported */
 
 public:
 	static MM_TLHAllocationInterface *newInstance(MM_EnvironmentBase *env);
@@ -77,6 +78,9 @@ public:
 
 	virtual void flushCache(MM_EnvironmentBase *env);
 	virtual void restartCache(MM_EnvironmentBase *env);
+
+	virtual void updateTLHSizing(MM_EnvironmentBase *env);
+	virtual MM_TLHSizingStats *getTLHSizingStats() { return &_tlhSizingStats; }
 	
 	/* BEN TODO: Collapse the env->enable/disableInlineTLHAllocate with these enable/disableCachedAllocations */
 	virtual void enableCachedAllocations(MM_EnvironmentBase* env) { _cachedAllocationsEnabled = true; }
@@ -102,7 +106,8 @@ private:
 		_tlhAllocationSupportNonZero(env, false),
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
 		_cachedAllocationsEnabled(true),
-		_bytesAllocatedBase(0)
+		_bytesAllocatedBase(0),
+		_tlhSizingStats()
 	{
 		_typeId = __FUNCTION__;
 		_tlhAllocationSupport._objectAllocationInterface = this;
@@ -25,6 +25,7 @@
  * @ingroup GC_Base_Core
  */
 
+#include <math.h>
 #include <string.h>
 
 #include "omrcfg.h"
@@ -120,6 +121,11 @@ MM_TLHAllocationSupport::clear(MM_EnvironmentBase *env)
 	}
 
 	_tlh->refreshSize = extensions->tlhInitialSize;
+
+	if (0 == _sizingIntervalStart) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		_sizingIntervalStart = omrtime_hires_clock();
+	}
 }
 
 /**
@@ -159,7 +165,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 	 */
 	uintptr_t sizeInBytesRequired = allocDescription->getContiguousBytes();
 	uintptr_t tlhMinimumSize = extensions->tlhMinimumSize;
-	uintptr_t tlhMaximumSize = extensions->tlhMaximumSize;
+	uintptr_t tlhMaximumSize = getRefreshSizeLimit(extensions);
 	uintptr_t halfRefreshSize = getRefreshSize() >> 1;
 	uintptr_t abandonSize = (tlhMinimumSize > halfRefreshSize ? tlhMinimumSize : halfRefreshSize);
 	if (sizeInBytesRequired > abandonSize) {
@@ -175,6 +181,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 	stats->_tlhDiscardedBytes += getRemainingSize();
 	uintptr_t usedSize = getUsedSize();
 	stats->_tlhAllocatedUsed += usedSize;
+	_sizingStats._allocatedBytes += usedSize;
 
 	/* Try to cache the current TLH */
 	if ((NULL != getRealTop()) && (getRemainingSize() >= tlhMinimumSize)) {
@@ -195,6 +202,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 		}
 		wipeTLH(env);
 	} else {
+		_sizingStats._refreshDiscardedBytes += getRemainingSize();
 		clear(env);
 	}
 
@@ -281,6 +289,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 		if (0 < getSize()) {
 			reportRefreshCache(env);
 			stats->_tlhRequestedBytes += getRefreshSize();
+			_sizingStats._refreshCount += 1;
 			/* TODO VMDESIGN 1322: adjust the amount consumed by the TLH refresh since a TLH refresh
 			 * may not give you the size requested */
 			/* Increase thread hungriness */
@@ -295,6 +304,75 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 }
 
 
+bool
+MM_TLHAllocationSupport::updateRefreshSizeLimit(MM_EnvironmentBase *env, MM_TLHSizingStats *intervalStats)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	bool const compressed = extensions->compressObjectReferences();
+
+	/* the flush which follows drops the current TLH remainder along with every cached TLH */
+	uintptr_t flushDiscarded = getRemainingSize();
+	MM_HeapLinkedFreeHeaderTLH *cached = _abandonedList;
+	while (NULL != cached) {
+		flushDiscarded += cached->getSize();
+		cached = (MM_HeapLinkedFreeHeaderTLH *)cached->getNext(compressed);
+	}
+	_sizingStats._allocatedBytes += getUsedSize();
+	_sizingStats._flushDiscardedBytes += flushDiscarded;
+
+	if ((0 == _sizingStats._allocatedBytes) && (0 == _sizingStats.getDiscardedBytes())) {
+		/* idle thread, or caches flushed more than once for the same GC */
+		return false;
+	}
+
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t now = omrtime_hires_clock();
+	_sizingStats._intervalMicros = omrtime_hires_delta(_sizingIntervalStart, now, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	_sizingIntervalStart = now;
+
+	if (0 != _sizingStats._allocatedBytes) {
+		_refreshSizeLimit = calculateRefreshSizeLimit(extensions, &_sizingStats);
+		if (getRefreshSize() > _refreshSizeLimit) {
+			setRefreshSize(_refreshSizeLimit);
+		}
+	}
+	_sizingStats._refreshSizeLimit = _refreshSizeLimit;
+
+	intervalStats->merge(&_sizingStats);
+	_sizingStats.clear();
+	return true;
+}
+
+/**
+ * A thread which fills A bytes of TLHs of size R drops R/2 on average when its caches are flushed
+ * for GC, plus the mean refresh remainder d at each of its A/R refreshes.  The limit is the largest
+ * R for which R/2 + A*d/R stays within the waste target T*A:
+ *     R = T*A + sqrt((T*A)^2 - 2*A*d)
+ * When the target cannot be met, the size which wastes least, sqrt(2*A*d), is used instead.
+ * @return the refresh size limit, between tlhMinimumSize and tlhMaximumSize
+ */
+uintptr_t
+MM_TLHAllocationSupport::calculateRefreshSizeLimit(MM_GCExtensionsBase *extensions, MM_TLHSizingStats *stats)
+{
+	double allocated = (double)stats->_allocatedBytes;
+	double meanRefreshDiscard = (0 == stats->_refreshCount) ? 0.0 : ((double)stats->_refreshDiscardedBytes / (double)stats->_refreshCount);
+	double wasteBudget = allocated * (double)extensions->tlhAdaptiveWasteTarget / 100.0;
+	double discriminant = (wasteBudget * wasteBudget) - (2.0 * allocated * meanRefreshDiscard);
+
+	double limit = 0.0;
+	if (discriminant >= 0.0) {
+		limit = wasteBudget + sqrt(discriminant);
+	} else {
+		limit = sqrt(2.0 * allocated * meanRefreshDiscard);
+	}
+
+	uintptr_t result = extensions->tlhMaximumSize;
+	if (limit < (double)extensions->tlhMaximumSize) {
+		result = OMR_MAX(extensions->tlhMinimumSize, MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)limit));
+	}
+	return result;
+}
+
 /**
  * Attempt to allocate an object in this TLH.
  */
@@ -38,6 +38,7 @@
 #include "EnvironmentBase.hpp"
 #include "HeapLinkedFreeHeader.hpp"
 #include "LanguageThreadLocalHeap.hpp"
+#include "TLHSizingStats.hpp"
 #if defined(OMR_GC_OBJECT_MAP)
 #include "ObjectMap.hpp"
 #endif /* defined(OMR_GC_OBJECT_MAP) */
@@ -83,6 +84,10 @@ private:
 
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
+	MM_TLHSizingStats _sizingStats; /**< TLH usage since the caches were last flushed for GC */
+	uintptr_t _refreshSizeLimit; /**< Largest refresh size when adaptive TLH sizing is enabled */
+	uint64_t _sizingIntervalStart; /**< Hi-res clock at the start of the current sizing interval */
+
 public:
 protected:
 private:
@@ -178,6 +183,26 @@ private:
 
 	void updateFrequentObjectsStats(MM_EnvironmentBase *env);
 
+	/**
+	 * @return the largest size the refresh size may grow to
+	 */
+	MMINLINE uintptr_t
+	getRefreshSizeLimit(MM_GCExtensionsBase *extensions)
+	{
+		return extensions->tlhAdaptiveSizing ? _refreshSizeLimit : extensions->tlhMaximumSize;
+	}
+
+	/**
+	 * Close the current sizing interval and derive the refresh size limit for the next one.
+	 * Must be called before the caches are flushed for GC, so that the remainders dropped by the
+	 * flush are accounted for.
+	 * @param intervalStats[out] receives the usage of the interval
+	 * @return false if the TLH was not used during the interval (nothing is updated)
+	 */
+	bool updateRefreshSizeLimit(MM_EnvironmentBase *env, MM_TLHSizingStats *intervalStats);
+
+	static uintptr_t calculateRefreshSizeLimit(MM_GCExtensionsBase *extensions, MM_TLHSizingStats *stats);
+
 	/**
 	 * Create a ThreadLocalHeap object.
 	 */
@@ -191,7 +216,10 @@ private:
 		_objectAllocationInterface(NULL),
 		_abandonedList(NULL),
 		_abandonedListSize(0),
-		_zeroTLH(zeroTLH)
+		_zeroTLH(zeroTLH),
+		_sizingStats(),
+		_refreshSizeLimit(env->getExtensions()->tlhMaximumSize),
+		_sizingIntervalStart(0)
 	{};
 
 	/*
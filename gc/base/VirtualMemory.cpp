@@ -219,7 +219,22 @@ MM_VirtualMemory::commitMemory(void* address, uintptr_t size)
 	}
 
 	if (0 < commitSize) {
-		success = omrvmem_commit_memory(commitBase, commitSize, &_identifier) != 0;
+		if (NULL == _largePageBacking) {
+			success = omrvmem_commit_memory(commitBase, commitSize, &_identifier) != 0;
+		} else {
+			uintptr_t base = (uintptr_t)commitBase;
+			uintptr_t top = base + commitSize;
+			backLargePageChunks(base, top);
+			while (success && (base < top)) {
+				uintptr_t backing = OMRPORT_VMEM_PAGE_BACKING_DEFAULT;
+				uintptr_t runTop = getPageBackingRun(base, top, &backing);
+				/* explicit large pages are accessible as soon as they are mapped */
+				if (OMRPORT_VMEM_PAGE_BACKING_EXPLICIT != backing) {
+					success = omrvmem_commit_memory((void*)base, runTop - base, &_identifier) != 0;
+				}
+				base = runTop;
+			}
+		}
 	}
 
 	if (success) {
@@ -272,12 +287,126 @@ MM_VirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowValidAd
 	if (decommitBase < decommitTop) {
 		/* There is still memory to decommit, calculate size */
 		uintptr_t decommitSize = ((uintptr_t)decommitTop) - ((uintptr_t)decommitBase);
-		result = omrvmem_decommit_memory(decommitBase, decommitSize, &_identifier) == 0;
+		if (NULL == _largePageBacking) {
+			result = omrvmem_decommit_memory(decommitBase, decommitSize, &_identifier) == 0;
+		} else {
+			uintptr_t base = (uintptr_t)decommitBase;
+			uintptr_t top = (uintptr_t)decommitTop;
+			while (base < top) {
+				uintptr_t backing = OMRPORT_VMEM_PAGE_BACKING_DEFAULT;
+				uintptr_t runTop = getPageBackingRun(base, top, &backing);
+				/* explicit large pages can not be given back one default page at a time, they stay committed */
+				if (OMRPORT_VMEM_PAGE_BACKING_EXPLICIT != backing) {
+					result = (omrvmem_decommit_memory((void*)base, runTop - base, &_identifier) == 0) && result;
+				}
+				base = runTop;
+			}
+		}
 	}
 
 	return result;
 }
 
+bool
+MM_VirtualMemory::enableMixedPageBacking(MM_EnvironmentBase* env, uintptr_t largePageSize)
+{
+	Assert_MM_true(NULL == _largePageBacking);
+	Assert_MM_true(NULL != _baseAddress);
+
+	uintptr_t reserveBase = (uintptr_t)_baseAddress;
+	uintptr_t reserveTop = reserveBase + _reserveSize;
+	if ((largePageSize <= _pageSize) || (reserveTop < reserveBase)) {
+		/* nothing to mix, or the block wraps the top of the address range */
+		return false;
+	}
+
+	uintptr_t largePageBase = MM_Math::roundToCeiling(largePageSize, reserveBase);
+	uintptr_t largePageTop = MM_Math::roundToFloor(largePageSize, reserveTop);
+	if (largePageBase >= largePageTop) {
+		/* the block does not hold a single whole large page */
+		return false;
+	}
+
+	uintptr_t largePageCount = (largePageTop - largePageBase) / largePageSize;
+	_largePageBacking = (uint8_t*)env->getForge()->allocate(largePageCount * sizeof(uint8_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _largePageBacking) {
+		return false;
+	}
+	memset(_largePageBacking, VIRTUAL_MEMORY_PAGE_BACKING_UNDECIDED, largePageCount * sizeof(uint8_t));
+	_largePageSize = largePageSize;
+	_largePageBase = largePageBase;
+	_largePageCount = largePageCount;
+
+	return true;
+}
+
+void
+MM_VirtualMemory::backLargePageChunks(uintptr_t base, uintptr_t top)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+	uintptr_t largePageTop = _largePageBase + (_largePageCount * _largePageSize);
+
+	if ((base < largePageTop) && (top > _largePageBase)) {
+		uintptr_t first = (OMR_MAX(base, _largePageBase) - _largePageBase) / _largePageSize;
+		uintptr_t last = (OMR_MIN(top, largePageTop) - 1 - _largePageBase) / _largePageSize;
+		for (uintptr_t index = first; index <= last; index++) {
+			if (VIRTUAL_MEMORY_PAGE_BACKING_UNDECIDED == _largePageBacking[index]) {
+				void* chunk = (void*)(_largePageBase + (index * _largePageSize));
+				_largePageBacking[index] = (uint8_t)omrvmem_back_with_large_pages(chunk, _largePageSize, _largePageSize, &_identifier);
+			}
+		}
+	}
+}
+
+uintptr_t
+MM_VirtualMemory::getPageBackingRun(uintptr_t address, uintptr_t top, uintptr_t* backing)
+{
+	uintptr_t largePageTop = _largePageBase + (_largePageCount * _largePageSize);
+	uintptr_t runTop = top;
+
+	if (address < _largePageBase) {
+		*backing = OMRPORT_VMEM_PAGE_BACKING_DEFAULT;
+		runTop = OMR_MIN(top, _largePageBase);
+	} else if (address >= largePageTop) {
+		*backing = OMRPORT_VMEM_PAGE_BACKING_DEFAULT;
+	} else {
+		uintptr_t index = (address - _largePageBase) / _largePageSize;
+		uint8_t chunkBacking = _largePageBacking[index];
+		index += 1;
+		while ((index < _largePageCount) && (chunkBacking == _largePageBacking[index])) {
+			index += 1;
+		}
+		*backing = (VIRTUAL_MEMORY_PAGE_BACKING_UNDECIDED == chunkBacking) ? OMRPORT_VMEM_PAGE_BACKING_DEFAULT : chunkBacking;
+		runTop = OMR_MIN(top, _largePageBase + (index * _largePageSize));
+	}
+
+	return runTop;
+}
+
+uintptr_t
+MM_VirtualMemory::getPageBacking(void* lowAddress, void* highAddress, uintptr_t* explicitBytes, uintptr_t* transparentBytes)
+{
+	*explicitBytes = 0;
+	*transparentBytes = 0;
+
+	if (NULL != _largePageBacking) {
+		uintptr_t address = (uintptr_t)lowAddress;
+		uintptr_t top = (uintptr_t)highAddress;
+		while (address < top) {
+			uintptr_t backing = OMRPORT_VMEM_PAGE_BACKING_DEFAULT;
+			uintptr_t runTop = getPageBackingRun(address, top, &backing);
+			if (OMRPORT_VMEM_PAGE_BACKING_EXPLICIT == backing) {
+				*explicitBytes += runTop - address;
+			} else if (OMRPORT_VMEM_PAGE_BACKING_TRANSPARENT == backing) {
+				*transparentBytes += runTop - address;
+			}
+			address = runTop;
+		}
+	}
+
+	return _largePageSize;
+}
+
 void
 MM_VirtualMemory::tearDown(MM_EnvironmentBase* env)
 {
@@ -285,6 +414,10 @@ MM_VirtualMemory::tearDown(MM_EnvironmentBase* env)
 		freeMemory();
 		_heapBase = NULL;
 	}
+	if (NULL != _largePageBacking) {
+		env->getForge()->free(_largePageBacking);
+		_largePageBacking = NULL;
+	}
 }
 
 bool
@@ -40,6 +40,8 @@ class MM_GCExtensions;
 class MM_GCExtensionsBase;
 struct J9PortVmemParams;
 
+#define VIRTUAL_MEMORY_PAGE_BACKING_UNDECIDED ((uint8_t)0xFF) /**< large page chunk that has not been committed yet, its backing is chosen on first commit */
+
 /**
  * @todo Provide class documentation
  * @ingroup GC_Base_Core
@@ -58,6 +60,10 @@ private:
 	uintptr_t _mode; /**< requested memory mode (memory flags combination) */
 	uintptr_t _consumerCount; /**< number of memory consumers attached to this virtual memory instance */
 	J9PortVmemIdentifier _identifier;
+	uintptr_t _largePageSize; /**< Page size the large page chunks are backed with when mixed page size backing is enabled, 0 otherwise */
+	uintptr_t _largePageBase; /**< Lowest large page aligned address in the reserved block, start of the first chunk */
+	uintptr_t _largePageCount; /**< Number of whole large page chunks in the reserved block */
+	uint8_t* _largePageBacking; /**< Backing of each chunk (OMRPORT_VMEM_PAGE_BACKING_* or VIRTUAL_MEMORY_PAGE_BACKING_UNDECIDED), NULL unless mixed page size backing is enabled */
 
 protected:
 	MM_GCExtensionsBase* _extensions;
@@ -71,6 +77,22 @@ public:
 private:
 	bool freeMemory();
 
+	/**
+	 * Choose the backing of every undecided chunk overlapping the page aligned range.  Nothing in an
+	 * undecided chunk has been committed yet, so the whole chunk is backed even if the range only
+	 * covers part of it.
+	 */
+	void backLargePageChunks(uintptr_t base, uintptr_t top);
+
+	/**
+	 * Find the run of memory starting at address that has the same backing.
+	 * @param address the start of the run
+	 * @param top the highest address the run may extend to
+	 * @param[out] backing OMRPORT_VMEM_PAGE_BACKING_* for the run, memory outside whole chunks is on default pages
+	 * @return the end of the run
+	 */
+	uintptr_t getPageBackingRun(uintptr_t address, uintptr_t top, uintptr_t* backing);
+
 protected:
 	/*
 	 * use "OMRPORT_VMEM_MEMORY_MODE_READ | OMRPORT_VMEM_MEMORY_MODE_WRITE" for mode
@@ -97,6 +119,10 @@ protected:
 		, _mode(mode)
 		, _consumerCount(0)
 		, _identifier()
+		, _largePageSize(0)
+		, _largePageBase(0)
+		, _largePageCount(0)
+		, _largePageBacking(NULL)
 		, _extensions(env->getExtensions())
 		, _baseAddress(NULL)
 		, _heapAlignment(heapAlignment)
@@ -110,6 +136,28 @@ protected:
 	virtual bool decommitMemory(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
 	void roundDownTop(uintptr_t rounding);
 
+	/**
+	 * Back the reserved block with a mix of page sizes.  Every largePageSize aligned chunk of the block
+	 * is backed with explicit large pages when it is first committed, falling back to transparent huge
+	 * pages or default pages chunk by chunk when large pages run out.  Chunks backed with explicit large
+	 * pages stay committed until the block is freed.  Commits and decommits must be serialized by the
+	 * caller, as heap expansion and contraction already are.
+	 * @param largePageSize the page size to back whole chunks with, larger than the reserved page size
+	 * @return true if mixed backing is enabled, false if the block can not be backed with largePageSize
+	 */
+	bool enableMixedPageBacking(MM_EnvironmentBase* env, uintptr_t largePageSize);
+
+	/**
+	 * Report how the range is backed.  Memory that is not covered by a large page chunk, or whose chunk
+	 * has not been committed yet, is on the reserved page size.
+	 * @param lowAddress the start of the range
+	 * @param highAddress the end of the range
+	 * @param[out] explicitBytes bytes of the range backed by explicit large pages
+	 * @param[out] transparentBytes bytes of the range eligible for transparent huge pages
+	 * @return the large page size, or 0 if mixed page size backing is not enabled
+	 */
+	uintptr_t getPageBacking(void* lowAddress, void* highAddress, uintptr_t* explicitBytes, uintptr_t* transparentBytes);
+
 	/*
 	 * Set the NUMA affinity for the specified range within the receiver.
 	 * 
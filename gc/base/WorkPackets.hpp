@@ -111,11 +111,11 @@ public:
 	void reuseDeferredPackets(MM_EnvironmentBase *env);
 
 	static uintptr_t getSlotsInPacket() { return _slotsInPacket; }
-	MM_Packet *getInputPacketNoWait(MM_EnvironmentBase *env);
+	virtual MM_Packet *getInputPacketNoWait(MM_EnvironmentBase *env);
 	virtual MM_Packet *getInputPacket(MM_EnvironmentBase *env);
 	virtual MM_Packet *getOutputPacket(MM_EnvironmentBase *env);
 	void putPacket(MM_EnvironmentBase *env, MM_Packet *packet);
-	void putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet);
+	virtual void putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet);
 	
 	MM_Packet *getDeferredPacket(MM_EnvironmentBase *env);
 	void putDeferredPacket(MM_EnvironmentBase *env, MM_Packet *packet);
@@ -123,7 +123,7 @@ public:
 	/**
 	 * Returns TRUE if an input packet is available, FALSE otherwise.
 	 */
-	bool inputPacketAvailable(MM_EnvironmentBase *env);
+	virtual bool inputPacketAvailable(MM_EnvironmentBase *env);
 	
 	/**
 	 * Returns TRUE if all packets are empty, FALSE otherwise.
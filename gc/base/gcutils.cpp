@@ -190,6 +190,8 @@ getContractReasonAsString(ContractReason reason)
 		return "heap reconfiguration";
 	case FORCED_NURSERY_CONTRACT:
 		return "forced nursery contract";
+	case ABOVE_COST_MODEL_TARGET:
+		return "heap larger than cost model target";
 	default:
 		return "unknown";
 	}
@@ -217,6 +219,8 @@ getExpandReasonAsString(ExpandReason reason)
 		return "forced nursery expand";
 	case HINT_PREVIOUS_RUNS:
 		return "hint from previous runs";
+	case BELOW_COST_MODEL_TARGET:
+		return "heap smaller than cost model target";
 	default:
 		return "unknown";
 	}
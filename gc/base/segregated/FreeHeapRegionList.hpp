@@ -76,6 +76,16 @@ public:
 
 	virtual MM_HeapRegionDescriptorSegregated *allocate(MM_EnvironmentBase *env, uintptr_t szClass, uintptr_t numRegions, uintptr_t maxExcess) = 0;
 
+	/**
+	 * @return the number of independently locked lists the receiver is made of
+	 */
+	virtual uintptr_t getShardCount() { return 1; }
+
+	/**
+	 * @return the shard at the given index, the receiver itself if it is not sharded
+	 */
+	virtual MM_FreeHeapRegionList *getShard(uintptr_t index) { return this; }
+
 	MM_HeapRegionDescriptorSegregated *allocate(MM_EnvironmentBase *env, uintptr_t szClass)
 	{
 		assert(_singleRegionsOnly);
@@ -76,6 +76,16 @@ public:
 
 	virtual uintptr_t debugCountFreeBytesInRegions() = 0;
 
+	/**
+	 * @return the number of independently locked queues the receiver is made of
+	 */
+	virtual uintptr_t getShardCount() { return 1; }
+
+	/**
+	 * @return the shard at the given index, the receiver itself if it is not sharded
+	 */
+	virtual MM_HeapRegionQueue *getShard(uintptr_t index) { return this; }
+
 	/* Virtual methods inherited from RegionList */
 	virtual bool isEmpty() = 0;
 	virtual uintptr_t getTotalRegions() = 0;
@@ -75,6 +75,12 @@ public:
 	virtual void
 	push(MM_HeapRegionQueue *srcAsPQ)
 	{ 
+		if (1 < srcAsPQ->getShardCount()) {
+			for (uintptr_t i = 0; i < srcAsPQ->getShardCount(); i++) {
+				push(srcAsPQ->getShard(i));
+			}
+			return;
+		}
 		MM_LockingHeapRegionQueue* src = MM_LockingHeapRegionQueue::asLockingHeapRegionQueue(srcAsPQ);
 		if (src->_head == NULL) { /* Nothing to move - single read needs no lock */
 			return;
@@ -110,6 +116,12 @@ public:
 	virtual void 
 	push(MM_FreeHeapRegionList *srcAsFPL) 
 	{ 
+		if (1 < srcAsFPL->getShardCount()) {
+			for (uintptr_t i = 0; i < srcAsFPL->getShardCount(); i++) {
+				push(srcAsFPL->getShard(i));
+			}
+			return;
+		}
 		MM_LockingFreeHeapRegionList* src = MM_LockingFreeHeapRegionList::asLockingFreeHeapRegionList(srcAsFPL);
 		if (src->_head == NULL) { /* Nothing to move - single read needs no lock */
 			return;
@@ -91,6 +91,12 @@ public:
 	/* enqueue src at the _end_ of the receiver's queue */
 	virtual void enqueue(MM_HeapRegionQueue *srcAsPQ)
 	{
+		if (1 < srcAsPQ->getShardCount()) {
+			for (uintptr_t i = 0; i < srcAsPQ->getShardCount(); i++) {
+				enqueue(srcAsPQ->getShard(i));
+			}
+			return;
+		}
 		MM_LockingHeapRegionQueue* src = MM_LockingHeapRegionQueue::asLockingHeapRegionQueue(srcAsPQ);
 		if (NULL == src->_head) { /* Nothing to move - single read needs no lock */
 			return;
@@ -144,6 +150,16 @@ public:
 
 	virtual uintptr_t dequeue(MM_HeapRegionQueue *targetAsPQ, uintptr_t count)
 	{
+		if (1 < targetAsPQ->getShardCount()) {
+			/* a sharded target picks its own shard for each region */
+			uintptr_t moved = 0;
+			MM_HeapRegionDescriptorSegregated *region = NULL;
+			while ((moved < count) && (NULL != (region = dequeue()))) {
+				targetAsPQ->enqueue(region);
+				moved++;
+			}
+			return moved;
+		}
 		MM_LockingHeapRegionQueue* target = MM_LockingHeapRegionQueue::asLockingHeapRegionQueue(targetAsPQ);
 		lock();
 		target->lock();
@@ -38,6 +38,8 @@
 #include "OMR_VMThread.hpp"
 #include "OMRVMThreadListIterator.hpp"
 #include "SegregatedAllocationInterface.hpp"
+#include "ShardedFreeHeapRegionList.hpp"
+#include "ShardedHeapRegionQueue.hpp"
 
 #include "RegionPoolSegregated.hpp"
 
@@ -78,7 +80,10 @@ MM_RegionPoolSegregated::initialize(MM_EnvironmentBase *env)
 		}
 		_smallFullRegions[szClass] = NULL;
 		_smallSweepRegions[szClass] = NULL;
+		_darkMatterCellCount[szClass] = 0;
+		_currentCountOfSweepRegions[szClass] = 0;
 	}
+	memset(_initialCountOfSweepRegions, 0, sizeof(_initialCountOfSweepRegions));
 
 	_singleFreeList = MM_RegionPoolSegregated::allocateFreeHeapRegionList(env, MM_HeapRegionList::HRL_KIND_FREE, true);
 	_multiFreeList = MM_RegionPoolSegregated::allocateFreeHeapRegionList(env, MM_HeapRegionList::HRL_KIND_MULTI_FREE, false);
@@ -135,12 +140,22 @@ MM_RegionPoolSegregated::initialize(MM_EnvironmentBase *env)
 MM_HeapRegionQueue*
 MM_RegionPoolSegregated::allocateHeapRegionQueue(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly, bool concurrentAccess, bool trackFreeBytes)
 {
+	/* only the pool wide single region queues are refilled from many threads at once */
+	uintptr_t shardCount = env->getExtensions()->regionListShardCount;
+	if ((1 < shardCount) && singleRegionsOnly && concurrentAccess) {
+		return MM_ShardedHeapRegionQueue::newInstance(env, regionListKind, singleRegionsOnly, trackFreeBytes, shardCount);
+	}
 	return MM_LockingHeapRegionQueue::newInstance(env, regionListKind, singleRegionsOnly, concurrentAccess, trackFreeBytes);
 }
 
 MM_FreeHeapRegionList*
 MM_RegionPoolSegregated::allocateFreeHeapRegionList(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly)
 {
+	/* the multi and coalesce lists need detach() and a first fit search over the whole list, so they are never sharded */
+	uintptr_t shardCount = env->getExtensions()->regionListShardCount;
+	if ((1 < shardCount) && singleRegionsOnly) {
+		return MM_ShardedFreeHeapRegionList::newInstance(env, regionListKind, singleRegionsOnly, shardCount);
+	}
 	return MM_LockingFreeHeapRegionList::newInstance(env, regionListKind, singleRegionsOnly);
 }
 
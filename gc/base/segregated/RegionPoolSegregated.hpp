@@ -276,6 +276,8 @@ public:
 		, _largeFullRegions(NULL)
 		, _largeSweepRegions(NULL)
 		, _regionsInUse(0)
+		, _initialTotalCountOfSweepRegions(0)
+		, _currentTotalCountOfSweepRegions(0)
 		, _isSweepingSmall(false)
 	{
 		_typeId = __FUNCTION__;
@@ -30,6 +30,7 @@
 #include "MemoryPoolSegregated.hpp"
 #include "ParallelDispatcher.hpp"
 #include "ParallelMarkTask.hpp"
+#include "RegionPoolSegregated.hpp"
 #include "SegregatedAllocationInterface.hpp"
 #include "SegregatedMarkingScheme.hpp"
 #include "SegregatedSweepTask.hpp"
@@ -179,6 +180,21 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	_extensions->globalGCStats.clear();
 	_extensions->globalGCStats.gcCount++;
 
+	MM_MemoryPoolSegregated *memoryPool = (MM_MemoryPoolSegregated *)env->getDefaultMemorySubSpace()->getMemoryPool();
+	MM_MemorySubSpace *activeSubSpace = env->_cycleState->_activeSubSpace;
+	bool isExplicitGC = env->_cycleState->_gcCode.isExplicitGC();
+	if (_sweepDeferred) {
+		/* Small regions left unswept by the previous cycle have to be swept while their mark bits are still valid */
+		MM_SegregatedSweepTask completeSweepTask(env, _dispatcher, _sweepScheme, memoryPool, true);
+		_dispatcher->run(env, &completeSweepTask);
+		_sweepDeferred = false;
+
+		/* The resize decision of the previous cycle was postponed until its free space was known */
+		activeSubSpace->checkResize(env, allocDescription, isExplicitGC);
+		activeSubSpace->performResize(env, allocDescription);
+		_extensions->heap->resetHeapStatistics(true);
+	}
+
 	/*
 	 * Marking
 	 */
@@ -222,17 +238,20 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
 	reportSweepStart(env);
 	sweepStats->_startTime = omrtime_hires_clock();
-	MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, (MM_MemoryPoolSegregated *) env->getDefaultMemorySubSpace()->getMemoryPool());
+	MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, memoryPool);
 	_dispatcher->run(env, &sweepTask);
-	MM_MemorySubSpace *activeSubSpace = env->_cycleState->_activeSubSpace;
-	bool isExplicitGC = env->_cycleState->_gcCode.isExplicitGC();
-	/* We now have accurate free space statistics so recalculate any expand/contract amount */
-	activeSubSpace->checkResize(env, allocDescription, isExplicitGC);
+	_sweepDeferred = _extensions->lazySweepSegregated;
+	if (!_sweepDeferred) {
+		/* We now have accurate free space statistics so recalculate any expand/contract amount */
+		activeSubSpace->checkResize(env, allocDescription, isExplicitGC);
+	}
 	sweepStats->_endTime = omrtime_hires_clock();
 	reportSweepEnd(env);
 
-	/* Perform the resize now based on expand/contract calculation from checkResize() (above) */
-	activeSubSpace->performResize(env, allocDescription);
+	if (!_sweepDeferred) {
+		/* Perform the resize now based on expand/contract calculation from checkResize() (above) */
+		activeSubSpace->performResize(env, allocDescription);
+	}
 
 	/* Heap size now fixed for next cycle so reset heap statistics */
 	_extensions->heap->resetHeapStatistics(true);
@@ -45,6 +45,7 @@ protected:
 	MM_SegregatedMarkingScheme *_markingScheme;
 	MM_SweepSchemeSegregated *_sweepScheme;
 	MM_ParallelDispatcher *_dispatcher;
+	bool _sweepDeferred; /**< True if the last cycle left small regions for allocating threads to sweep (-Xgc:lazySweepSegregated) */
 
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the main cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
@@ -119,6 +120,7 @@ public:
 		, _markingScheme(NULL)
 		, _sweepScheme(NULL)
 		, _dispatcher(_extensions->dispatcher)
+		, _sweepDeferred(false)
 		, _scanBytes(0)
 		, _objectsMarked(0)
 	{
@@ -21,6 +21,7 @@
  *******************************************************************************/
 
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
 #include "SweepSchemeSegregated.hpp"
 
 #include "SegregatedSweepTask.hpp"
@@ -30,19 +31,30 @@
 void
 MM_SegregatedSweepTask::run(MM_EnvironmentBase *env)
 {
-	_sweepScheme->sweep(env, _memoryPool, false);
+	if (_completeDeferredSweep) {
+		_sweepScheme->completeDeferredSweep(env, _memoryPool);
+	} else {
+		_sweepScheme->sweep(env, _memoryPool, false);
+	}
 }
 
+/**
+ * Initialize sweep statistics per work thread at the beginning of the sweep task.
+ */
 void
 MM_SegregatedSweepTask::setup(MM_EnvironmentBase *env)
 {
-
+	env->_sweepStats.clear();
+	env->_sweepStats._gcCount = env->getExtensions()->globalGCStats.gcCount;
 }
 
+/**
+ * Gather sweep statistics into the global statistics counter at the end of the sweep task.
+ */
 void
-MM_SegregatedSweepTask::cleanup(MM_EnvironmentBase *envBase)
+MM_SegregatedSweepTask::cleanup(MM_EnvironmentBase *env)
 {
-
+	env->getExtensions()->globalGCStats.sweepStats.merge(&env->_sweepStats);
 }
 
 #endif /* OMR_GC_SEGREGATED_HEAP */
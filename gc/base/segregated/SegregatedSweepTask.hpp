@@ -37,6 +37,7 @@ protected:
 private:
 	MM_SweepSchemeSegregated *_sweepScheme;
 	MM_MemoryPoolSegregated *_memoryPool;
+	bool _completeDeferredSweep; /**< If true only sweep the regions left unswept by the previous cycle */
 
 /* Methods */
 public:
@@ -47,10 +48,11 @@ public:
 	virtual void setup(MM_EnvironmentBase *env);
 	virtual void cleanup(MM_EnvironmentBase *env);
 	
-	MM_SegregatedSweepTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_SweepSchemeSegregated *sweepScheme, MM_MemoryPoolSegregated *memoryPool)
+	MM_SegregatedSweepTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_SweepSchemeSegregated *sweepScheme, MM_MemoryPoolSegregated *memoryPool, bool completeDeferredSweep = false)
 		: MM_ParallelTask(env, dispatcher)
 		, _sweepScheme(sweepScheme)
 		, _memoryPool(memoryPool)
+		, _completeDeferredSweep(completeDeferredSweep)
 	{
 		_typeId = __FUNCTION__;
 	}
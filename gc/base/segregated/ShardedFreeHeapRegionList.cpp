@@ -0,0 +1,169 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "modronopt.h"
+
+#include "ModronAssertions.h"
+#include "ShardedFreeHeapRegionList.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+MM_ShardedFreeHeapRegionList *
+MM_ShardedFreeHeapRegionList::newInstance(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly, uintptr_t shardCount)
+{
+	MM_ShardedFreeHeapRegionList *fpl = (MM_ShardedFreeHeapRegionList *)env->getForge()->allocate(sizeof(MM_ShardedFreeHeapRegionList), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (fpl) {
+		new (fpl) MM_ShardedFreeHeapRegionList(regionListKind, singleRegionsOnly, shardCount);
+		if (!fpl->initialize(env)) {
+			fpl->kill(env);
+			return NULL;
+		}
+	}
+	return fpl;
+}
+
+void
+MM_ShardedFreeHeapRegionList::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_ShardedFreeHeapRegionList::initialize(MM_EnvironmentBase *env)
+{
+	Assert_MM_true(0 < _shardCount);
+	_shards = (MM_LockingFreeHeapRegionList *)env->getForge()->allocate(sizeof(MM_LockingFreeHeapRegionList) * _shardCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _shards) {
+		return false;
+	}
+	for (uintptr_t i = 0; i < _shardCount; i++) {
+		new (&_shards[i]) MM_LockingFreeHeapRegionList(_regionListKind, _singleRegionsOnly);
+		if (!_shards[i].initialize(env)) {
+			/* only tear down what has been constructed */
+			_shardCount = i + 1;
+			return false;
+		}
+	}
+	return true;
+}
+
+void
+MM_ShardedFreeHeapRegionList::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _shards) {
+		for (uintptr_t i = 0; i < _shardCount; i++) {
+			_shards[i].tearDown(env);
+		}
+		env->getForge()->free(_shards);
+		_shards = NULL;
+	}
+}
+
+/* push all regions of src, shard by shard when src is sharded as well */
+void
+MM_ShardedFreeHeapRegionList::push(MM_FreeHeapRegionList *src)
+{
+	uintptr_t srcShardCount = src->getShardCount();
+	if (1 == srcShardCount) {
+		_shards[MM_ShardedHeapRegionQueue::getHomeShardIndex(_shardCount)].push(src);
+	} else {
+		for (uintptr_t i = 0; i < srcShardCount; i++) {
+			_shards[i % _shardCount].push(src->getShard(i));
+		}
+	}
+}
+
+MM_HeapRegionDescriptorSegregated *
+MM_ShardedFreeHeapRegionList::pop()
+{
+	uintptr_t home = MM_ShardedHeapRegionQueue::getHomeShardIndex(_shardCount);
+	for (uintptr_t i = 0; i < _shardCount; i++) {
+		MM_LockingFreeHeapRegionList *shard = &_shards[(home + i) % _shardCount];
+		/* unlocked check first, an empty shard is not worth the lock */
+		if (!shard->isEmpty()) {
+			MM_HeapRegionDescriptorSegregated *region = shard->pop();
+			if (NULL != region) {
+				return region;
+			}
+		}
+	}
+	return NULL;
+}
+
+void
+MM_ShardedFreeHeapRegionList::detach(MM_HeapRegionDescriptorSegregated *cur)
+{
+	/* the owning shard is unknown - callers detach from the (locking) coalesce list only */
+	Assert_MM_unreachable();
+}
+
+MM_HeapRegionDescriptorSegregated *
+MM_ShardedFreeHeapRegionList::allocate(MM_EnvironmentBase *env, uintptr_t szClass, uintptr_t numRegions, uintptr_t maxExcess)
+{
+	uintptr_t home = MM_ShardedHeapRegionQueue::getHomeShardIndex(_shardCount);
+	for (uintptr_t i = 0; i < _shardCount; i++) {
+		MM_LockingFreeHeapRegionList *shard = &_shards[(home + i) % _shardCount];
+		if (!shard->isEmpty()) {
+			MM_HeapRegionDescriptorSegregated *region = shard->allocate(env, szClass, numRegions, maxExcess);
+			if (NULL != region) {
+				return region;
+			}
+		}
+	}
+	return NULL;
+}
+
+bool
+MM_ShardedFreeHeapRegionList::isEmpty()
+{
+	for (uintptr_t i = 0; i < _shardCount; i++) {
+		if (!_shards[i].isEmpty()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+uintptr_t
+MM_ShardedFreeHeapRegionList::getTotalRegions()
+{
+	uintptr_t count = 0;
+	for (uintptr_t i = 0; i < _shardCount; i++) {
+		count += _shards[i].getTotalRegions();
+	}
+	return count;
+}
+
+void
+MM_ShardedFreeHeapRegionList::showList(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	omrtty_printf("ShardedFreeHeapRegionList %p (%zu shards):\n", this, _shardCount);
+	for (uintptr_t i = 0; i < _shardCount; i++) {
+		_shards[i].showList(env);
+	}
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(SHARDEDFREEHEAPREGIONLIST_HPP_)
+#define SHARDEDFREEHEAPREGIONLIST_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "FreeHeapRegionList.hpp"
+#include "LockingFreeHeapRegionList.hpp"
+#include "ShardedHeapRegionQueue.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/**
+ * A FreeHeapRegionList made of several independently locked MM_LockingFreeHeapRegionList shards
+ * (-Xgc:regionListShards=<n>).  Regions are pushed on the calling thread's home shard and popped
+ * from it first, falling back to the other shards.  Since a region does not record which shard
+ * it is on, detach() is not supported: the list must be drained into a locking list (as the
+ * coalescing sweep does) before individual regions are removed.
+ *
+ * The regions are not counted in _length, use getTotalRegions() or isEmpty() instead of length().
+ */
+class MM_ShardedFreeHeapRegionList : public MM_FreeHeapRegionList
+{
+/* Data members & types */
+public:
+protected:
+private:
+	MM_LockingFreeHeapRegionList *_shards; /**< Array of _shardCount locking free lists */
+	uintptr_t _shardCount; /**< Number of entries in _shards */
+
+/* Methods */
+public:
+	static MM_ShardedFreeHeapRegionList *newInstance(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly, uintptr_t shardCount);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	MM_ShardedFreeHeapRegionList(MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly, uintptr_t shardCount) :
+		MM_FreeHeapRegionList(regionListKind, singleRegionsOnly),
+		_shards(NULL),
+		_shardCount(shardCount)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+	virtual uintptr_t getShardCount() { return _shardCount; }
+	virtual MM_FreeHeapRegionList *getShard(uintptr_t index) { return &_shards[index]; }
+
+	virtual void
+	push(MM_HeapRegionDescriptorSegregated *region)
+	{
+		_shards[MM_ShardedHeapRegionQueue::getHomeShardIndex(_shardCount)].push(region);
+	}
+
+	virtual void
+	push(MM_HeapRegionQueue *src)
+	{
+		_shards[MM_ShardedHeapRegionQueue::getHomeShardIndex(_shardCount)].push(src);
+	}
+
+	virtual void push(MM_FreeHeapRegionList *src);
+
+	virtual MM_HeapRegionDescriptorSegregated *pop();
+
+	virtual void detach(MM_HeapRegionDescriptorSegregated *cur);
+
+	virtual MM_HeapRegionDescriptorSegregated *allocate(MM_EnvironmentBase *env, uintptr_t szClass, uintptr_t numRegions, uintptr_t maxExcess);
+
+	virtual bool isEmpty();
+	virtual uintptr_t getTotalRegions();
+	virtual void showList(MM_EnvironmentBase *env);
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* SHARDEDFREEHEAPREGIONLIST_HPP_ */
@@ -0,0 +1,172 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "modronopt.h"
+
+#include "EnvironmentBase.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "ModronAssertions.h"
+#include "ShardedHeapRegionQueue.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+MM_ShardedHeapRegionQueue *
+MM_ShardedHeapRegionQueue::newInstance(MM_EnvironmentBase *env, RegionListKind regionListKind, bool singleRegionsOnly, bool trackFreeBytes, uintptr_t shardCount)
+{
+	MM_ShardedHeapRegionQueue *regionList = (MM_ShardedHeapRegionQueue *)env->getForge()->allocate(sizeof(MM_ShardedHeapRegionQueue), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (regionList) {
+		new (regionList) MM_ShardedHeapRegionQueue(regionListKind, singleRegionsOnly, trackFreeBytes, shardCount);
+		if (!regionList->initialize(env)) {
+			regionList->kill(env);
+			return NULL;
+		}
+	}
+	return regionList;
+}
+
+void
+MM_ShardedHeapRegionQueue::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_ShardedHeapRegionQueue::initialize(MM_EnvironmentBase *env)
+{
+	Assert_MM_true(0 < _shardCount);
+	_shards = (MM_LockingHeapRegionQueue *)env->getForge()->allocate(sizeof(MM_LockingHeapRegionQueue) * _shardCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _shards) {
+		return false;
+	}
+	for (uintptr_t i = 0; i < _shardCount; i++) {
+		new (&_shards[i]) MM_LockingHeapRegionQueue(_regionListKind, _singleRegionsOnly, true, _trackFreeBytes);
+		if (!_shards[i].initialize(env)) {
+			/* only tear down what has been constructed */
+			_shardCount = i + 1;
+			return false;
+		}
+	}
+	return true;
+}
+
+void
+MM_ShardedHeapRegionQueue::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _shards) {
+		for (uintptr_t i = 0; i < _shardCount; i++) {
+			_shards[i].tearDown(env);
+		}
+		env->getForge()->free(_shards);
+		_shards = NULL;
+	}
+}
+
+/* enqueue all regions of src, shard by shard when src is sharded as well */
+void
+MM_ShardedHeapRegionQueue::enqueue(MM_HeapRegionQueue *src)
+{
+	uintptr_t srcShardCount = src->getShardCount();
+	if (1 == srcShardCount) {
+		_shards[getHomeShardIndex(_shardCount)].enqueue(src);
+	} else {
+		for (uintptr_t i = 0; i < srcShardCount; i++) {
+			_shards[i % _shardCount].enqueue(src->getShard(i));
+		}
+	}
+}
+
+MM_HeapRegionDescriptorSegregated *
+MM_ShardedHeapRegionQueue::dequeue()
+{
+	uintptr_t home = getHomeShardIndex(_shardCount);
+	for (uintptr_t i = 0; i < _shardCount; i++) {
+		MM_HeapRegionDescriptorSegregated *region = _shards[(home + i) % _shardCount].dequeueIfNonEmpty();
+		if (NULL != region) {
+			return region;
+		}
+	}
+	return NULL;
+}
+
+uintptr_t
+MM_ShardedHeapRegionQueue::dequeue(MM_HeapRegionQueue *target, uintptr_t count)
+{
+	uintptr_t moved = 0;
+	uintptr_t home = getHomeShardIndex(_shardCount);
+	for (uintptr_t i = 0; (moved < count) && (i < _shardCount); i++) {
+		MM_LockingHeapRegionQueue *shard = &_shards[(home + i) % _shardCount];
+		if (!shard->isEmpty()) {
+			moved += shard->dequeue(target, count - moved);
+		}
+	}
+	return moved;
+}
+
+bool
+MM_ShardedHeapRegionQueue::isEmpty()
+{
+	for (uintptr_t i = 0; i < _shardCount; i++) {
+		if (!_shards[i].isEmpty()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+uintptr_t
+MM_ShardedHeapRegionQueue::getTotalRegions()
+{
+	uintptr_t count = 0;
+	for (uintptr_t i = 0; i < _shardCount; i++) {
+		count += _shards[i].getTotalRegions();
+	}
+	return count;
+}
+
+void
+MM_ShardedHeapRegionQueue::showList(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	omrtty_printf("ShardedHeapRegionQueue %p (%zu shards):\n", this, _shardCount);
+	for (uintptr_t i = 0; i < _shardCount; i++) {
+		_shards[i].showList(env);
+	}
+}
+
+/**
+ * DEBUG method that iterates over all regions in all shards and sums up the free bytes.
+ * @see MM_LockingHeapRegionQueue::debugCountFreeBytesInRegions()
+ */
+uintptr_t
+MM_ShardedHeapRegionQueue::debugCountFreeBytesInRegions()
+{
+	uintptr_t freeBytes = 0;
+	for (uintptr_t i = 0; i < _shardCount; i++) {
+		freeBytes += _shards[i].debugCountFreeBytesInRegions();
+	}
+	return freeBytes;
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
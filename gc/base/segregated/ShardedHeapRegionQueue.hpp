@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(SHARDEDHEAPREGIONQUEUE_HPP_)
+#define SHARDEDHEAPREGIONQUEUE_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "EnvironmentBase.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "HeapRegionQueue.hpp"
+#include "LockingHeapRegionQueue.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/**
+ * A HeapRegionQueue made of several independently locked MM_LockingHeapRegionQueue shards
+ * (-Xgc:regionListShards=<n>).  Single region operations start at the calling thread's home
+ * shard, so threads which refill concurrently usually take different locks.  A dequeue which
+ * finds its home shard empty steals from the other shards before it reports the queue empty.
+ *
+ * The queue is only FIFO within a shard.  The regions are not counted in _length, use
+ * getTotalRegions() or isEmpty() instead of length().
+ */
+class MM_ShardedHeapRegionQueue : public MM_HeapRegionQueue
+{
+/* Data members & types */
+public:
+protected:
+private:
+	MM_LockingHeapRegionQueue *_shards; /**< Array of _shardCount locking queues */
+	uintptr_t _shardCount; /**< Number of entries in _shards */
+	bool _trackFreeBytes; /**< Passed on to the shards */
+
+/* Methods */
+public:
+	static MM_ShardedHeapRegionQueue *newInstance(MM_EnvironmentBase *env, RegionListKind regionListKind, bool singleRegionsOnly, bool trackFreeBytes, uintptr_t shardCount);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	MM_ShardedHeapRegionQueue(RegionListKind regionListKind, bool singleRegionsOnly, bool trackFreeBytes, uintptr_t shardCount) :
+		MM_HeapRegionQueue(regionListKind, singleRegionsOnly, trackFreeBytes),
+		_shards(NULL),
+		_shardCount(shardCount),
+		_trackFreeBytes(trackFreeBytes)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+	/**
+	 * Pick the shard the calling thread starts at.  omrthread_t is a pointer to an allocated
+	 * structure, so its bits are mixed before the modulus is taken.
+	 * @return an index in [0, shardCount)
+	 */
+	MMINLINE static uintptr_t
+	getHomeShardIndex(uintptr_t shardCount)
+	{
+		uintptr_t hash = ((uintptr_t)omrthread_self() >> 4) * (uintptr_t)0x9E3779B1;
+		return (hash >> 8) % shardCount;
+	}
+
+	virtual uintptr_t getShardCount() { return _shardCount; }
+	virtual MM_HeapRegionQueue *getShard(uintptr_t index) { return &_shards[index]; }
+
+	virtual void
+	enqueue(MM_HeapRegionDescriptorSegregated *region)
+	{
+		_shards[getHomeShardIndex(_shardCount)].enqueue(region);
+	}
+
+	virtual void enqueue(MM_HeapRegionQueue *src);
+
+	virtual MM_HeapRegionDescriptorSegregated *dequeue();
+
+	virtual uintptr_t dequeue(MM_HeapRegionQueue *target, uintptr_t count);
+
+	virtual uintptr_t debugCountFreeBytesInRegions();
+
+	virtual bool isEmpty();
+	virtual uintptr_t getTotalRegions();
+	virtual void showList(MM_EnvironmentBase *env);
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* SHARDEDHEAPREGIONQUEUE_HPP_ */
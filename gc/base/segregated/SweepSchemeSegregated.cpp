@@ -112,6 +112,22 @@ MM_SweepSchemeSegregated::sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated
 	incrementalSweepLarge(env);
 	
 	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
+	if (_extensions->lazySweepSegregated && !isFixHeapForWalk) {
+		/* Leave the small regions on the sweep lists, allocating threads sweep them on demand
+		 * (see MM_RegionPoolSegregated::sweepAndAllocateRegionFromSmallSizeClass()) and the
+		 * next collection sweeps whatever is left before it starts marking.  Coalescing waits
+		 * for completeDeferredSweep(), when the occupancy of the small regions is known.
+		 */
+		if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+			regionPool->resetSkipAvailableRegionForAllocation();
+			for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+				env->_sweepStats._sizeClassRegionsDeferred[sizeClass] = regionPool->getCurrentCountOfSweepRegions(sizeClass);
+			}
+			env->_currentTask->releaseSynchronizedGCThreads(env);
+		}
+		return;
+	}
+
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
 		regionPool->setSweepSmallPages(true);
 		regionPool->resetSkipAvailableRegionForAllocation();
@@ -128,6 +144,28 @@ MM_SweepSchemeSegregated::sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated
 	}
 }
 
+void
+MM_SweepSchemeSegregated::completeDeferredSweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool)
+{
+	_memoryPool = memoryPool;
+	_isFixHeapForWalk = false;
+
+	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		regionPool->setSweepSmallPages(true);
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+
+	incrementalSweepSmall(env);
+	regionPool->joinBucketListsForSplitIndex(env);
+
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		regionPool->setSweepSmallPages(false);
+		postSweep(env);
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+}
+
 void
 MM_SweepSchemeSegregated::preSweep(MM_EnvironmentBase *env)
 {
@@ -498,6 +536,7 @@ MM_SweepSchemeSegregated::updateSweepSmallRegionCount()
 void
 MM_SweepSchemeSegregated::incrementalSweepSmall(MM_EnvironmentBase *env)
 {
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 	MM_GCExtensionsBase *ext = env->getExtensions();
 	bool shouldUpdateOccupancy = ext->nonDeterministicSweep;
 	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
@@ -530,6 +569,7 @@ MM_SweepSchemeSegregated::incrementalSweepSmall(MM_EnvironmentBase *env)
 				uintptr_t yieldSlackTime = resetSweepSmallRegionCount(env, sweepSmallRegionsPerIteration);
 				uintptr_t actualSweepRegions;
 				if ((actualSweepRegions = sweepList->dequeue(env->getRegionWorkList(), sweepSmallRegionsPerIteration)) > 0) {
+					uint64_t sweepStartTime = omrtime_hires_clock();
 					regionPool->decrementCurrentCountOfSweepRegions(sizeClass, actualSweepRegions);
 					regionPool->decrementCurrentTotalCountOfSweepRegions(actualSweepRegions);
 					uintptr_t freedRegions = 0, processedRegions = 0;
@@ -562,6 +602,7 @@ MM_SweepSchemeSegregated::incrementalSweepSmall(MM_EnvironmentBase *env)
 					}
 					regionPool->addSingleFree(env, env->getRegionLocalFree());				
 					regionPool->getSmallFullRegions(sizeClass)->enqueue(fullList);
+					env->_sweepStats.addToSizeClassSweepTime(sizeClass, actualSweepRegions, sweepStartTime, omrtime_hires_clock());
 					yieldFromSweep(env, yieldSlackTime);
 				}
 			} /* end of while(currentTotalCountOfSweepRegions); */
@@ -65,6 +65,12 @@ public:
 	MM_MarkMap *getMarkMap(MM_EnvironmentBase * env);
 
 	void sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool, bool isFixHeapForWalk);
+
+	/**
+	 * Sweep the small regions which were left unswept by the previous cycle (-Xgc:lazySweepSegregated)
+	 * and which allocating threads have not swept yet.  Must complete before the mark map is cleared.
+	 */
+	void completeDeferredSweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool);
 	virtual void sweepRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
 
 	bool isClearMarkMapAfterSweep() { return _clearMarkMapAfterSweep; }
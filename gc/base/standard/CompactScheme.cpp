@@ -52,6 +52,7 @@
 #include "ObjectHeapIteratorAddressOrderedList.hpp"
 #include "ObjectModel.hpp"
 #include "ParallelDispatcher.hpp"
+#include "ParallelSweepChunk.hpp"
 #include "ParallelSweepScheme.hpp"
 #include "ParallelTask.hpp"
 #include "SlotObject.hpp"
@@ -280,12 +281,24 @@ public:
 bool
 MM_CompactScheme::initialize(MM_EnvironmentBase *env)
 {
+	if (0 != _extensions->incrementalCompactBudget) {
+		_incrementalRanges = (IncrementalRange *)env->getForge()->allocate(sizeof(IncrementalRange) * _extensions->incrementalCompactMaxRanges, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _incrementalRanges) {
+			return false;
+		}
+	}
+
 	return _delegate.initialize(env, _omrVM, _markMap, this);
 }
 
 void
 MM_CompactScheme::tearDown(MM_EnvironmentBase *env)
 {
+	if (NULL != _incrementalRanges) {
+		env->getForge()->free(_incrementalRanges);
+		_incrementalRanges = NULL;
+	}
+
 	_delegate.tearDown(env);
 }
 
@@ -410,7 +423,12 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 	} else {
 		min_subarea_size = _heap->getMaximumPhysicalRange();
 	}
-	uintptr_t size = (DESIRED_SUBAREA_SIZE >= min_subarea_size) ?  DESIRED_SUBAREA_SIZE : min_subarea_size;
+	uintptr_t desired_subarea_size = DESIRED_SUBAREA_SIZE;
+	if (_incremental) {
+		/* line the sub areas up with the sweep chunks the incremental ranges were selected from */
+		desired_subarea_size = _extensions->parSweepChunkSize;
+	}
+	uintptr_t size = (desired_subarea_size >= min_subarea_size) ?  desired_subarea_size : min_subarea_size;
 
 
 	/* Single threaded pass to set tentative sub area limits tentative limits are
@@ -429,7 +447,7 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 			MM_MemorySubSpace *memorySubSpace = region->getSubSpace();
 			intptr_t state = SubAreaEntry::init;
 
-			if (singleThreaded) {
+			if (singleThreaded && !_incremental) {
 				size = areaSize;
 			}
 			_subAreaTable[i].firstObject = (omrobjectptr_t)lowAddress;
@@ -509,6 +527,10 @@ MM_CompactScheme::removeNullSubAreas(MM_EnvironmentStandard *env)
 				j++;
 			}
 		}
+
+		if (_incremental) {
+			selectIncrementalSubAreas(env);
+		}
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 }
@@ -540,7 +562,116 @@ MM_CompactScheme::completeSubAreaTable(MM_EnvironmentStandard *env)
 }
 
 void
-MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, bool aggressive)
+MM_CompactScheme::selectIncrementalRanges(MM_EnvironmentStandard *env)
+{
+	uintptr_t maxRanges = _extensions->incrementalCompactMaxRanges;
+	uintptr_t rangeCount = 0;
+	uintptr_t totalFragmentedBytes = 0;
+
+	/* Keep the maxRanges most fragmented chunks, in decreasing order of fragmentation. A chunk is
+	 * fragmented by the free memory which is not part of its largest free entry.
+	 */
+	MM_SweepHeapSectioningIterator sectioningIterator(_extensions->sweepHeapSectioning);
+	MM_ParallelSweepChunk *chunk = NULL;
+	uintptr_t chunkCount = 0;
+	while ((chunkCount < _extensions->splitFreeListNumberChunksPrepared) && (NULL != (chunk = sectioningIterator.nextChunk()))) {
+		chunkCount += 1;
+		uintptr_t chunkSize = chunk->size();
+		uintptr_t freeBytes = chunk->freeBytes + chunk->leadingFreeCandidateSize + chunk->trailingFreeCandidateSize;
+		uintptr_t largestFreeEntry = OMR_MAX(chunk->_largestFreeEntry, OMR_MAX(chunk->leadingFreeCandidateSize, chunk->trailingFreeCandidateSize));
+		uintptr_t fragmentedBytes = freeBytes - OMR_MIN(freeBytes, largestFreeEntry) + chunk->_darkMatterBytes;
+		if (0 == fragmentedBytes) {
+			continue;
+		}
+
+		totalFragmentedBytes += fragmentedBytes;
+		if ((rangeCount == maxRanges) && (fragmentedBytes <= _incrementalRanges[rangeCount - 1].fragmentedBytes)) {
+			continue;
+		}
+
+		uintptr_t slot = (rangeCount < maxRanges) ? rangeCount++ : (maxRanges - 1);
+		while ((slot > 0) && (_incrementalRanges[slot - 1].fragmentedBytes < fragmentedBytes)) {
+			_incrementalRanges[slot] = _incrementalRanges[slot - 1];
+			slot -= 1;
+		}
+		_incrementalRanges[slot].base = (uintptr_t)chunk->chunkBase;
+		_incrementalRanges[slot].top = (uintptr_t)chunk->chunkTop;
+		_incrementalRanges[slot].fragmentedBytes = fragmentedBytes;
+		_incrementalRanges[slot].liveBytes = chunkSize - OMR_MIN(chunkSize, freeBytes + chunk->_darkMatterBytes);
+	}
+
+	/* Take the candidates, most fragmented first, for as long as their live bytes fit in the budget */
+	uintptr_t budget = _extensions->incrementalCompactBudget;
+	uintptr_t selectedCount = 0;
+	uintptr_t selectedFragmentedBytes = 0;
+	for (uintptr_t i = 0; i < rangeCount; i++) {
+		if (_incrementalRanges[i].liveBytes <= budget) {
+			budget -= _incrementalRanges[i].liveBytes;
+			selectedFragmentedBytes += _incrementalRanges[i].fragmentedBytes;
+			_incrementalRanges[selectedCount] = _incrementalRanges[i];
+			selectedCount += 1;
+		}
+	}
+
+	/* Sort the selection by address so that it can be matched against the sub area table in one pass */
+	for (uintptr_t i = 1; i < selectedCount; i++) {
+		IncrementalRange range = _incrementalRanges[i];
+		uintptr_t j = i;
+		while ((j > 0) && (_incrementalRanges[j - 1].base > range.base)) {
+			_incrementalRanges[j] = _incrementalRanges[j - 1];
+			j -= 1;
+		}
+		_incrementalRanges[j] = range;
+	}
+	_incrementalRangeCount = selectedCount;
+
+	env->_compactStats._incremental = true;
+	env->_compactStats._incrementalRanges = selectedCount;
+	env->_compactStats._fragmentedBytes = totalFragmentedBytes;
+	env->_compactStats._remainingFragmentedBytes = totalFragmentedBytes - selectedFragmentedBytes;
+}
+
+void
+MM_CompactScheme::selectIncrementalSubAreas(MM_EnvironmentStandard *env)
+{
+	GC_HeapRegionIteratorStandard regionIterator(_rootManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+	uintptr_t range = 0;
+
+	/* Only objects in the sub areas which are still compacted can be forwarded */
+	_compactFrom = (omrobjectptr_t)_heap->getHeapTop();
+	_compactTo = (omrobjectptr_t)_heap->getHeapBase();
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		uintptr_t i = 0;
+		for (i = 0; SubAreaEntry::end_segment != subAreaTable[i].state; i++) {
+			if (SubAreaEntry::init != subAreaTable[i].state) {
+				continue;
+			}
+			uintptr_t start = (uintptr_t)subAreaTable[i].firstObject;
+			uintptr_t end = (uintptr_t)subAreaTable[i + 1].firstObject;
+			while ((range < _incrementalRangeCount) && (_incrementalRanges[range].top <= start)) {
+				range += 1;
+			}
+			if ((range < _incrementalRangeCount) && (_incrementalRanges[range].base < end)) {
+				_compactFrom = OMR_MIN(_compactFrom, subAreaTable[i].firstObject);
+				_compactTo = OMR_MAX(_compactTo, subAreaTable[i + 1].firstObject);
+			} else {
+				subAreaTable[i].state = SubAreaEntry::fixup_only;
+			}
+		}
+		/* Number of regions in regionTable, including
+		 * the end_segment region, is i+1 */
+		subAreaTable += (i + 1);
+	}
+}
+
+void
+MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, bool aggressive, bool incremental)
 {
 	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(envBase);
 	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
@@ -560,6 +691,12 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		_delegate.verifyHeap(env, _markMap);
 #endif /* DEBUG */
 
+		/* The sweep chunks have to be ranked before the sub area table overwrites them */
+		_incremental = incremental && !aggressive && (NULL != _incrementalRanges);
+		if (_incremental) {
+			selectIncrementalRanges(env);
+		}
+
 		/* Reset largestFreeEntry of all subSpaces at beginning of compaction */
 		_extensions->heap->resetLargestFreeEntry();
 
@@ -713,6 +850,11 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 
 				currentFreeBase = NULL;
 				currentFreeSize = 0;
+
+				if (SubAreaEntry::fixup_only == subAreaTable[i].state) {
+					/* Nothing was moved, but the pools were reset so the holes between the objects have to be added back */
+					currentFreeBase = rebuildFreelistInFixupOnlySubArea(env, memorySubSpace, poolState, subAreaTable, i);
+				}
 			}
         } while (subAreaTable[i++].state != SubAreaEntry::end_segment);
 
@@ -727,6 +869,25 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 	}
 }
 
+void *
+MM_CompactScheme::rebuildFreelistInFixupOnlySubArea(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, MM_CompactMemoryPoolState *poolState, SubAreaEntry *subAreaTable, uintptr_t i)
+{
+	omrobjectptr_t freeBase = subAreaTable[i].firstObject;
+	omrobjectptr_t end = subAreaTable[i + 1].firstObject;
+
+	/* The mark bits of a fixup_only sub area are intact, as no forwarding information was stored over them */
+	MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)freeBase, (uintptr_t *)pageStart(pageIndex(end)));
+	omrobjectptr_t objectPtr = NULL;
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+		if (objectPtr > freeBase) {
+			addFreeEntry(env, memorySubSpace, poolState, (void *)freeBase, (uintptr_t)objectPtr - (uintptr_t)freeBase);
+		}
+		freeBase = (omrobjectptr_t)((uintptr_t)objectPtr + _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr));
+	}
+
+	return (freeBase < end) ? (void *)freeBase : NULL;
+}
+
 /*
  * Call appropriate Memory Pool to add a new free entry to the pool. If the free entry
  * spans more than one subpool then it will be split into 2 free entries.
@@ -1419,7 +1580,7 @@ MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	/* We only have to rebuild the markbits for sub areas which contain moved objects */
-        	if (subAreaTable->state != SubAreaEntry::fixup_only) {
+        	if (subAreaTable[i].state != SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
 	        		rebuildMarkbitsInSubArea(env, region, subAreaTable, i);
 				}
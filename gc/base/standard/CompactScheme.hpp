@@ -122,6 +122,16 @@ private:
 		};
 	};
 
+	/**
+	 * A sweep chunk selected by an incremental compaction (-Xgc:incrementalCompactBudget=)
+	 */
+	struct IncrementalRange {
+		uintptr_t base;
+		uintptr_t top;
+		uintptr_t fragmentedBytes; /**< free bytes outside the largest free entry of the chunk, plus its dark matter */
+		uintptr_t liveBytes; /**< estimate of the bytes evacuated if the chunk is compacted */
+	};
+
 protected:
 	OMR_VM                 *_omrVM;
 	MM_GCExtensionsBase    *_extensions;
@@ -138,6 +148,9 @@ protected:
 	omrobjectptr_t         _compactFrom;
 	omrobjectptr_t         _compactTo;
 	MM_CompactDelegate     _delegate;
+	IncrementalRange       *_incrementalRanges; /**< Sweep chunks selected for the current incremental compaction, in address order */
+	uintptr_t              _incrementalRangeCount; /**< Number of valid entries in _incrementalRanges */
+	bool                   _incremental; /**< true if the current compaction only compacts the sub areas overlapping _incrementalRanges */
 
 public:
 
@@ -170,6 +183,35 @@ protected:
 	void removeNullSubAreas(MM_EnvironmentStandard *env);
 	void completeSubAreaTable(MM_EnvironmentStandard *env);
 
+	/**
+	 * Rank the sweep chunks of the last sweep by fragmentation and keep the most fragmented ones whose
+	 * live bytes fit in the incremental compaction budget.  Must be called by the main thread before the
+	 * sub area table is built, as the table reuses the storage of the sweep chunks.
+	 *
+	 * @param env[in] the main thread
+	 */
+	void selectIncrementalRanges(MM_EnvironmentStandard *env);
+
+	/**
+	 * Demote every sub area which does not overlap a selected range to fixup_only, and narrow
+	 * the range of possibly forwarded objects to the sub areas which are still compacted.
+	 *
+	 * @param env[in] the main thread
+	 */
+	void selectIncrementalSubAreas(MM_EnvironmentStandard *env);
+
+	/**
+	 * Add the gaps between the (unmoved) live objects of a fixup_only sub area to the free list.
+	 *
+	 * @param env[in] the current thread
+	 * @param memorySubSpace[in] the subspace which owns the sub area
+	 * @param poolState[in/out] the free list being rebuilt
+	 * @param subAreaTable[in] the sub area table of the region
+	 * @param i[in] index of the sub area
+	 * @return the start of the trailing free area of the sub area, or NULL if it ends with an object
+	 */
+	void *rebuildFreelistInFixupOnlySubArea(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, MM_CompactMemoryPoolState *poolState, SubAreaEntry *subAreaTable, uintptr_t i);
+
 	void saveForwardingPtr(class CompactTableEntry&,
 					omrobjectptr_t objectPtr,
 					omrobjectptr_t forwardingPtr,
@@ -309,7 +351,15 @@ public:
 
 	void workerSetupForGC(MM_EnvironmentStandard *env, bool singleThreaded);
 	void mainSetupForGC(MM_EnvironmentStandard *env);
-	virtual void compact(MM_EnvironmentBase *env, bool rebuildMarkBits, bool aggressive);
+	/**
+	 * Compact the heap.
+	 *
+	 * @param env[in] the current thread
+	 * @param rebuildMarkBits[in] true if the mark map has to describe the heap after the compaction
+	 * @param aggressive[in] true to use a single sub area per region
+	 * @param incremental[in] true to only compact the most fragmented ranges (see -Xgc:incrementalCompactBudget=)
+	 */
+	virtual void compact(MM_EnvironmentBase *env, bool rebuildMarkBits, bool aggressive, bool incremental);
 	omrobjectptr_t getForwardingPtr(omrobjectptr_t objectPtr) const;
 	void flushPool(MM_EnvironmentStandard *env, MM_CompactMemoryPoolState *freeListState);
 	void fixHeapForWalk(MM_EnvironmentBase *env);
@@ -336,6 +386,9 @@ public:
 		, _subAreaTableSize(0)
 		, _subAreaTable(NULL)
 		, _delegate()
+		, _incrementalRanges(NULL)
+		, _incrementalRangeCount(0)
+		, _incremental(false)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -36,6 +36,7 @@
 #include "EnvironmentStandard.hpp"
 #include "Heap.hpp"
 #include "HeapMapIterator.hpp"
+#include "HeapMapScanner.hpp"
 #include "HeapRegionDescriptor.hpp"
 #include "HeapRegionIterator.hpp"
 #include "MarkingScheme.hpp"
@@ -482,6 +483,15 @@ MM_ConcurrentCardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
 			(*mmPrivateHooks)->J9HookRegisterWithCallSite(mmPrivateHooks, J9HOOK_MM_PRIVATE_CACHE_REFRESHED, tlhRefreshed, OMR_GET_CALLSITE(), (void *)this);
 		}
 	
+		/* The summary only covers cards dirtied through MM_CardTable, so it is opt in (-Xgc:dirtyCardSummary) */
+		if (_extensions->dirtyCardSummary && canUseDirtyCardSummary()) {
+			uintptr_t maximumCards = calculateCardTableSize(env, heap->getMaximumPhysicalRange()) / sizeof(Card);
+			_dirtyCardSummary = MM_DirtyCardSummary::newInstance(env, maximumCards);
+			if (NULL == _dirtyCardSummary) {
+				return false;
+			}
+		}
+	
 		/* Set default card cleaning masks used by getNextDirtycard */
 		_concurrentCardCleanMask = CONCURRENT_CARD_CLEAN_MASK;
 		_finalCardCleanMask = FINAL_CARD_CLEAN_MASK;
@@ -597,6 +607,7 @@ MM_ConcurrentCardTable::dirtyCardsInRange(MM_EnvironmentBase *env, void *heapBas
 		/* If card not already dirty then dirty it */
 		if (*baseCard != (Card)CARD_DIRTY) {
 			*baseCard = (Card)CARD_DIRTY;
+			summarizeDirtyCard(baseCard);
 		}
 		baseCard += 1;
 	}
@@ -662,6 +673,13 @@ MM_ConcurrentCardTable::prepareCardsForCleaning(MM_EnvironmentBase *env)
 			resetCleaningRanges(env);
 		}
 
+		/* Every card dirty now is visited by this pass, so the summary need only
+		 * remember cards dirtied from here on, or left dirty by the pass.
+		 */
+		if (NULL != _dirtyCardSummary) {
+			_dirtyCardSummary->clear();
+		}
+
 		MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_currentCleaningRange,
 											 	(uintptr_t)_currentCleaningRange,
 												(uintptr_t)_cleaningRanges);
@@ -692,6 +710,10 @@ MM_ConcurrentCardTable::prepareCardsForCleaning(MM_EnvironmentBase *env)
 			resetCleaningRanges(env);
 		}
 
+		if (NULL != _dirtyCardSummary) {
+			_dirtyCardSummary->clear();
+		}
+
 		break;
 	default:
 		assume0(0);
@@ -872,6 +894,8 @@ MM_ConcurrentCardTable::cleanCards(MM_EnvironmentBase *env, bool isMutator, uint
 		 * objects. Therefore we cannot be sure tracing into all active TLH's will be deferred.
 		 */
 		if (isCardInActiveTLH(env,nextDirtyCard) && !stats->getConcurrentWorkStackOverflowOcurred()) {
+			/* The card stays dirty */
+			summarizeDirtyCard(nextDirtyCard);
 			continue;
 		}
 
@@ -954,6 +978,7 @@ MM_ConcurrentCardTable::cleanSingleCard(MM_EnvironmentBase *env, Card *card, uin
 		if (env->isExclusiveAccessRequestWaiting()) {
 			/* Re-dirty the card as we did not finish cleaning it ... */
 			*card = (Card)CARD_DIRTY;
+			summarizeDirtyCard(card);
 			/* ...and get out now */
 			return false;
 		}
@@ -1000,6 +1025,7 @@ MM_ConcurrentCardTable::cleanSingleCard(MM_EnvironmentBase *env, Card *card, uin
 	 */
 	if (rememberedObjectsFound && (env->getExtensions()->isRememberedSetInOverflowState())) {
 		*card = (Card)CARD_DIRTY;
+		summarizeDirtyCard(card);
 	}
 
 	return true;
@@ -1012,6 +1038,14 @@ MM_ConcurrentCardTable::cleanSingleCard(MM_EnvironmentBase *env, Card *card, uin
 void
 MM_ConcurrentCardTable::initializeFinalCardCleaning(MM_EnvironmentBase *env)
 {
+	/* The summary holds every dirty card only if a concurrent pass over all the cards
+	 * finished since it was cleared, and the cards have not moved since
+	 */
+	_finalCleaningUsesSummary = (NULL != _dirtyCardSummary)
+			&& (UNINITIALIZED != _lastCardCleanPhase)
+			&& isCardCleaningComplete()
+			&& !_cardTableReconfigured;
+
 	if (_cardTableReconfigured){
 		determineCleaningRanges(env);
 	} else {
@@ -1048,6 +1082,10 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *byte
 	uintptr_t objects;
 	uintptr_t cards = 0;
 	bool phase2 = false;
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t cleanStartTime = omrtime_hires_clock();
+	uintptr_t cardsCleaned = 0;
+	uintptr_t cardsSkipped = env->_cardCleaningStats._cardsSkipped;
 
 	/* Set upper limit of refs we push before returning to one packets worth */
 	uintptr_t maxPushes = _markingScheme->getWorkPackets()->getSlotsInPacket();
@@ -1067,6 +1105,7 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *byte
 		/* Reset counters if we are now cleaning phase 2 cards */
 		if(!phase2 && nextDirtyCard >= _firstCardInPhase2) {
 			incFinalCleanedCards(cards, phase2);
+			cardsCleaned += cards;
 			cards = 0;
 			phase2 = true;
 		}
@@ -1100,6 +1139,12 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *byte
 	 * First update number of dirty cards cleaned
 	 */
 	incFinalCleanedCards(cards, phase2);
+	cardsCleaned += cards;
+
+	/* ..and how many clean cards the summary let us skip */
+	_cardTableStats.incFinalSkippedCards(env->_cardCleaningStats._cardsSkipped - cardsSkipped);
+	env->_cardCleaningStats._cardsCleaned += cardsCleaned;
+	env->_cardCleaningStats.addToCardCleaningTime(cleanStartTime, omrtime_hires_clock());
 
 	/* ..tell caller how many bytes we traced */
 	*bytesTraced = traceCount;
@@ -1614,6 +1659,7 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 
 	/* Get a local copy of next card to check */
 	Card *firstCard = (Card *)currentRange->nextCard;
+	bool useSummary = !concurrentCardClean && _finalCleaningUsesSummary;
 
 	while (NULL != firstCard) {
 
@@ -1639,8 +1685,12 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 				 * complete slots worth of cards; then go card at a time
 				 **/
 				uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)lastCardToClean);
-				while ((nextSlot < lastSlot) && (SLOT_ALL_CLEAN == *nextSlot)) {
-					nextSlot += 1;
+				if (useSummary) {
+					nextSlot = findDirtySlotUsingSummary(env, nextSlot, lastSlot);
+				} else {
+					while ((nextSlot < lastSlot) && (SLOT_ALL_CLEAN == *nextSlot)) {
+						nextSlot += 1;
+					}
 				}
 				/*
 			     * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
@@ -1726,6 +1776,41 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 	return NULL;
 }
 
+/**
+ * Find the next slot of the card table holding a card which is not clean, stepping over the
+ * granules the dirty card summary shows are clean and scanning the others with the heap map
+ * scanning kernel.
+ *
+ * @param slot - first slot to check, on a uintptr_t boundary
+ * @param lastSlot - slot after the last one to check
+ *
+ * @return the first slot with a card which is not clean, or lastSlot if there is none
+ */
+uintptr_t *
+MM_ConcurrentCardTable::findDirtySlotUsingSummary(MM_EnvironmentBase *env, uintptr_t *slot, uintptr_t *lastSlot)
+{
+	Card *cardTableStart = getCardTableStart();
+	uintptr_t lastIndex = (uintptr_t)((Card *)lastSlot - cardTableStart);
+	uintptr_t cardsSkipped = 0;
+
+	while (slot < lastSlot) {
+		uintptr_t index = (uintptr_t)((Card *)slot - cardTableStart);
+		uintptr_t dirtyIndex = _dirtyCardSummary->findPossiblyDirtyCard(index, lastIndex);
+		cardsSkipped += dirtyIndex - index;
+
+		/* Granules start on a slot boundary as the card table does */
+		uintptr_t granuleTopIndex = OMR_MIN(MM_Math::roundToFloor((uintptr_t)1 << DIRTY_CARD_SUMMARY_GRANULE_SHIFT, dirtyIndex) + ((uintptr_t)1 << DIRTY_CARD_SUMMARY_GRANULE_SHIFT), lastIndex);
+		uintptr_t *granuleTopSlot = (uintptr_t *)(cardTableStart + granuleTopIndex);
+		slot = MM_HeapMapScanner::findNonEmptySlot((uintptr_t *)(cardTableStart + dirtyIndex), granuleTopSlot);
+		if (slot < granuleTopSlot) {
+			break;
+		}
+	}
+
+	env->_cardCleaningStats._cardsSkipped += cardsSkipped;
+	return slot;
+}
+
 /**
  * Set TLH mark bits
  *
@@ -153,6 +153,7 @@ private:
 	uintptr_t *_tlhMarkBits;
 	bool _cardTableReconfigured;
 	bool _cleanAllCards;
+	bool _finalCleaningUsesSummary; /**< True if final card cleaning may skip ranges the dirty card summary shows are clean */
 protected:
 	OMR_VM *_omrVM;
 	MM_ConcurrentGC *_collector;
@@ -194,6 +195,7 @@ private:
 	void determineCleaningRanges(MM_EnvironmentBase *env);
 	void resetCleaningRanges(MM_EnvironmentBase *env);
 	bool isCardInActiveTLH(MM_EnvironmentBase *env, Card *card);
+	uintptr_t *findDirtySlotUsingSummary(MM_EnvironmentBase *env, uintptr_t *slot, uintptr_t *lastSlot);
 	
 	void reportCardCleanPass2Start(MM_EnvironmentBase *env);
 		
@@ -237,6 +239,11 @@ protected:
 	virtual void prepareCardsForCleaning(MM_EnvironmentBase *env);
 	virtual bool getExclusiveCardTableAccess(MM_EnvironmentBase *env, CardCleanPhase currentPhase, bool threadAtSafePoint);
 	virtual void releaseExclusiveCardTableAccess(MM_EnvironmentBase *env);
+
+	/**
+	 * @return true if the cards can be tracked by a dirty card summary (-Xgc:dirtyCardSummary)
+	 */
+	virtual bool canUseDirtyCardSummary() { return true; }
 	
 	MMINLINE virtual void concurrentCleanCard(Card *card) { *card = CARD_CLEAN; };
 	MMINLINE virtual void finalCleanCard(Card *card) { *card = CARD_CLEAN; };
@@ -476,6 +483,7 @@ public:
 		_tlhMarkBits(NULL),
 		_cardTableReconfigured(false),
 		_cleanAllCards(false),
+		_finalCleaningUsesSummary(false),
 		_omrVM(env->getOmrVM()),
 		_collector(collector),
 		_extensions(MM_GCExtensionsBase::getExtensions(_omrVM)),
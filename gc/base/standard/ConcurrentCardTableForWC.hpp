@@ -77,6 +77,9 @@ class MM_ConcurrentCardTableForWC : public MM_ConcurrentCardTable
 	{
 		*card = CARD_CLEAN;	
 	};		
+
+	/* Cards left CARD_CLEAN_SAFE by concurrent cleaning are dirtied again outside MM_CardTable */
+	virtual bool canUseDirtyCardSummary() { return false; }
 	
 	
 public:
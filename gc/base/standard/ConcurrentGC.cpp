@@ -318,7 +318,8 @@ MM_ConcurrentGC::reportConcurrentFinalCardCleaningEnd(MM_EnvironmentBase *env, u
 		cardTable->getCardTableStats()->getCardCleaningPhase1Kickoff(),
 		cardTable->getCardTableStats()->getCardCleaningPhase2Kickoff(),
 		cardTable->getCardTableStats()->getCardCleaningPhase3Kickoff(),
-		_stats.getConcurrentWorkStackOverflowCount()
+		_stats.getConcurrentWorkStackOverflowCount(),
+		cardTable->getCardTableStats()->getFinalSkippedCards()
 	);
 }
 
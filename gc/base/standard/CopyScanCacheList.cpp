@@ -36,13 +36,16 @@
 #if defined(OMR_GC_MODRON_SCAVENGER)
 
 bool
-MM_CopyScanCacheList::initialize(MM_EnvironmentBase *env, volatile uintptr_t *cachedEntryCount)
+MM_CopyScanCacheList::initialize(MM_EnvironmentBase *env, volatile uintptr_t *cachedEntryCount, uintptr_t nodeCount)
 {
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 	bool result = true;
 	
-	_sublistCount = extensions->cacheListSplit;
-	Assert_MM_true(0 < _sublistCount);
+	Assert_MM_true(0 < nodeCount);
+	_nodeCount = nodeCount;
+	_sublistsPerNode = extensions->cacheListSplit;
+	Assert_MM_true(0 < _sublistsPerNode);
+	_sublistCount = _sublistsPerNode * _nodeCount;
 
 	_sublists = (struct CopyScanCacheSublist *)extensions->getForge()->allocate(sizeof(struct CopyScanCacheSublist) * _sublistCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
 	if (NULL == _sublists) {
@@ -202,7 +205,7 @@ MM_CopyScanCacheList::appendCacheEntries(MM_EnvironmentBase *env, uintptr_t cach
 	MM_CopyScanCacheStandard *sublistTail = NULL;
 	MM_CopyScanCacheChunk *chunk = MM_CopyScanCacheChunk::newInstance(env, cacheEntryCount, _chunkHead, &sublistTail);
 	if(NULL != chunk) {
-		uintptr_t index = getSublistIndex(env);
+		uintptr_t index = getSublistIndex(env, 0);
 
 		Assert_MM_true(NULL != sublistTail);
 		Assert_MM_true(NULL == sublistTail->next);
@@ -229,7 +232,7 @@ MM_CopyScanCacheList::appendCacheEntriesInHeap(MM_EnvironmentStandard *env, MM_M
 	uintptr_t entries = 0;
 	MM_CopyScanCacheChunkInHeap *chunk = MM_CopyScanCacheChunkInHeap::newInstance(env, _chunkHead, memorySubSpace, requestCollector, &sublistTail, &entries);
 	if(NULL != chunk) {
-		uintptr_t index = getSublistIndex(env);
+		uintptr_t index = getSublistIndex(env, 0);
 
 		Assert_MM_true(0 <= entries);
 		Assert_MM_true(NULL != sublistTail);
@@ -298,9 +301,9 @@ MM_CopyScanCacheList::decrementCount(CopyScanCacheSublist *sublist, uintptr_t va
 }
 
 void
-MM_CopyScanCacheList::pushCache(MM_EnvironmentBase *env, MM_CopyScanCacheStandard *cacheEntry)
+MM_CopyScanCacheList::pushCache(MM_EnvironmentBase *env, MM_CopyScanCacheStandard *cacheEntry, uintptr_t node)
 {
-	MM_CopyScanCacheList::CopyScanCacheSublist *list = &_sublists[getSublistIndex(env)];
+	MM_CopyScanCacheList::CopyScanCacheSublist *list = &_sublists[getSublistIndex(env, node)];
 
 	/* This is a useful assertion to find who drop the same element to list twice
 	 * It is fatal and caused hang right away.
@@ -318,13 +321,15 @@ MM_CopyScanCacheList::pushCache(MM_EnvironmentBase *env, MM_CopyScanCacheStandar
 }
 
 MM_CopyScanCacheStandard *
-MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env)
+MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env, uintptr_t node)
 {
-	uintptr_t index = getSublistIndex(env);
+	uintptr_t offset = env->getEnvironmentId() % _sublistsPerNode;
 	MM_CopyScanCacheStandard *cache = NULL;
 
+	/* walk the sublists of the caller's node group first, then those of the following groups */
 	for (uintptr_t i = 0; i < _sublistCount; i++) {
-		MM_CopyScanCacheList::CopyScanCacheSublist *list = &_sublists[index];
+		uintptr_t group = (node + (i / _sublistsPerNode)) % _nodeCount;
+		MM_CopyScanCacheList::CopyScanCacheSublist *list = &_sublists[(group * _sublistsPerNode) + ((offset + i) % _sublistsPerNode)];
 
 		if (NULL != list->_cacheHead) {
 			env->_scavengerStats._acquireListLockCount += 1;
@@ -344,8 +349,6 @@ MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env)
 				break;
 			}
 		}
-
-		index = (index + 1) % _sublistCount;
 	}
 
 	return cache;
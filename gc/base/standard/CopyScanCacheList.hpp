@@ -75,6 +75,8 @@ private:
 	
 	struct CopyScanCacheSublist *_sublists;	/**< An array of CopyScanCacheSublist structures which is _sublistCount elements long */
 	uintptr_t _sublistCount; /**< the number of lists (split for parallelism). Must be at least 1 */
+	uintptr_t _nodeCount; /**< the number of NUMA nodes the sublists are grouped by (1 unless the scavenger copies by NUMA node) */
+	uintptr_t _sublistsPerNode; /**< the number of sublists in each node group */
 	
 	MM_CopyScanCacheChunk *_chunkHead; 
 	uintptr_t _incrementEntryCount;
@@ -96,12 +98,13 @@ private:
 	 * it should use
 	 * 
 	 * @param env the current environment
+	 * @param node the NUMA node group to pick the sublist from
 	 * 
 	 * @return an index into the _sublists array
 	 */
-	uintptr_t getSublistIndex(MM_EnvironmentBase *env)
+	uintptr_t getSublistIndex(MM_EnvironmentBase *env, uintptr_t node)
 	{
-		return env->getEnvironmentId() % _sublistCount;
+		return (node * _sublistsPerNode) + (env->getEnvironmentId() % _sublistsPerNode);
 	}
 	
 	/**
@@ -126,7 +129,13 @@ private:
 
 protected:
 public:
-	bool initialize(MM_EnvironmentBase *env, volatile uintptr_t *cachedEntryCount);
+	/**
+	 * @param env[in] the current thread
+	 * @param cachedEntryCount[in] shared count of non-empty sublists, or NULL
+	 * @param nodeCount[in] the number of NUMA node groups to split the sublists into
+	 * @return true on success
+	 */
+	bool initialize(MM_EnvironmentBase *env, volatile uintptr_t *cachedEntryCount, uintptr_t nodeCount = 1);
 	virtual void tearDown(MM_EnvironmentBase *env);
 
 	/**
@@ -184,15 +193,17 @@ public:
 	 * Add the specified entry to this list.
 	 * @param env[in] the current GC thread
 	 * @param cacheEntry[in] the cache entry to add
+	 * @param node[in] the NUMA node group the entry belongs to
 	 */
-	void pushCache(MM_EnvironmentBase *env, MM_CopyScanCacheStandard *cacheEntry);
+	void pushCache(MM_EnvironmentBase *env, MM_CopyScanCacheStandard *cacheEntry, uintptr_t node = 0);
 
 	/**
-	 * Pop a cache entry from this list.
+	 * Pop a cache entry from this list.  The sublists of the given node group are tried first.
 	 * @param env[in] the current GC thread
+	 * @param node[in] the NUMA node group of the calling thread
 	 * @return the cache entry, or NULL if the list is empty
 	 */
-	MM_CopyScanCacheStandard *popCache(MM_EnvironmentBase *env);
+	MM_CopyScanCacheStandard *popCache(MM_EnvironmentBase *env, uintptr_t node = 0);
 
 	/**
 	 * Create a CopyScanCacheList object.
@@ -202,6 +213,8 @@ public:
 		, _allocationInHeap(false)
 		, _sublists(NULL)
 		, _sublistCount(0)
+		, _nodeCount(1)
+		, _sublistsPerNode(0)
 		, _chunkHead(NULL)
 		, _incrementEntryCount(0)
 		, _totalAllocatedEntryCount(0)
@@ -66,6 +66,8 @@ public:
 	bool _loaAllocation;  /** true, if tenure TLH remainder is in LOA (TODO: try preventing remainder creation in LOA) */
 	void *_survivorTLHRemainderBase; /**< base and top pointers of the last unused survivor TLH copy cache, that might be reused  on next copy refresh */
 	void *_survivorTLHRemainderTop;
+	uintptr_t _scavengerNumaNode; /**< index (into the affinity leaders) of the NUMA node this thread copies to when -Xgc:scavengerNumaAffinity is active */
+	bool _scavengerNumaNodeBound; /**< true if this thread has already been bound to the physical node of _scavengerNumaNode */
 
 protected:
 
@@ -98,6 +100,8 @@ public:
 		,_loaAllocation(false)
 		,_survivorTLHRemainderBase(NULL)
 		,_survivorTLHRemainderTop(NULL)
+		,_scavengerNumaNode(0)
+		,_scavengerNumaNodeBound(false)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -109,6 +113,8 @@ public:
 	void flushRememberedSet()
 	{
 		MM_SublistFragment::flush(&_scavengerRememberedSet);
+		/* the fragment has to grow again in the next cycle (-Xgc:rememberedSetMaxFragmentSize) */
+		_scavengerRememberedSet.fragmentSize = (uintptr_t)OMR_SCV_REMSET_FRAGMENT_SIZE;
 	}
 #endif
 
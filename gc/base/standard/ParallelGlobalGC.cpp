@@ -44,6 +44,7 @@
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIteratorStandard.hpp"
 #include "MarkingScheme.hpp"
+#include "Math.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 #include "MemorySubSpaceSemiSpace.hpp"
@@ -474,7 +475,10 @@ MM_ParallelGlobalGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_Alloca
 		}
 
 		mainThreadCompact(env, allocDescription, rebuildMarkBits);
-		_collectionStatistics._tenureFragmentation = NO_FRAGMENTATION;
+		MM_CompactStats *compactStats = &_extensions->globalGCStats.compactStats;
+		if (!compactStats->_incremental || (0 == compactStats->_remainingFragmentedBytes)) {
+			_collectionStatistics._tenureFragmentation = NO_FRAGMENTATION;
+		}
 		if (_extensions->processLargeAllocateStats) {
 			processLargeAllocateStatsAfterCompact(env);
 		}
@@ -722,7 +726,10 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 		uintptr_t totalSize = memorySubSpace->getActiveMemorySize();
 		MM_MemoryPool *memoryPool= memorySubSpace->getMemoryPool();
 		uintptr_t darkMatterBytes = 0;
-		if (!_extensions->concurrentSweep) {
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+		if (!_extensions->concurrentSweep)
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+		{
 			darkMatterBytes = memoryPool->getDarkMatterBytes();
 		}
 		uintptr_t freeMemorySize = memoryPool->getActualFreeMemorySize();
@@ -988,9 +995,24 @@ MM_ParallelGlobalGC::mainThreadCompact(MM_EnvironmentBase *env, MM_AllocateDescr
 	markMap->setMarkMapValid(false);
 	_compactScheme->setMarkMap(markMap);
 
+	/* Compactions which only have to reduce fragmentation may leave the least fragmented parts of the heap for later cycles */
+	bool incremental = false;
+	if (0 != _extensions->incrementalCompactBudget) {
+		switch (compactStats->_compactReason) {
+		case COMPACT_FRAGMENTED:
+		case COMPACT_MICRO_FRAG:
+		case COMPACT_PAGE:
+		case COMPACT_ALWAYS:
+			incremental = true;
+			break;
+		default:
+			break;
+		}
+	}
+
 	reportCompactStart(env);
 	compactStats->_startTime = omrtime_hires_clock();
-	MM_ParallelCompactTask compactTask(env, _dispatcher, _compactScheme, rebuildMarkBits, env->_cycleState->_gcCode.shouldAggressivelyCompact());
+	MM_ParallelCompactTask compactTask(env, _dispatcher, _compactScheme, rebuildMarkBits, env->_cycleState->_gcCode.shouldAggressivelyCompact(), incremental);
 	_dispatcher->run(env, &compactTask);
 	compactStats->_endTime = omrtime_hires_clock();
 	reportCompactEnd(env);
@@ -1055,6 +1077,14 @@ MM_ParallelGlobalGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	}
 
 	GC_OMRVMInterface::flushCachesForGC(env);
+
+	if (_extensions->heapSizingCostModel) {
+		/* Growth of the tenure space since the last global GC gives the allocation rate the cost model sizes it for */
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		MM_Heap *heap = _extensions->heap;
+		uintptr_t usedBytes = MM_Math::saturatingSubtract(heap->getActiveMemorySize(MEMORY_TYPE_OLD), heap->getApproximateActiveFreeMemorySize(MEMORY_TYPE_OLD));
+		heap->getResizeStats()->setGlobalGCStart(omrtime_hires_clock(), usedBytes);
+	}
 	
 	_markingScheme->getMarkMap()->setMarkMapValid(false);
 	
@@ -1089,6 +1119,13 @@ MM_ParallelGlobalGC::internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSp
 
 	tenureMemoryPoolPostCollect(env);
 
+	if (_extensions->heapSizingCostModel) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		MM_Heap *heap = _extensions->heap;
+		uintptr_t usedBytes = MM_Math::saturatingSubtract(heap->getActiveMemorySize(MEMORY_TYPE_OLD), heap->getApproximateActiveFreeMemorySize(MEMORY_TYPE_OLD));
+		heap->getResizeStats()->setGlobalGCEnd(omrtime_hires_clock(), usedBytes);
+	}
+
 	reportGCCycleFinalIncrementEnding(env);
 	reportGlobalGCIncrementEnd(env);
 	reportGCIncrementEnd(env);
@@ -47,6 +47,7 @@
 #include "SweepPoolState.hpp"
 #include "MarkMap.hpp"
 #include "ModronAssertions.h"
+#include "HeapMapScanner.hpp"
 #include "HeapMapWordIterator.hpp"
 #include "ObjectModel.hpp"
 #include "Math.hpp"
@@ -341,14 +342,7 @@ MM_ParallelSweepScheme::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		markMapCurrent = MM_HeapMapScanner::findNonEmptySlot(markMapCurrent + 1, markMapChunkTop);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
@@ -230,7 +230,12 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
-	if (!_scavengeCacheScanList.initialize(env, &_cachedEntryCount)) {
+	if (!_numaAffinity.initialize(env)) {
+		return false;
+	}
+
+	/* with NUMA placement, scan caches are queued on (and preferably taken from) the node they were copied to */
+	if (!_scavengeCacheScanList.initialize(env, &_cachedEntryCount, OMR_MAX(_numaAffinity.getNodeCount(), 1))) {
 		return false;
 	}
 
@@ -245,6 +250,8 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	_extensions->rememberedSet.setPuddleBatchCount(_extensions->rememberedSetPuddleBatch);
+	_extensions->rememberedSet.setMaxFragmentSize(_extensions->rememberedSetMaxFragmentSize);
 
 	/* No thread can use more than _cachesPerThread cache entries at 1 time (flip, tenure, scan, large, possibly deferred)
 	 * So long as (N * _cachesPerThread) cache entries exist,the head of the scan list
@@ -308,6 +315,7 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
+	_numaAffinity.tearDown(env);
 
 	if (NULL != _scanCacheMonitor) {
 		omrthread_monitor_destroy(_scanCacheMonitor);
@@ -471,6 +479,10 @@ MM_Scavenger::workerSetupForGC(MM_EnvironmentStandard *env)
 	env->_scavengerRememberedSet.fragmentSize = (uintptr_t)OMR_SCV_REMSET_FRAGMENT_SIZE;
 	env->_scavengerRememberedSet.parentList = &_extensions->rememberedSet;
 
+	if (_numaAffinity.isActive()) {
+		_numaAffinity.threadSetup(env);
+	}
+
 	/* caches should all be reset */
 	Assert_MM_true(NULL == env->_survivorCopyScanCache);
 	Assert_MM_true(NULL == env->_tenureCopyScanCache);
@@ -579,6 +591,15 @@ MM_Scavenger::scavenge(MM_EnvironmentBase *envBase)
 	MM_ParallelScavengeTask scavengeTask(env, _dispatcher, this, env->_cycleState, _recommendedThreads);
 	_dispatcher->run(env, &scavengeTask);
 
+	if (_numaAffinity.isActive()) {
+		/* chunks parked for a node which never needed them are discarded like any other copy cache remainder */
+		uintptr_t flipDiscardBytes = 0;
+		uintptr_t tenureDiscardBytes = 0;
+		_numaAffinity.discardAllSpareChunks(&flipDiscardBytes, &tenureDiscardBytes);
+		_extensions->incrementScavengerStats._flipDiscardBytes += flipDiscardBytes;
+		_extensions->incrementScavengerStats._tenureDiscardBytes += tenureDiscardBytes;
+	}
+
 	/* remove all scan caches temporary allocated in Heap */
 	_scavengeCacheFreeList.removeAllHeapAllocatedChunks(env);
 
@@ -815,6 +836,9 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	finalGCStats->_tenureExpandedCount += scavStats->_tenureExpandedCount;
 	finalGCStats->_tenureExpandedTime += scavStats->_tenureExpandedTime;
 
+	finalGCStats->_numaLocalCopyBytes += scavStats->_numaLocalCopyBytes;
+	finalGCStats->_numaRemoteCopyBytes += scavStats->_numaRemoteCopyBytes;
+
 #if defined(OMR_SCAVENGER_TRACK_COPY_DISTANCE)
 	for (uintptr_t i = 0; i < OMR_SCAVENGER_DISTANCE_BINS; i++) {
 		finalGCStats->_copy_distance_counts[i] += scavStats->_copy_distance_counts[i];
@@ -1174,7 +1198,11 @@ retry:
 				MM_AllocateDescription allocDescription(0, 0, false, true);
 				/* Update the optimum scan cache size */
 				uintptr_t scanCacheSize = calculateOptimumCopyScanCacheSize(env);
-				allocateResult = (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				if (_numaAffinity.isActive()) {
+					allocateResult = _numaAffinity.allocateCopyChunk(env, this, _survivorMemorySubSpace, &allocDescription, scanCacheSize, false, addrBase, addrTop);
+				} else {
+					allocateResult = (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				}
 				env->_scavengerStats._semiSpaceAllocationCountSmall += 1;
 			}
 		}
@@ -1207,6 +1235,9 @@ retry:
 				/* clear all flags except "allocated in heap" might be set already*/
 				copyCache->flags &= OMR_SCAVENGER_CACHE_TYPE_HEAP;
 				copyCache->flags |= OMR_SCAVENGER_CACHE_TYPE_SEMISPACE | OMR_SCAVENGER_CACHE_TYPE_COPY;
+				if (_numaAffinity.isActive() && (_numaAffinity.getNodeForAddress(addrBase) != env->_scavengerNumaNode)) {
+					copyCache->flags |= OMR_SCAVENGER_CACHE_TYPE_NUMA_REMOTE;
+				}
 				copyCache->reinitCache(addrBase, addrTop);
 			} else {
 				/* can not allocate a copyCache header, release allocated memory */
@@ -1296,7 +1327,11 @@ retry:
 				MM_AllocateDescription allocDescription(0, 0, false, true);
 				allocDescription.setCollectorAllocateExpandOnFailure(true);
 				uintptr_t scanCacheSize = calculateOptimumCopyScanCacheSize(env);
-				allocateResult = (NULL != _tenureMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				if (_numaAffinity.isActive()) {
+					allocateResult = _numaAffinity.allocateCopyChunk(env, this, _tenureMemorySubSpace, &allocDescription, scanCacheSize, true, addrBase, addrTop);
+				} else {
+					allocateResult = (NULL != _tenureMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				}
 
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
 				if (allocateResult && allocDescription.isLOAAllocation()) {
@@ -1341,6 +1376,9 @@ retry:
 					copyCache->flags |= OMR_SCAVENGER_CACHE_TYPE_LOA;
 				}
 #endif /* OMR_GC_LARGE_OBJECT_AREA */
+				if (_numaAffinity.isActive() && (_numaAffinity.getNodeForAddress(addrBase) != env->_scavengerNumaNode)) {
+					copyCache->flags |= OMR_SCAVENGER_CACHE_TYPE_NUMA_REMOTE;
+				}
 				copyCache->reinitCache(addrBase, addrTop);
 			} else {
 				/* can not allocate a copyCache header, release allocated memory */
@@ -1559,6 +1597,14 @@ MM_Scavenger::forwardingSucceeded(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 		scavStats->_flipBytes += objectCopySizeInBytes;
 		scavStats->getFlipHistory(0)->_flipBytes[oldObjectAge + 1] += objectReserveSizeInBytes;
 	}
+
+	if (_numaAffinity.isActive()) {
+		if (0 != (copyCache->flags & OMR_SCAVENGER_CACHE_TYPE_NUMA_REMOTE)) {
+			scavStats->_numaRemoteCopyBytes += objectCopySizeInBytes;
+		} else {
+			scavStats->_numaLocalCopyBytes += objectCopySizeInBytes;
+		}
+	}
 }
 
 MMINLINE omrobjectptr_t
@@ -2003,13 +2049,54 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 	GC_SlotObject *slotObject = NULL;
 
 	MM_CopyScanCacheStandard **copyCache = &(env->_effectiveCopyScanCache);
-	while (NULL != (slotObject = objectScanner->getNextSlot())) {
-		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
-		shouldRemember |= isSlotObjectInNewSpace;
-		if (NULL != *copyCache) {
-			slotsCopied += 1;
+	uintptr_t prefetchDistance = _extensions->scanPrefetchDistance;
+	if (0 == prefetchDistance) {
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+			bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
+			shouldRemember |= isSlotObjectInNewSpace;
+			if (NULL != *copyCache) {
+				slotsCopied += 1;
+			}
+			slotsScanned += 1;
+		}
+	} else {
+		/* The objects in a scan cache are laid out in scan order already, the misses are on the
+		 * referents in evacuate space.  Each slot is held in a FIFO with its referent prefetched,
+		 * and only copied and forwarded once prefetchDistance younger slots have been seen.
+		 */
+		fomrobject_t *pendingSlots[MM_SCAN_PREFETCH_DISTANCE_MAX];
+		uintptr_t head = 0;
+		uintptr_t count = 0;
+		while (true) {
+			fomrobject_t *slotToCopy = NULL;
+			if (NULL != (slotObject = objectScanner->getNextSlot())) {
+				omrobjectptr_t referent = slotObject->readReferenceFromSlot();
+				if (isObjectInEvacuateMemory(referent)) {
+					MM_PREFETCH_FOR_READ(referent);
+				}
+				if (count < prefetchDistance) {
+					pendingSlots[(head + count) % prefetchDistance] = slotObject->readAddressFromSlot();
+					count += 1;
+					continue;
+				}
+				slotToCopy = pendingSlots[head];
+				pendingSlots[head] = slotObject->readAddressFromSlot();
+			} else if (0 < count) {
+				slotToCopy = pendingSlots[head];
+				count -= 1;
+			} else {
+				break;
+			}
+			head = (head + 1) % prefetchDistance;
+
+			GC_SlotObject pendingSlotObject(_omrVM, slotToCopy);
+			bool isSlotObjectInNewSpace = copyAndForward(env, &pendingSlotObject);
+			shouldRemember |= isSlotObjectInNewSpace;
+			if (NULL != *copyCache) {
+				slotsCopied += 1;
+			}
+			slotsScanned += 1;
 		}
-		slotsScanned += 1;
 	}
 	updateCopyScanCounts(env, slotsScanned, slotsCopied);
 
@@ -3565,7 +3652,8 @@ MM_Scavenger::returnEmptyCopyCachesToFreeList(MM_EnvironmentStandard *env)
 MMINLINE void
 MM_Scavenger::addCacheEntryToScanListAndNotify(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *newCacheEntry)
 {
-	_scavengeCacheScanList.pushCache(env, newCacheEntry);
+	uintptr_t node = _numaAffinity.isActive() ? _numaAffinity.getNodeForAddress(newCacheEntry->cacheBase) : 0;
+	_scavengeCacheScanList.pushCache(env, newCacheEntry, node);
 	if (0 != _waitingCount) {
 		/* Added an entry to the list - notify any other threads that a new entry has appeared on the list */
 		if (0 == omrthread_monitor_try_enter(_scanCacheMonitor)) {
@@ -3644,7 +3732,7 @@ MM_Scavenger::aliasToCopyCache(MM_EnvironmentStandard *env, GC_SlotObject *scann
 MMINLINE MM_CopyScanCacheStandard *
 MM_Scavenger::getNextScanCacheFromList(MM_EnvironmentStandard *env)
 {
-	return _scavengeCacheScanList.popCache(env);
+	return _scavengeCacheScanList.popCache(env, env->_scavengerNumaNode);
 }
 
 /**
@@ -4973,6 +5061,16 @@ MM_Scavenger::calculateTenureMask()
 	/* always tenure objects which have reached the maximum age */
 	uintptr_t newMask = ((uintptr_t)1 << OBJECT_HEADER_AGE_MAX);
 
+	if (_extensions->scvTenureStrategyPredictive) {
+		/* The prediction already weighs every age, the other strategies would only tenure earlier.
+		 * Until there is enough history they still decide.
+		 */
+		uintptr_t predictedMask = calculateTenureMaskUsingPrediction(_extensions->scvTenurePredictorHorizon, _extensions->scvTenurePredictorPromotionCost);
+		if (0 != predictedMask) {
+			return newMask | predictedMask;
+		}
+	}
+
 	/* Delegate tenure mask calculations to the active strategies. */
 	if (_extensions->scvTenureStrategyFixed) {
 		newMask |= calculateTenureMaskUsingFixed(_extensions->scvTenureFixedTenureAge);
@@ -5133,6 +5231,95 @@ MM_Scavenger::calculateTenureMaskUsingHistory(double minimumSurvivalRate)
 	return mask;
 }
 
+uintptr_t
+MM_Scavenger::calculateTenureMaskUsingPrediction(uintptr_t horizon, uintptr_t promotionCost)
+{
+	Assert_MM_true(0 < horizon);
+
+	MM_ScavengerStats *stats = &_extensions->scavengerStats;
+
+	/* Histories are indexed by age before the copy plus one, so the bytes flipped at index age
+	 * are the survivor space population of that age at the next scavenge. Skip the first row
+	 * (it's the current scavenge, and is all zero right now).
+	 */
+	double survivalRate[OBJECT_HEADER_AGE_MAX + 1];
+	double rate = 1.0;
+	bool haveRates = false;
+	survivalRate[0] = 0.0;
+	for (uintptr_t age = 1; age <= OBJECT_HEADER_AGE_MAX; age++) {
+		double populationBytes = 0.0;
+		double liveBytes = 0.0;
+		for (uintptr_t lookback = 1; lookback < SCAVENGER_FLIP_HISTORY_SIZE - 1; lookback++) {
+			uintptr_t population = stats->getFlipHistory(lookback + 1)->_flipBytes[age];
+			if (0 != population) {
+				populationBytes += (double)population;
+				liveBytes += (double)(stats->getFlipHistory(lookback)->_flipBytes[age + 1] + stats->getFlipHistory(lookback)->_tenureBytes[age + 1]);
+			}
+		}
+		/* an age nothing has reached yet is assumed to survive like the age before it */
+		if (0.0 < populationBytes) {
+			rate = OMR_MIN(liveBytes / populationBytes, 1.0);
+			haveRates = true;
+		}
+		survivalRate[age] = rate;
+	}
+
+	/* Bytes of new objects surviving their first scavenge */
+	double newBytes = 0.0;
+	uintptr_t newSamples = 0;
+	for (uintptr_t lookback = 1; lookback < SCAVENGER_FLIP_HISTORY_SIZE; lookback++) {
+		uintptr_t liveBytes = stats->getFlipHistory(lookback)->_flipBytes[1] + stats->getFlipHistory(lookback)->_tenureBytes[1];
+		if (0 != liveBytes) {
+			newBytes += (double)liveBytes;
+			newSamples += 1;
+		}
+	}
+	if (!haveRates || (0 == newSamples)) {
+		return 0;
+	}
+	newBytes /= (double)newSamples;
+
+	/* The survivor space as it is now, and what this scavenge is expected to find live */
+	double initialPopulation[OBJECT_HEADER_AGE_MAX + 1];
+	initialPopulation[0] = 0.0;
+	stats->_predictedLiveBytes[0] = (uintptr_t)newBytes;
+	for (uintptr_t age = 1; age <= OBJECT_HEADER_AGE_MAX; age++) {
+		initialPopulation[age] = (double)stats->getFlipHistory(1)->_flipBytes[age];
+		stats->_predictedLiveBytes[age] = (uintptr_t)(initialPopulation[age] * survivalRate[age]);
+	}
+
+	/* Project the survivor space over the horizon for each tenure age. Ties go to the older age,
+	 * so nothing is promoted early when it makes no difference.
+	 */
+	uintptr_t bestTenureAge = OBJECT_HEADER_AGE_MAX;
+	double bestCost = 0.0;
+	for (uintptr_t tenureAge = OBJECT_HEADER_AGE_MIN; tenureAge <= OBJECT_HEADER_AGE_MAX; tenureAge++) {
+		double population[OBJECT_HEADER_AGE_MAX + 1];
+		memcpy(population, initialPopulation, sizeof(population));
+		double cost = 0.0;
+		for (uintptr_t scavenge = 0; scavenge < horizon; scavenge++) {
+			double nextPopulation[OBJECT_HEADER_AGE_MAX + 1];
+			memset(nextPopulation, 0, sizeof(nextPopulation));
+			for (uintptr_t age = 0; age <= OBJECT_HEADER_AGE_MAX; age++) {
+				double liveBytes = (0 == age) ? newBytes : (population[age] * survivalRate[age]);
+				if (age >= tenureAge) {
+					cost += liveBytes * (double)promotionCost;
+				} else {
+					cost += liveBytes;
+					nextPopulation[age + 1] = liveBytes;
+				}
+			}
+			memcpy(population, nextPopulation, sizeof(population));
+		}
+		if ((OBJECT_HEADER_AGE_MIN == tenureAge) || (cost <= bestCost)) {
+			bestCost = cost;
+			bestTenureAge = tenureAge;
+		}
+	}
+
+	return calculateTenureMaskUsingFixed(bestTenureAge);
+}
+
 uintptr_t
 MM_Scavenger::calculateTenureMaskUsingFixed(uintptr_t tenureAge)
 {
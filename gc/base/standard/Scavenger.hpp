@@ -42,6 +42,7 @@
 #include "MainGCThread.hpp"
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 #include "ScavengerDelegate.hpp"
+#include "ScavengerNumaAffinity.hpp"
 
 struct J9HookInterface;
 class GC_ObjectScanner;
@@ -107,6 +108,7 @@ private:
 
 	MM_CopyScanCacheList _scavengeCacheFreeList; /**< pool of unused copy-scan caches */
 	MM_CopyScanCacheList _scavengeCacheScanList; /**< scan lists */
+	MM_ScavengerNumaAffinity _numaAffinity; /**< NUMA placement of copy destinations (-Xgc:scavengerNumaAffinity) */
 	volatile uintptr_t _cachedEntryCount; /**< non-empty scanCacheList count (not the total count of caches in the lists) */
 	uintptr_t _cachesPerThread; /**< maximum number of copy and scan caches required per thread at any one time */
 	omrthread_monitor_t _scanCacheMonitor; /**< monitor to synchronize threads on scan lists */
@@ -627,6 +629,19 @@ public:
 	 */
 	uintptr_t calculateTenureMaskUsingFixed(uintptr_t tenureAge);
 
+	/**
+	 * The implementation of the Predictive scavenger tenure strategy.
+	 * The survival rate of each age is estimated from the survival history, and the
+	 * survivor space is projected forward over the next horizon scavenges for every tenure
+	 * age. The age with the lowest projected cost, counting each copied byte once and each
+	 * promoted byte promotionCost times, is tenured. The live bytes projected for this
+	 * scavenge are recorded in the cycle stats so they can be compared with what is found.
+	 * @param horizon The number of scavenges to project.
+	 * @param promotionCost The cost of promoting a byte relative to copying it.
+	 * @return A tenure mask for the resulting ages to tenure, or 0 if there is not enough history.
+	 */
+	uintptr_t calculateTenureMaskUsingPrediction(uintptr_t horizon, uintptr_t promotionCost);
+
 	/**
 	 * Calculates which generations should be tenured in the form of a bit mask.
 	 * @return mask of ages to tenure
@@ -923,6 +938,7 @@ public:
 		, _recommendedThreads(UDATA_MAX)
 		, _cycleState()
 		, _collectionStatistics()
+		, _numaAffinity(env)
 		, _cachedEntryCount(0)
 		, _cachesPerThread(0)
 		, _scanCacheMonitor(NULL)
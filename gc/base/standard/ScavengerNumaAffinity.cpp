@@ -0,0 +1,248 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <new>
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#include "ScavengerNumaAffinity.hpp"
+
+#include "AllocateDescription.hpp"
+#include "Collector.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "HeapVirtualMemory.hpp"
+#include "Math.hpp"
+#include "MemoryManager.hpp"
+#include "MemorySubSpace.hpp"
+#include "ModronAssertions.h"
+#include "NUMAManager.hpp"
+#include "Task.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+bool
+MM_ScavengerNumaAffinity::initialize(MM_EnvironmentBase *env)
+{
+	if (!_extensions->scavengerNumaAffinity || _extensions->isConcurrentScavengerEnabled()) {
+		return true;
+	}
+
+	uintptr_t nodeCount = _extensions->_numaManager.getAffinityLeaderCount();
+	if (nodeCount <= 1) {
+		/* nothing to choose between */
+		return true;
+	}
+
+	MM_Heap *heap = _extensions->heap;
+	uintptr_t stripeSize = OMR_MAX(SCAVENGER_NUMA_STRIPE_SIZE_MINIMUM, heap->getPageSize());
+	_stripeShift = MM_Math::floorLog2(stripeSize);
+	_heapBase = (uintptr_t)heap->getHeapBase();
+
+	uintptr_t listsSize = sizeof(SpareChunkList) * nodeCount * 2;
+	_survivorChunks = (SpareChunkList *)env->getForge()->allocate(listsSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _survivorChunks) {
+		return false;
+	}
+	_tenureChunks = _survivorChunks + nodeCount;
+	/* construct every list before initializing any lock, so that tearDown can always tear down all of them */
+	for (uintptr_t i = 0; i < (nodeCount * 2); i++) {
+		new (&_survivorChunks[i]) SpareChunkList();
+		_survivorChunks[i]._head = NULL;
+	}
+	_nodeCount = nodeCount;
+	for (uintptr_t i = 0; i < (nodeCount * 2); i++) {
+		if (!_survivorChunks[i]._lock.initialize(env, &_extensions->lnrlOptions, "MM_ScavengerNumaAffinity:_spareChunks[]._lock")) {
+			return false;
+		}
+	}
+
+	if (_extensions->_numaManager.isPhysicalNUMASupported()) {
+		bindHeapStripes(env);
+	}
+
+	return true;
+}
+
+void
+MM_ScavengerNumaAffinity::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _survivorChunks) {
+		for (uintptr_t i = 0; i < (_nodeCount * 2); i++) {
+			_survivorChunks[i]._lock.tearDown();
+		}
+		env->getForge()->free(_survivorChunks);
+		_survivorChunks = NULL;
+		_tenureChunks = NULL;
+	}
+	_nodeCount = 0;
+}
+
+/**
+ * Set the preferred node of every stripe of the reserved heap.  The policy is applied when a
+ * page is first touched, so memory which is already resident keeps its current placement.
+ * Failures are ignored: the placement is only a performance hint.
+ */
+void
+MM_ScavengerNumaAffinity::bindHeapStripes(MM_EnvironmentBase *env)
+{
+	uintptr_t leaderCount = 0;
+	J9MemoryNodeDetail const *leaders = _extensions->_numaManager.getAffinityLeaders(&leaderCount);
+	Assert_MM_true(leaderCount == _nodeCount);
+
+	/* the standard configurations always back the heap with a single virtual memory reservation */
+	MM_HeapVirtualMemory *heap = (MM_HeapVirtualMemory *)_extensions->heap;
+	const MM_MemoryHandle *handle = heap->getVmemHandle();
+	uintptr_t stripeSize = (uintptr_t)1 << _stripeShift;
+	uintptr_t heapTop = (uintptr_t)heap->getHeapTop();
+
+	for (uintptr_t stripe = _heapBase; stripe < heapTop; stripe += stripeSize) {
+		uintptr_t size = OMR_MIN(stripeSize, heapTop - stripe);
+		uintptr_t j9NodeNumber = leaders[getNodeForAddress((void *)stripe)].j9NodeNumber;
+		_extensions->memoryManager->setNumaAffinity(handle, j9NodeNumber, (void *)stripe, size);
+	}
+}
+
+void
+MM_ScavengerNumaAffinity::threadSetup(MM_EnvironmentStandard *env)
+{
+	/* every participating thread stores the same value before it copies anything */
+	_activeThreadCount = env->_currentTask->getThreadCount();
+	env->_scavengerNumaNode = env->getWorkerID() % _nodeCount;
+
+	/* the main thread belongs to the application, so only the GC's own threads are bound */
+	if (!env->_scavengerNumaNodeBound && (GC_WORKER_THREAD == env->getThreadType()) && _extensions->_numaManager.isPhysicalNUMASupported()) {
+		uintptr_t leaderCount = 0;
+		J9MemoryNodeDetail const *leaders = _extensions->_numaManager.getAffinityLeaders(&leaderCount);
+		uintptr_t j9NodeNumber = leaders[env->_scavengerNumaNode].j9NodeNumber;
+		env->setNumaAffinity(&j9NodeNumber, 1);
+		env->_scavengerNumaNodeBound = true;
+	}
+}
+
+/**
+ * Park a chunk striped to a node other than the caller's.  The chunk is formatted as a hole
+ * first so that it stays walkable (e.g. for backout) while it is parked.
+ */
+void
+MM_ScavengerNumaAffinity::pushSpareChunk(MM_EnvironmentStandard *env, MM_MemorySubSpace *subSpace, SpareChunkList *list, void *addrBase, void *addrTop)
+{
+	subSpace->abandonHeapChunk(addrBase, addrTop);
+
+	SpareChunk *chunk = (SpareChunk *)((uintptr_t)addrBase + sizeof(MM_HeapLinkedFreeHeader));
+	chunk->_top = addrTop;
+	list->_lock.acquire();
+	chunk->_next = list->_head;
+	list->_head = chunk;
+	list->_lock.release();
+}
+
+bool
+MM_ScavengerNumaAffinity::popSpareChunk(SpareChunkList *list, void *&addrBase, void *&addrTop)
+{
+	SpareChunk *chunk = NULL;
+	if (NULL != list->_head) {
+		list->_lock.acquire();
+		chunk = list->_head;
+		if (NULL != chunk) {
+			list->_head = chunk->_next;
+		}
+		list->_lock.release();
+	}
+
+	if (NULL == chunk) {
+		return false;
+	}
+	addrBase = (void *)((uintptr_t)chunk - sizeof(MM_HeapLinkedFreeHeader));
+	addrTop = chunk->_top;
+	return true;
+}
+
+bool
+MM_ScavengerNumaAffinity::allocateCopyChunk(MM_EnvironmentStandard *env, MM_Collector *requestCollector, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uintptr_t chunkSize, bool tenure, void *&addrBase, void *&addrTop)
+{
+	SpareChunkList *lists = tenure ? _tenureChunks : _survivorChunks;
+	uintptr_t localNode = env->_scavengerNumaNode;
+
+	if (popSpareChunk(&lists[localNode], addrBase, addrTop)) {
+		return true;
+	}
+
+	void *base = NULL;
+	void *top = NULL;
+	for (uintptr_t attempt = 0; attempt < _nodeCount; attempt++) {
+		if (NULL == subSpace->collectorAllocateTLH(env, requestCollector, allocDescription, chunkSize, base, top)) {
+			break;
+		}
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+		if (allocDescription->isLOAAllocation()) {
+			/* the caller tracks the LOA state of the chunk it gets, so never park these */
+			addrBase = base;
+			addrTop = top;
+			return true;
+		}
+#endif /* OMR_GC_LARGE_OBJECT_AREA */
+		uintptr_t node = getNodeForAddress(base);
+		bool const tooSmallToPark = ((uintptr_t)top - (uintptr_t)base) < (sizeof(MM_HeapLinkedFreeHeader) + sizeof(SpareChunk));
+		if ((localNode == node) || !isNodeActive(node) || tooSmallToPark || ((attempt + 1) == _nodeCount)) {
+			addrBase = base;
+			addrTop = top;
+			return true;
+		}
+		pushSpareChunk(env, subSpace, &lists[node], base, top);
+	}
+
+	/* the subspace is exhausted - anything parked for another node is better than failing the copy */
+	for (uintptr_t i = 1; i < _nodeCount; i++) {
+		if (popSpareChunk(&lists[(localNode + i) % _nodeCount], addrBase, addrTop)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+uintptr_t
+MM_ScavengerNumaAffinity::discardSpareChunks(SpareChunkList *lists)
+{
+	uintptr_t discarded = 0;
+	for (uintptr_t node = 0; node < _nodeCount; node++) {
+		SpareChunk *chunk = lists[node]._head;
+		while (NULL != chunk) {
+			discarded += (uintptr_t)chunk->_top - ((uintptr_t)chunk - sizeof(MM_HeapLinkedFreeHeader));
+			chunk = chunk->_next;
+		}
+		lists[node]._head = NULL;
+	}
+	return discarded;
+}
+
+void
+MM_ScavengerNumaAffinity::discardAllSpareChunks(uintptr_t *flipDiscardBytes, uintptr_t *tenureDiscardBytes)
+{
+	*flipDiscardBytes = discardSpareChunks(_survivorChunks);
+	*tenureDiscardBytes = discardSpareChunks(_tenureChunks);
+}
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
@@ -0,0 +1,178 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(SCAVENGERNUMAAFFINITY_HPP_)
+#define SCAVENGERNUMAAFFINITY_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "BaseNonVirtual.hpp"
+#include "EnvironmentStandard.hpp"
+#include "LightweightNonReentrantLock.hpp"
+
+class MM_AllocateDescription;
+class MM_Collector;
+class MM_MemorySubSpace;
+
+/**
+ * Smallest granule of the heap which is given a single home NUMA node (-Xgc:scavengerNumaAffinity)
+ */
+#define SCAVENGER_NUMA_STRIPE_SIZE_MINIMUM (4 * 1024 * 1024)
+
+/**
+ * NUMA placement policy for the scavenger (-Xgc:scavengerNumaAffinity).
+ *
+ * The heap is striped round-robin across the affinity leaders and each scavenger thread is
+ * assigned one node (its worker ID modulo the node count).  When a thread refreshes a copy
+ * cache it keeps asking the subspace for TLH chunks until it gets one striped to its own node;
+ * chunks striped to another node are parked on that node's spare list, where the threads of
+ * that node find them on their next refresh.  Whatever is left on the spare lists when the
+ * scavenge task completes is discarded like any other copy cache remainder: the chunks are
+ * already holes, and they are counted in the flip and tenure discard bytes.  Survivor chunks
+ * are lost to the mutator until the next scavenge evacuates that space, and tenure chunks until
+ * the next global sweep.  They are not recycled into the pools because the split free list and
+ * LOA pools used for tenure cannot take a chunk back.  A refresh parks at most one chunk for
+ * each other node, and only while the subspace still has memory to hand out.
+ *
+ * With physical NUMA the stripes are bound to their nodes (this only affects pages that have
+ * not yet been touched) and the GC worker threads are bound to the node they copy to.  With
+ * simulated NUMA only the logical placement is exercised.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ScavengerNumaAffinity : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	/**
+	 * Link stored inside a parked chunk, immediately after the hole header which keeps the
+	 * chunk walkable while it is parked.
+	 */
+	struct SpareChunk {
+		SpareChunk *_next; /**< Next parked chunk of the same node */
+		void *_top; /**< Top (exclusive) of this chunk */
+	};
+
+	struct SpareChunkList {
+		SpareChunk *_head; /**< Parked chunks, LIFO */
+		MM_LightweightNonReentrantLock _lock; /**< Lock protecting _head */
+	};
+
+	MM_GCExtensionsBase *_extensions;
+	uintptr_t _nodeCount; /**< Number of nodes the heap is striped across, or 0 if the policy is not active */
+	uintptr_t _stripeShift; /**< log2 of the stripe size */
+	uintptr_t _heapBase; /**< Base of the reserved heap, where striping starts */
+	volatile uintptr_t _activeThreadCount; /**< Number of threads participating in the current scavenge */
+	SpareChunkList *_survivorChunks; /**< Parked survivor chunks, one list per node */
+	SpareChunkList *_tenureChunks; /**< Parked tenure chunks, one list per node */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	void pushSpareChunk(MM_EnvironmentStandard *env, MM_MemorySubSpace *subSpace, SpareChunkList *list, void *addrBase, void *addrTop);
+	bool popSpareChunk(SpareChunkList *list, void *&addrBase, void *&addrTop);
+	uintptr_t discardSpareChunks(SpareChunkList *lists);
+	void bindHeapStripes(MM_EnvironmentBase *env);
+
+protected:
+public:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * @return true if copy destinations are chosen by NUMA node
+	 */
+	MMINLINE bool isActive() const { return 0 != _nodeCount; }
+
+	/**
+	 * @return the number of nodes the heap is striped across
+	 */
+	MMINLINE uintptr_t getNodeCount() const { return _nodeCount; }
+
+	/**
+	 * @return the index of the node the stripe containing addr is homed on
+	 */
+	MMINLINE uintptr_t
+	getNodeForAddress(void *addr) const
+	{
+		return (((uintptr_t)addr - _heapBase) >> _stripeShift) % _nodeCount;
+	}
+
+	/**
+	 * @return true if the given node has a scavenger thread in the current cycle
+	 */
+	MMINLINE bool
+	isNodeActive(uintptr_t node) const
+	{
+		return node < _activeThreadCount;
+	}
+
+	/**
+	 * Assign the calling thread its node for this scavenge (and bind it on first use with physical NUMA).
+	 * @param env[in] a scavenger thread about to start the scavenge task
+	 */
+	void threadSetup(MM_EnvironmentStandard *env);
+
+	/**
+	 * Allocate a copy cache chunk striped to the calling thread's node.  Parked chunks of the
+	 * node are used first, then up to one TLH allocation per node is tried.  If no local memory
+	 * can be found, the last chunk allocated is used (or a parked chunk of any node if the
+	 * subspace is exhausted).
+	 * @return true if [addrBase, addrTop) was allocated
+	 */
+	bool allocateCopyChunk(MM_EnvironmentStandard *env, MM_Collector *requestCollector, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uintptr_t chunkSize, bool tenure, void *&addrBase, void *&addrTop);
+
+	/**
+	 * Drop all parked chunks at the end of the scavenge task.  Parked chunks are already
+	 * formatted as holes, so the memory is only accounted for (see the class comment for how
+	 * long it stays unusable).
+	 * @param flipDiscardBytes[out] bytes of survivor space discarded
+	 * @param tenureDiscardBytes[out] bytes of tenure space discarded
+	 */
+	void discardAllSpareChunks(uintptr_t *flipDiscardBytes, uintptr_t *tenureDiscardBytes);
+
+	MM_ScavengerNumaAffinity(MM_EnvironmentBase *env)
+		: MM_BaseNonVirtual()
+		, _extensions(env->getExtensions())
+		, _nodeCount(0)
+		, _stripeShift(0)
+		, _heapBase(0)
+		, _activeThreadCount(0)
+		, _survivorChunks(NULL)
+		, _tenureChunks(NULL)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* SCAVENGERNUMAAFFINITY_HPP_ */
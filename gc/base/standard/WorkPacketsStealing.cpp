@@ -0,0 +1,217 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "omr.h"
+#include "modronopt.h"
+
+#include "WorkPacketsStealing.hpp"
+
+#include "GCExtensionsBase.hpp"
+
+/**
+ * Instantiate a MM_WorkPacketsStealing
+ * @return pointer to the new object
+ */
+MM_WorkPacketsStealing *
+MM_WorkPacketsStealing::newInstance(MM_EnvironmentBase *env)
+{
+	MM_WorkPacketsStealing *workPackets;
+
+	workPackets = (MM_WorkPacketsStealing *)env->getForge()->allocate(sizeof(MM_WorkPacketsStealing), OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+	if (NULL != workPackets) {
+		new(workPackets) MM_WorkPacketsStealing(env);
+		if (!workPackets->initialize(env)) {
+			workPackets->kill(env);
+			workPackets = NULL;
+		}
+	}
+
+	return workPackets;
+}
+
+bool
+MM_WorkPacketsStealing::initialize(MM_EnvironmentBase *env)
+{
+	if (!MM_WorkPacketsStandard::initialize(env)) {
+		return false;
+	}
+
+	_dequeCount = _extensions->gcThreadCount;
+	_deques = (PacketDeque *)env->getForge()->allocate(sizeof(PacketDeque) * _dequeCount, OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+	if (NULL == _deques) {
+		return false;
+	}
+
+	for (uintptr_t i = 0; i < _dequeCount; i++) {
+		_deques[i]._top = 0;
+		_deques[i]._bottom = 0;
+		/* any non-zero seed will do, just make sure each thread probes victims in a different order */
+		_deques[i]._stealSeed = (i + 1) * 0x9E3779B9;
+	}
+
+	return true;
+}
+
+void
+MM_WorkPacketsStealing::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _deques) {
+		env->getForge()->free(_deques);
+		_deques = NULL;
+	}
+
+	MM_WorkPacketsStandard::tearDown(env);
+}
+
+/**
+ * Determine whether an input packet is available, either on the shared lists or
+ * on any thread's deque.
+ * @return true if yes, false if no
+ */
+bool
+MM_WorkPacketsStealing::inputPacketAvailable(MM_EnvironmentBase *env)
+{
+	if (MM_WorkPacketsStandard::inputPacketAvailable(env)) {
+		return true;
+	}
+
+	for (uintptr_t i = 0; i < _dequeCount; i++) {
+		if (!_deques[i].isEmpty()) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * Sweep the other threads' deques once, starting at a random victim, and steal the
+ * first packet found.
+ * @param thiefDeque the deque of the calling thread (skipped as a victim)
+ * @return a stolen packet or NULL
+ */
+MM_Packet *
+MM_WorkPacketsStealing::stealPacket(MM_EnvironmentBase *env, PacketDeque *thiefDeque)
+{
+	MM_Packet *packet = NULL;
+	uintptr_t attempts = 0;
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t startTime = omrtime_hires_clock();
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+	uintptr_t victimIndex = thiefDeque->nextRandom() % _dequeCount;
+	for (uintptr_t i = 0; (NULL == packet) && (i < _dequeCount); i++) {
+		PacketDeque *victim = &_deques[victimIndex];
+		if ((victim != thiefDeque) && !victim->isEmpty()) {
+			attempts += 1;
+			packet = victim->steal();
+		}
+		victimIndex += 1;
+		if (victimIndex == _dequeCount) {
+			victimIndex = 0;
+		}
+	}
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	env->_workPacketStats.addToStealTime(attempts, startTime, omrtime_hires_clock());
+	if (NULL != packet) {
+		env->_workPacketStats.workPacketsStolen += 1;
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+	return packet;
+}
+
+/**
+ * Take ownership of a packet removed from a deque.
+ */
+void
+MM_WorkPacketsStealing::acquiredPacket(MM_EnvironmentBase *env, MM_Packet *packet)
+{
+	packet->setOwner(env);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	env->_workPacketStats.workPacketsAcquired += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	if ((_inputListWaitCount > 0) && inputPacketAvailable(env)) {
+		notifyWaitingThreads(env);
+	}
+}
+
+/**
+ * Get an input packet if one is available.  The calling thread's own deque is
+ * tried first, then the shared lists, then the other threads' deques.
+ *
+ * @return pointer to a packet, or NULL if none available
+ */
+MM_Packet *
+MM_WorkPacketsStealing::getInputPacketNoWait(MM_EnvironmentBase *env)
+{
+	PacketDeque *deque = getDeque(env);
+	if (NULL == deque) {
+		return MM_WorkPacketsStandard::getInputPacketNoWait(env);
+	}
+
+	MM_Packet *packet = deque->pop();
+	if (NULL == packet) {
+		packet = MM_WorkPacketsStandard::getInputPacketNoWait(env);
+		if (NULL == packet) {
+			packet = stealPacket(env, deque);
+			if (NULL != packet) {
+				acquiredPacket(env, packet);
+			}
+		}
+	} else {
+		acquiredPacket(env, packet);
+	}
+
+	return packet;
+}
+
+/**
+ * Put a full output packet on the calling thread's deque. Partially filled packets, and
+ * full ones when the thread has no deque or its deque is full, go to the shared lists.
+ * A packet is full once it cannot take another pair of elements (see MM_WorkStack::pushFailed).
+ *
+ * @param packet The packet to put
+ */
+void
+MM_WorkPacketsStealing::putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet)
+{
+	PacketDeque *deque = getDeque(env);
+	if ((NULL == deque) || (packet->freeSlots() >= 2)) {
+		MM_WorkPacketsStandard::putOutputPacket(env, packet);
+	} else {
+		packet->resetOwner();
+		if (deque->push(packet)) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_workPacketStats.workPacketsReleased += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+			if (_inputListWaitCount > 0) {
+				notifyWaitingThreads(env);
+			}
+		} else {
+			MM_WorkPacketsStandard::putOutputPacket(env, packet);
+		}
+	}
+}
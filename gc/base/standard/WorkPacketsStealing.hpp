@@ -0,0 +1,191 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(WORKPACKETSSTEALING_HPP_)
+#define WORKPACKETSSTEALING_HPP_
+
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentStandard.hpp"
+#include "Packet.hpp"
+#include "WorkPacketsStandard.hpp"
+
+#define WORK_STEALING_DEQUE_CAPACITY 256
+
+/**
+ * Work packets for stop-the-world parallel marking which hand full output packets to a
+ * per-thread Chase-Lev deque instead of the shared (locked) packet lists.  The owning thread
+ * pops its own packets back in LIFO order; a thread which runs out of work steals the oldest
+ * packet from a randomly chosen victim.  The shared lists and the overflow handler are still
+ * used when a deque fills up and for partially filled packets, and the termination protocol
+ * of MM_WorkPackets::getInputPacket() is unchanged.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_WorkPacketsStealing : public MM_WorkPacketsStandard
+{
+/*
+ * Data members
+ */
+public:
+	/**
+	 * Fixed capacity Chase-Lev deque of packets owned by a single GC thread.
+	 * Only the owner calls push() and pop(); any thread may call steal().
+	 */
+	struct PacketDeque {
+		volatile uintptr_t _top; /**< Index of the oldest packet, advanced by thieves (and the owner on the last packet) with a compare and swap */
+		volatile uintptr_t _bottom; /**< Index one past the newest packet, only written by the owner */
+		uintptr_t _stealSeed; /**< State of the owner's victim selection random number generator */
+		MM_Packet * volatile _packets[WORK_STEALING_DEQUE_CAPACITY]; /**< Circular buffer of packets */
+
+		MMINLINE bool
+		isEmpty()
+		{
+			return 0 >= (intptr_t)(_bottom - _top);
+		}
+
+		/**
+		 * Push a packet on the bottom of the deque.  Owner only.
+		 * @return true if the packet was pushed, false if the deque is full
+		 */
+		MMINLINE bool
+		push(MM_Packet *packet)
+		{
+			uintptr_t bottom = _bottom;
+			uintptr_t top = _top;
+			if ((bottom - top) >= WORK_STEALING_DEQUE_CAPACITY) {
+				return false;
+			}
+			_packets[bottom % WORK_STEALING_DEQUE_CAPACITY] = packet;
+			/* the packet must be visible before the thieves can see the new bottom */
+			MM_AtomicOperations::writeBarrier();
+			_bottom = bottom + 1;
+			return true;
+		}
+
+		/**
+		 * Pop the newest packet from the bottom of the deque.  Owner only.
+		 * @return the packet or NULL if the deque is empty (or the last packet was stolen)
+		 */
+		MMINLINE MM_Packet *
+		pop()
+		{
+			uintptr_t bottom = _bottom - 1;
+			_bottom = bottom;
+			/* the new bottom must be published before top is read (store-load ordering) */
+			MM_AtomicOperations::readWriteBarrier();
+			uintptr_t top = _top;
+			if (0 > (intptr_t)(bottom - top)) {
+				_bottom = top;
+				return NULL;
+			}
+			MM_Packet *packet = _packets[bottom % WORK_STEALING_DEQUE_CAPACITY];
+			if (bottom == top) {
+				/* last packet - race any thieves for it */
+				if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+					packet = NULL;
+				}
+				_bottom = top + 1;
+			}
+			return packet;
+		}
+
+		/**
+		 * Steal the oldest packet from the top of the deque.
+		 * @return the packet or NULL if the deque was empty or another thread won the race
+		 */
+		MMINLINE MM_Packet *
+		steal()
+		{
+			uintptr_t top = _top;
+			MM_AtomicOperations::readWriteBarrier();
+			uintptr_t bottom = _bottom;
+			if (0 >= (intptr_t)(bottom - top)) {
+				return NULL;
+			}
+			MM_Packet *packet = _packets[top % WORK_STEALING_DEQUE_CAPACITY];
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				return NULL;
+			}
+			return packet;
+		}
+
+		/**
+		 * Return the next pseudo-random value of the owner's victim selection sequence (xorshift).
+		 */
+		MMINLINE uintptr_t
+		nextRandom()
+		{
+			uintptr_t x = _stealSeed;
+			x ^= x << 13;
+			x ^= x >> 7;
+			x ^= x << 17;
+			_stealSeed = x;
+			return x;
+		}
+	};
+
+protected:
+private:
+	PacketDeque *_deques; /**< One deque per GC thread, indexed by worker ID */
+	uintptr_t _dequeCount; /**< Number of entries in _deques */
+
+/*
+ * Function members
+ */
+private:
+	/**
+	 * Return the deque owned by the calling thread, or NULL if the thread has no deque.
+	 */
+	MMINLINE PacketDeque *
+	getDeque(MM_EnvironmentBase *env)
+	{
+		uintptr_t workerID = env->getWorkerID();
+		return (workerID < _dequeCount) ? &_deques[workerID] : NULL;
+	}
+
+	MM_Packet *stealPacket(MM_EnvironmentBase *env, PacketDeque *thiefDeque);
+	void acquiredPacket(MM_EnvironmentBase *env, MM_Packet *packet);
+
+protected:
+	virtual bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_WorkPacketsStealing *newInstance(MM_EnvironmentBase *env);
+
+	virtual MM_Packet *getInputPacketNoWait(MM_EnvironmentBase *env);
+	virtual void putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet);
+	virtual bool inputPacketAvailable(MM_EnvironmentBase *env);
+
+	/**
+	 * Create a WorkPackets object.
+	 */
+	MM_WorkPacketsStealing(MM_EnvironmentBase *env) :
+		MM_WorkPacketsStandard(env)
+		,_deques(NULL)
+		,_dequeCount(0)
+	{
+		_typeId = __FUNCTION__;
+	};
+};
+
+#endif /* WORKPACKETSSTEALING_HPP_ */
@@ -42,6 +42,39 @@ omrobjectptr_t OMR_GC_AllocateObject(OMR_VMThread * omrVMThread, uintptr_t alloc
 
 omr_error_t OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode);
 
+/**
+ * Write the allocation samples taken so far (-Xgc:allocationSampling), heaviest native stack first.
+ *
+ * @param fileName file to write, or NULL to write to the terminal
+ * @return OMR_ERROR_NOT_AVAILABLE if allocation sampling is not enabled, OMR_ERROR_INTERNAL if the report could not be written
+ */
+omr_error_t OMR_GC_DumpAllocationSamples(OMR_VMThread *omrVMThread, const char *fileName);
+
+/**
+ * Callbacks for OMR_GC_ParallelHeapWalk. All of them are optional except one of objectDo and objectsDo.
+ */
+typedef struct OMR_GC_ParallelHeapWalkCallbacks {
+	/* Called once on each walking thread before it walks any object. Returns the context passed to objectDo on that thread (userData when startThread is NULL). */
+	void *(*startThread)(OMR_VMThread *omrVMThread, void *userData);
+	/* Called for every object in the heap, on the thread that owns the partition containing it */
+	void (*objectDo)(OMR_VMThread *omrVMThread, omrobjectptr_t object, void *threadContext);
+	/* Called instead of objectDo, if set, with spans of up to a few hundred consecutive objects in address order. The span is only valid for the duration of the call */
+	void (*objectsDo)(OMR_VMThread *omrVMThread, omrobjectptr_t *objects, uintptr_t count, void *threadContext);
+	/* Called on the calling thread once the walk is complete, for each context returned by startThread, in worker order */
+	void (*mergeThread)(OMR_VMThread *omrVMThread, void *threadContext, void *userData);
+} OMR_GC_ParallelHeapWalkCallbacks;
+
+/**
+ * Walk every live object of the heap on the GC threads. The heap is first marked to make it walkable, then split
+ * into partitions of partitionSize bytes (0 lets the GC choose) which are handed out to up to threadCount
+ * threads (0 for all GC threads). The objects are found from the mark, without reading the heap, and handed to
+ * the callbacks in spans. Acquires exclusive VM access for the duration of the walk.
+ *
+ * @return OMR_ERROR_NOT_AVAILABLE if the collector does not support parallel walks, OMR_ERROR_OUT_OF_NATIVE_MEMORY
+ * if the per-thread contexts could not be allocated, OMR_ERROR_ILLEGAL_ARGUMENT if both objectDo and objectsDo are NULL
+ */
+omr_error_t OMR_GC_ParallelHeapWalk(OMR_VMThread *omrVMThread, const OMR_GC_ParallelHeapWalkCallbacks *callbacks, void *userData, uintptr_t partitionSize, uintptr_t threadCount);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
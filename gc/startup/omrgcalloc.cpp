@@ -25,11 +25,17 @@
 #include "objectdescription.h"
 
 #include "AllocateInitialization.hpp"
+#include "AllocationSampler.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
 #include "omrgcstartup.hpp"
 #include "ModronAssertions.h"
+#if defined(OMR_GC_MODRON_STANDARD)
+#include "ParallelDispatcher.hpp"
+#include "ParallelGlobalGC.hpp"
+#include "ParallelHeapWalker.hpp"
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
 
 omrobjectptr_t
 OMR_GC_AllocateObject(OMR_VMThread * omrVMThread, MM_AllocateInitialization *allocator)
@@ -60,3 +66,107 @@ OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode)
 	}
 	return result;
 }
+
+omr_error_t
+OMR_GC_DumpAllocationSamples(OMR_VMThread *omrVMThread, const char *fileName)
+{
+	omr_error_t result = OMR_ERROR_NOT_AVAILABLE;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	MM_AllocationSampler *allocationSampler = env->getExtensions()->allocationSampler;
+	if (NULL != allocationSampler) {
+		result = allocationSampler->report(env, fileName) ? OMR_ERROR_NONE : OMR_ERROR_INTERNAL;
+	}
+	return result;
+}
+
+#if defined(OMR_GC_MODRON_STANDARD)
+/* How many objects ahead of the one passed to objectDo the walk prefetches, as objectDo almost always reads the object */
+#define PARALLEL_HEAP_WALK_PREFETCH_DISTANCE 8
+
+/**
+ * State shared by the threads of an OMR_GC_ParallelHeapWalk.
+ */
+typedef struct ParallelHeapWalkState {
+	const OMR_GC_ParallelHeapWalkCallbacks *callbacks;
+	void *userData;
+	void **threadContexts; /**< Context of each worker, indexed by worker ID */
+	bool *threadStarted; /**< Whether the worker with the same index took part in the walk */
+} ParallelHeapWalkState;
+
+static void
+parallelHeapWalkThreadStart(OMR_VMThread *omrVMThread, void *userData)
+{
+	ParallelHeapWalkState *state = (ParallelHeapWalkState *)userData;
+	uintptr_t workerID = MM_EnvironmentBase::getEnvironment(omrVMThread)->getWorkerID();
+	if (NULL != state->callbacks->startThread) {
+		state->threadContexts[workerID] = state->callbacks->startThread(omrVMThread, state->userData);
+	} else {
+		state->threadContexts[workerID] = state->userData;
+	}
+	state->threadStarted[workerID] = true;
+}
+
+static void
+parallelHeapWalkObjectsDo(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t *objects, uintptr_t count, void *userData)
+{
+	ParallelHeapWalkState *state = (ParallelHeapWalkState *)userData;
+	uintptr_t workerID = MM_EnvironmentBase::getEnvironment(omrVMThread)->getWorkerID();
+	void *threadContext = state->threadContexts[workerID];
+	if (NULL != state->callbacks->objectsDo) {
+		state->callbacks->objectsDo(omrVMThread, objects, count, threadContext);
+	} else {
+		for (uintptr_t i = 0; i < count; i++) {
+			if ((i + PARALLEL_HEAP_WALK_PREFETCH_DISTANCE) < count) {
+				MM_PREFETCH_FOR_READ(objects[i + PARALLEL_HEAP_WALK_PREFETCH_DISTANCE]);
+			}
+			state->callbacks->objectDo(omrVMThread, objects[i], threadContext);
+		}
+	}
+}
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
+
+omr_error_t
+OMR_GC_ParallelHeapWalk(OMR_VMThread *omrVMThread, const OMR_GC_ParallelHeapWalkCallbacks *callbacks, void *userData, uintptr_t partitionSize, uintptr_t threadCount)
+{
+	if ((NULL == callbacks) || ((NULL == callbacks->objectDo) && (NULL == callbacks->objectsDo))) {
+		return OMR_ERROR_ILLEGAL_ARGUMENT;
+	}
+
+	omr_error_t result = OMR_ERROR_NOT_AVAILABLE;
+#if defined(OMR_GC_MODRON_STANDARD)
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->isStandardGC() && ((NULL != extensions->getGlobalCollector()) || (OMR_ERROR_NONE == OMR_GC_InitializeCollector(omrVMThread)))) {
+		MM_ParallelHeapWalker *heapWalker = (MM_ParallelHeapWalker *)((MM_ParallelGlobalGC *)extensions->getGlobalCollector())->getHeapWalker();
+		uintptr_t threadCountMaximum = extensions->dispatcher->threadCountMaximum();
+		ParallelHeapWalkState state;
+		state.callbacks = callbacks;
+		state.userData = userData;
+		state.threadContexts = (void **)env->getForge()->allocate((sizeof(void *) + sizeof(bool)) * threadCountMaximum, OMR::GC::AllocationCategory::OTHER, OMR_GET_CALLSITE());
+		if (NULL == state.threadContexts) {
+			result = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		} else {
+			state.threadStarted = (bool *)(state.threadContexts + threadCountMaximum);
+			for (uintptr_t i = 0; i < threadCountMaximum; i++) {
+				state.threadContexts[i] = NULL;
+				state.threadStarted[i] = false;
+			}
+
+			env->acquireExclusiveVMAccess();
+			heapWalker->allObjectsDoPartitioned(env, parallelHeapWalkObjectsDo, parallelHeapWalkThreadStart, &state, 0, partitionSize, (0 == threadCount) ? UDATA_MAX : threadCount, true);
+			env->releaseExclusiveVMAccess();
+
+			if (NULL != callbacks->mergeThread) {
+				for (uintptr_t i = 0; i < threadCountMaximum; i++) {
+					if (state.threadStarted[i]) {
+						callbacks->mergeThread(omrVMThread, state.threadContexts[i], userData);
+					}
+				}
+			}
+			env->getForge()->free(state.threadContexts);
+			result = OMR_ERROR_NONE;
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
+	return result;
+}
@@ -26,6 +26,7 @@
 #include "objectdescription.h"
 
 #include "AllocateDescription.hpp"
+#include "AllocationSampler.hpp"
 #include "AtomicOperations.hpp"
 #include "Collector.hpp"
 #include "CollectorLanguageInterface.hpp"
@@ -37,6 +38,7 @@
 #include "HeapMemorySubSpaceIterator.hpp"
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionDescriptor.hpp"
+#include "MemoryMaintenanceThread.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "ModronAssertions.h"
@@ -67,6 +69,16 @@ collectorCreationHelper(OMR_VM *omrVM, MM_EnvironmentBase *env)
 		if (!extensions->getGlobalCollector()->collectorStartup(extensions)) {
 			omrtty_printf("Failed to start global collector.\n");
 			rc = OMR_ERROR_INTERNAL;
+		} else if (extensions->backgroundDecommit && (NULL == extensions->memoryMaintenanceThread)) {
+			/* without the thread, contraction keeps decommitting in the pause */
+			MM_MemoryMaintenanceThread *maintenanceThread = MM_MemoryMaintenanceThread::newInstance(env);
+			if (NULL != maintenanceThread) {
+				if (maintenanceThread->startup(env)) {
+					extensions->memoryMaintenanceThread = maintenanceThread;
+				} else {
+					maintenanceThread->kill(env);
+				}
+			}
 		}
 	}
 
@@ -137,6 +149,15 @@ heapCreationHelper(OMR_VM *omrVM, MM_StartupManager *startupManager, bool create
 		goto done;
 	}
 
+	if (extensions->allocationSampling) {
+		extensions->allocationSampler = MM_AllocationSampler::newInstance(&envBase);
+		if (NULL == extensions->allocationSampler) {
+			omrtty_printf("Failed to create allocation sampler.\n");
+			rc = OMR_ERROR_INTERNAL;
+			goto done;
+		}
+	}
+
 	/* Initialize statistic locks */
 	if (0 != omrthread_monitor_init_with_name(&extensions->gcStatsMutex, 0, "MM_GCExtensions::gcStats")) {
 		omrtty_printf("Failed to create GC statistics mutex.\n");
@@ -297,6 +318,11 @@ OMR_GC_ShutdownCollector(OMR_VM* vm)
 	if (NULL != extensions) {
 		MM_Collector *globalCollector = extensions->getGlobalCollector();
 
+		if (NULL != extensions->memoryMaintenanceThread) {
+			/* stop decommitting before the collector goes away, the object lives on until the heap is shut down */
+			extensions->memoryMaintenanceThread->shutdown();
+		}
+
 		if (NULL != globalCollector) {
 			globalCollector->collectorShutdown(extensions);
 		}
@@ -330,6 +356,16 @@ OMR_GC_ShutdownHeap(OMR_VM *omrVM)
 			extensions->verboseGCManager = NULL;
 		}
 
+		if (NULL != extensions->memoryMaintenanceThread) {
+			extensions->memoryMaintenanceThread->kill(&env);
+			extensions->memoryMaintenanceThread = NULL;
+		}
+
+		if (NULL != extensions->allocationSampler) {
+			extensions->allocationSampler->kill(&env);
+			extensions->allocationSampler = NULL;
+		}
+
 		if (NULL != extensions->configuration) {
 			extensions->configuration->kill(&env);
 		}
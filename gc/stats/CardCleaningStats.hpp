@@ -34,6 +34,7 @@ class MM_CardCleaningStats : public MM_Base
 public:
 	uint64_t _cardCleaningTime; /**< Time spent cleaning cards in hi-res clock resolution. */
 	uintptr_t _cardsCleaned; /**< The number of cards cleaned */
+	uintptr_t _cardsSkipped; /**< The number of clean cards stepped over using the dirty card summary */
 	
 /* Function Members */
 public:
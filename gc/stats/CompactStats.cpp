@@ -48,6 +48,11 @@ MM_CompactStats::clear()
 	_fixupEndTime = 0;
 	_rootFixupStartTime = 0;
 	_rootFixupEndTime = 0;
+
+	_incremental = false;
+	_incrementalRanges = 0;
+	_fragmentedBytes = 0;
+	_remainingFragmentedBytes = 0;
 };
 
 void
@@ -65,6 +70,11 @@ MM_CompactStats::merge(MM_CompactStats *statsToMerge)
 	_fixupEndTime = OMR_MAX(_fixupEndTime, statsToMerge->_fixupEndTime);
 	_rootFixupStartTime = (0 == _rootFixupStartTime) ? statsToMerge->_rootFixupStartTime : OMR_MIN(_rootFixupStartTime, statsToMerge->_rootFixupStartTime);
 	_rootFixupEndTime = OMR_MAX(_rootFixupEndTime, statsToMerge->_rootFixupEndTime);
+	/* the range selection is done by the main thread alone */
+	_incremental = _incremental || statsToMerge->_incremental;
+	_incrementalRanges += statsToMerge->_incrementalRanges;
+	_fragmentedBytes += statsToMerge->_fragmentedBytes;
+	_remainingFragmentedBytes += statsToMerge->_remainingFragmentedBytes;
 };
 
 #endif /* OMR_GC_MODRON_COMPACTION */
@@ -58,6 +58,11 @@ public:
 	uint64_t _fixupEndTime;
 	uint64_t _rootFixupStartTime;
 	uint64_t _rootFixupEndTime;
+
+	bool _incremental; /**< true if only the most fragmented ranges of the heap were compacted */
+	uintptr_t _incrementalRanges; /**< Number of sweep chunks selected by an incremental compaction */
+	uintptr_t _fragmentedBytes; /**< Free bytes outside the largest free entry of each sweep chunk (plus dark matter) when the compaction started */
+	uintptr_t _remainingFragmentedBytes; /**< Part of _fragmentedBytes found in the ranges which were not compacted */
 		
 	/* Remember gc count on last compaction of heap */
 	uintptr_t _lastHeapCompaction;
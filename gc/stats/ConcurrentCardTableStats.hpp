@@ -49,6 +49,8 @@ public:
 	volatile uintptr_t finalCleanedCardsPhase2;
 	
 	volatile uintptr_t concurrentCleanedCardsPhase3;
+
+	volatile uintptr_t finalSkippedCards; /**< Clean cards final card cleaning stepped over using the dirty card summary */
 	
 	MMINLINE void setCount(volatile uintptr_t &counter, uintptr_t count) 
 	{ 
@@ -75,6 +77,7 @@ public:
 		/* Final card cleaning counts */
 		setCount(finalCleanedCardsPhase1, 0);
 		setCount(finalCleanedCardsPhase2, 0);
+		setCount(finalSkippedCards, 0);
 	}
 	
 	MMINLINE void setCardCleaningPhase1Kickoff(uintptr_t kickoff) { _cardCleaningPhase1Kickoff = kickoff; };
@@ -119,6 +122,14 @@ public:
 		incrementCount(finalCleanedCardsPhase2, numCards);	
 	};
 	
+	MMINLINE uintptr_t getFinalSkippedCards() { return finalSkippedCards; };
+	MMINLINE void incFinalSkippedCards(uintptr_t numCards)
+	{
+		if (0 != numCards) {
+			incrementCount(finalSkippedCards, numCards);
+		}
+	};
+	
 	/**
 	 * Create a CardTableStats object.
 	 */   
@@ -129,7 +140,8 @@ public:
 		finalCleanedCardsPhase1(0),
 		concurrentCleanedCardsPhase2(0),
 		finalCleanedCardsPhase2(0),
-		concurrentCleanedCardsPhase3(0)
+		concurrentCleanedCardsPhase3(0),
+		finalSkippedCards(0)
 	{};
 };
 
@@ -23,11 +23,14 @@
 #if !defined(HEAPRESIZESTATS_HPP_)
 #define HEAPRESIZESTATS_HPP_
 
+#include <string.h>
+
 #include "omrcomp.h"
 #include "modronbase.h"
 
 #include "Base.hpp"
 #include "Debug.hpp"
+#include "HeapSizingStats.hpp"
 
 #define RATIO_RESIZE_HISTORIES				3
 
@@ -71,6 +74,13 @@ private:
 	uint64_t 				_ticksOutsideGC[RATIO_RESIZE_HISTORIES];
 	bool					_excludeCurrentGCTimeFromStats;
 
+	/* Inputs and last decision of the heap sizing cost model (-Xgc:heapSizingCostModel) */
+	uint64_t				_globalGCStartTime; /**< time in hi-res ticks the current global GC started */
+	uint64_t				_lastGlobalGCEndTime; /**< time in hi-res ticks the last global GC ended, 0 before the first one */
+	uintptr_t				_usedBytesAtGlobalGCStart; /**< bytes used in the tenure space when the current global GC started */
+	uintptr_t				_usedBytesAfterGlobalGC; /**< bytes used in the tenure space when the last global GC ended */
+	MM_HeapSizingStats		_heapSizingStats;
+
 protected:
 public:
 
@@ -179,6 +189,24 @@ public:
 	MMINLINE void setExcludeCurrentGCTimeFromStats() { _excludeCurrentGCTimeFromStats = TRUE; }
 	MMINLINE bool getExcludeCurrentGCTimeFromStats() { return _excludeCurrentGCTimeFromStats; }
 
+	MMINLINE void setGlobalGCStart(uint64_t ticks, uintptr_t usedBytes)
+	{
+		_globalGCStartTime = ticks;
+		_usedBytesAtGlobalGCStart = usedBytes;
+	}
+	MMINLINE uint64_t getGlobalGCStartTime() { return _globalGCStartTime; }
+	MMINLINE uintptr_t getUsedBytesAtGlobalGCStart() { return _usedBytesAtGlobalGCStart; }
+
+	MMINLINE void setGlobalGCEnd(uint64_t ticks, uintptr_t usedBytes)
+	{
+		_lastGlobalGCEndTime = ticks;
+		_usedBytesAfterGlobalGC = usedBytes;
+	}
+	MMINLINE uint64_t getLastGlobalGCEndTime() { return _lastGlobalGCEndTime; }
+	MMINLINE uintptr_t getUsedBytesAfterGlobalGC() { return _usedBytesAfterGlobalGC; }
+
+	MMINLINE MM_HeapSizingStats *getHeapSizingStats() { return &_heapSizingStats; }
+
 	MM_HeapResizeStats() :
 		MM_Base(),
 		_lastAFEndTime(0),
@@ -196,9 +224,14 @@ public:
 		_lastGCPercentage(0),
 		_lastTimeOutsideGC(0),
 		_globalGCCountAtAF(0),
-		_excludeCurrentGCTimeFromStats(true)
+		_excludeCurrentGCTimeFromStats(true),
+		_globalGCStartTime(0),
+		_lastGlobalGCEndTime(0),
+		_usedBytesAtGlobalGCStart(0),
+		_usedBytesAfterGlobalGC(0)
 	{
 		resetRatioTicks();
+		memset(&_heapSizingStats, 0, sizeof(_heapSizingStats));
 	}
 	
 }; 
@@ -0,0 +1,72 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(HEAPSIZINGSTATS_HPP_)
+#define HEAPSIZINGSTATS_HPP_
+
+#include "omrcomp.h"
+
+/**
+ * What bounded the target chosen by the heap sizing cost model (-Xgc:heapSizingCostModel).
+ */
+typedef enum {
+	HEAP_SIZING_LIMIT_NONE = 0, /**< no decision was made */
+	HEAP_SIZING_LIMIT_COST, /**< the size that keeps GC time at the target */
+	HEAP_SIZING_LIMIT_PAUSE, /**< the largest size whose predicted pause meets -Xgc:heapSizingPauseTarget */
+	HEAP_SIZING_LIMIT_MINIMUM, /**< the minimum space size, or the live data plus minimum headroom */
+	HEAP_SIZING_LIMIT_MAXIMUM, /**< the maximum space size or -Xsoftmx */
+	HEAP_SIZING_LIMIT_CONTAINER /**< the share of the cgroup memory limit given to the space */
+} HeapSizingLimit;
+
+/**
+ * Inputs of one heap sizing decision, taken at a global collection. This is everything the cost
+ * model is given, so a sequence of samples read back from verbose GC replays the same decisions.
+ */
+struct MM_HeapSizingSample {
+	uint64_t intervalMicros; /**< time from the end of the previous global collection to the start of this one */
+	uint64_t pauseMicros; /**< time this global collection took up to the decision */
+	uintptr_t allocatedBytes; /**< growth of the used bytes of the space over the interval */
+	uintptr_t liveBytes; /**< bytes used in the space after this collection */
+	uintptr_t currentSize; /**< size of the space */
+	uintptr_t minimumSize; /**< smallest size the space may contract to */
+	uintptr_t maximumSize; /**< largest size the space may expand to, -Xsoftmx included */
+	uintptr_t containerBudget; /**< share of the cgroup memory limit available to the space, 0 if there is no limit */
+	uintptr_t bytesRequired; /**< allocation the collection has to satisfy */
+};
+
+/**
+ * The last decision of the heap sizing cost model, reported in the verbose GC sweep stanza.
+ * @ingroup GC_Stats
+ */
+struct MM_HeapSizingStats {
+	uintptr_t _gcCount; /**< global collection the decision was made in, 0 if none was made yet */
+	MM_HeapSizingSample _sample; /**< inputs of the decision */
+	uint64_t _containerLimit; /**< cgroup memory limit, 0 if there is none */
+	uint64_t _allocationRate; /**< smoothed allocation rate, in bytes per second */
+	uint64_t _markMicrosPerMB; /**< modelled pause per MB of live data */
+	uint64_t _sweepMicrosPerMB; /**< modelled pause per MB of space */
+	uint64_t _predictedPauseMicros; /**< modelled pause at the target size */
+	uintptr_t _targetSize; /**< size the space is resized towards */
+	HeapSizingLimit _limit; /**< what bounded the target */
+};
+
+#endif /* HEAPSIZINGSTATS_HPP_ */
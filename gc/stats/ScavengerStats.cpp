@@ -91,6 +91,8 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_tenureExpandedBytes(0)
 	,_tenureExpandedCount(0)
 	,_tenureExpandedTime(0)
+	,_numaLocalCopyBytes(0)
+	,_numaRemoteCopyBytes(0)
 	,_leafObjectCount(0)
 	,_copy_cachesize_sum(0)
 	,_slotsCopied(0)
@@ -104,6 +106,7 @@ MM_ScavengerStats::MM_ScavengerStats()
 	memset(_flipHistory, 0, sizeof(_flipHistory));
 	memset(_copy_distance_counts, 0, sizeof(_copy_distance_counts));
 	memset(_copy_cachesize_counts, 0, sizeof(_copy_cachesize_counts));
+	memset(_predictedLiveBytes, 0, sizeof(_predictedLiveBytes));
 }
 
 struct MM_ScavengerStats::FlipHistory*
@@ -195,6 +198,10 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_tenureExpandedBytes = 0;
 	_tenureExpandedCount = 0;
 	_tenureExpandedTime = 0;
+	memset(_predictedLiveBytes, 0, sizeof(_predictedLiveBytes));
+
+	_numaLocalCopyBytes = 0;
+	_numaRemoteCopyBytes = 0;
 
 	_slotsCopied = 0;
 	_slotsScanned = 0;
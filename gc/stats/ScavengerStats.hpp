@@ -143,6 +143,9 @@ public:
 	uintptr_t _tenureExpandedBytes; /**< Bytes by which the heap expanded in order to complete the collection */
 	uintptr_t _tenureExpandedCount; /**< The number of times the heap was expanded in order to complete the collection */
 	uint64_t _tenureExpandedTime; /**< Time taken expanding the heap in order to complete the collection, in hi-res ticks */
+	uintptr_t _numaLocalCopyBytes; /**< Bytes copied to memory on the copying thread's own NUMA node (-Xgc:scavengerNumaAffinity) */
+	uintptr_t _numaRemoteCopyBytes; /**< Bytes copied to memory on another NUMA node (-Xgc:scavengerNumaAffinity) */
+	uintptr_t _predictedLiveBytes[OBJECT_HEADER_AGE_MAX+1]; /**< Bytes of each age the tenure predictor expected this scavenge to find live (-Xgc:scvTenureStrategyPredictive) */
 
 	uint64_t _leafObjectCount;
 	uint64_t _copy_distance_counts[OMR_SCAVENGER_DISTANCE_BINS];
@@ -44,6 +44,14 @@ MM_SweepStats::clear()
 	mergeTime = 0;
 	sweepChunksProcessed = 0;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */			
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	for (uintptr_t sizeClass = 0; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		_sizeClassSweepTime[sizeClass] = 0;
+		_sizeClassRegionsSwept[sizeClass] = 0;
+		_sizeClassRegionsDeferred[sizeClass] = 0;
+	}
+#endif /* OMR_GC_SEGREGATED_HEAP */
 }
 	
 void
@@ -59,6 +67,14 @@ MM_SweepStats::merge(MM_SweepStats *statsToMerge)
 	mergeTime += statsToMerge->mergeTime;
 	sweepChunksProcessed += statsToMerge->sweepChunksProcessed;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	for (uintptr_t sizeClass = 0; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		_sizeClassSweepTime[sizeClass] += statsToMerge->_sizeClassSweepTime[sizeClass];
+		_sizeClassRegionsSwept[sizeClass] += statsToMerge->_sizeClassRegionsSwept[sizeClass];
+		_sizeClassRegionsDeferred[sizeClass] += statsToMerge->_sizeClassRegionsDeferred[sizeClass];
+	}
+#endif /* OMR_GC_SEGREGATED_HEAP */
 }
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
@@ -82,5 +98,15 @@ MM_SweepStats::addToMergeTime(uint64_t startTime, uint64_t endTime)
 	mergeTime += (endTime - startTime);
 }
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+/* Time is stored in raw format, converted to resolution at time of output */
+void
+MM_SweepStats::addToSizeClassSweepTime(uintptr_t sizeClass, uintptr_t regionCount, uint64_t startTime, uint64_t endTime)
+{
+	_sizeClassSweepTime[sizeClass] += (endTime - startTime);
+	_sizeClassRegionsSwept[sizeClass] += regionCount;
+}
+#endif /* OMR_GC_SEGREGATED_HEAP */
  
 #endif /* OMR_GC_MODRON_STANDARD || OMR_GC_REALTIME */
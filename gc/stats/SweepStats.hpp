@@ -31,6 +31,10 @@
 
 #include "Base.hpp"
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#include "sizeclasses.h"
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 /**
  * Storage for statistics relevant to the sweep phase of global collection
  * @ingroup GC_Stats
@@ -52,6 +56,12 @@ public:
 	uintptr_t sweepChunksProcessed;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	uint64_t _sizeClassSweepTime[OMR_SIZECLASSES_MAX_SMALL + 1]; /**< Time spent sweeping small regions of each size class */
+	uintptr_t _sizeClassRegionsSwept[OMR_SIZECLASSES_MAX_SMALL + 1]; /**< Number of small regions of each size class swept by the collector */
+	uintptr_t _sizeClassRegionsDeferred[OMR_SIZECLASSES_MAX_SMALL + 1]; /**< Number of small regions of each size class left for allocating threads to sweep (-Xgc:lazySweepSegregated) */
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 	uint64_t _startTime;	/**< Sweep start time */
 	uint64_t _endTime;		/**< Sweep end time */
 
@@ -63,6 +73,10 @@ public:
 	void addToMergeTime(uint64_t startTime, uint64_t endTime);
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	void addToSizeClassSweepTime(uintptr_t sizeClass, uintptr_t regionCount, uint64_t startTime, uint64_t endTime);
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 	MM_SweepStats() :
 		MM_Base()
 		,_gcCount(UDATA_MAX)
@@ -0,0 +1,101 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(TLHSIZINGSTATS_HPP_)
+#define TLHSIZINGSTATS_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+#include "Base.hpp"
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+
+/**
+ * Per-thread TLH usage between two GCs, as seen by adaptive TLH sizing (-Xgc:adaptiveTLHSizing).
+ */
+class MM_TLHSizingStats : public MM_Base {
+public:
+	uintptr_t _allocatedBytes; /**< TLH bytes the thread filled with objects */
+	uintptr_t _refreshDiscardedBytes; /**< TLH remainders too small to cache, dropped when the thread refreshed */
+	uintptr_t _flushDiscardedBytes; /**< Current TLH remainder and cached TLHs dropped when caches were flushed for GC */
+	uintptr_t _refreshCount; /**< Number of TLH refreshes */
+	uint64_t _intervalMicros; /**< Length of the interval the counts cover */
+	uintptr_t _refreshSizeLimit; /**< Largest refresh size the thread may grow to until the next GC */
+
+	MMINLINE uintptr_t getDiscardedBytes() { return _refreshDiscardedBytes + _flushDiscardedBytes; }
+
+	/**
+	 * @return the wasted share of the TLH memory the thread consumed, in hundredths of a percent
+	 */
+	MMINLINE uintptr_t
+	getWasteHundredthsPercent()
+	{
+		uintptr_t discarded = getDiscardedBytes();
+		uintptr_t consumed = _allocatedBytes + discarded;
+		return (0 == consumed) ? 0 : (uintptr_t)(((uint64_t)discarded * 10000) / consumed);
+	}
+
+	/**
+	 * @return the TLH allocation rate over the interval, in bytes per millisecond
+	 */
+	MMINLINE uintptr_t
+	getAllocationRate()
+	{
+		return (0 == _intervalMicros) ? 0 : (uintptr_t)(((uint64_t)_allocatedBytes * 1000) / _intervalMicros);
+	}
+
+	void
+	clear()
+	{
+		_allocatedBytes = 0;
+		_refreshDiscardedBytes = 0;
+		_flushDiscardedBytes = 0;
+		_refreshCount = 0;
+		_intervalMicros = 0;
+		_refreshSizeLimit = 0;
+	}
+
+	void
+	merge(MM_TLHSizingStats *stats)
+	{
+		_allocatedBytes += stats->_allocatedBytes;
+		_refreshDiscardedBytes += stats->_refreshDiscardedBytes;
+		_flushDiscardedBytes += stats->_flushDiscardedBytes;
+		_refreshCount += stats->_refreshCount;
+		_intervalMicros = OMR_MAX(_intervalMicros, stats->_intervalMicros);
+		_refreshSizeLimit = OMR_MAX(_refreshSizeLimit, stats->_refreshSizeLimit);
+	}
+
+	MM_TLHSizingStats()
+		: MM_Base()
+		, _allocatedBytes(0)
+		, _refreshDiscardedBytes(0)
+		, _flushDiscardedBytes(0)
+		, _refreshCount(0)
+		, _intervalMicros(0)
+		, _refreshSizeLimit(0)
+	{}
+};
+
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+#endif /* TLHSIZINGSTATS_HPP_ */
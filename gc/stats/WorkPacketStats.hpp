@@ -51,6 +51,9 @@ public:
 	uintptr_t _completeStallCount; /**< The number of times the thread stalled, and waited for all other threads to complete working */
 	uint64_t _workStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting to receive more work */
 	uint64_t _completeStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting for all other threads to complete working */
+	uintptr_t workPacketsStolen; /**< The number of input packets taken from another thread's work stealing deque */
+	uintptr_t _stealAttemptCount; /**< The number of victim deques probed while looking for a packet to steal */
+	uint64_t _stealTime; /**< The time, in hi-res ticks, the thread spent searching other threads' deques for work */
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 protected:
@@ -73,6 +76,9 @@ public:
 		workPacketsAcquired = 0;
 		workPacketsReleased = 0;
 		workPacketsExchanged = 0;
+		workPacketsStolen = 0;
+		_stealAttemptCount = 0;
+		_stealTime = 0;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -91,6 +97,9 @@ public:
 		workPacketsAcquired += statsToMerge->workPacketsAcquired;
 		workPacketsReleased += statsToMerge->workPacketsReleased;
 		workPacketsExchanged += statsToMerge->workPacketsExchanged;
+		workPacketsStolen += statsToMerge->workPacketsStolen;
+		_stealAttemptCount += statsToMerge->_stealAttemptCount;
+		_stealTime += statsToMerge->_stealTime;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -121,6 +130,17 @@ public:
 		_completeStallTime += (endTime - startTime);
 	}
 	
+	/**
+	 * Add the result of a sweep over other threads' work stealing deques.
+	 * Time is stored in raw format, converted to resolution at time of output
+	 */
+	MMINLINE void
+	addToStealTime(uintptr_t attempts, uint64_t startTime, uint64_t endTime)
+	{
+		_stealAttemptCount += attempts;
+		_stealTime += (endTime - startTime);
+	}
+
 	/**
 	 * Get the total stall time
 	 * @return the time in hi-res ticks
@@ -151,6 +171,9 @@ public:
 		,_completeStallCount(0)
 		,_workStallTime(0)
 		,_completeStallTime(0)
+		,workPacketsStolen(0)
+		,_stealAttemptCount(0)
+		,_stealTime(0)
 		,_stwWorkStackOverflowCount(0)
 		,_stwWorkStackOverflowOccured(false)
 		,_stwWorkpacketCountAtOverflow(0)
@@ -68,6 +68,14 @@ public:
 		return _fragment->fragmentSize;
 	}
 
+	/**
+	 * Set the size of the ranges reserved for the fragment from now on
+	 */
+	MMINLINE void setFragmentSize(uintptr_t fragmentSize)
+	{
+		_fragment->fragmentSize = fragmentSize;
+	}
+
 	/**
 	 * Clear the remaining entries in the fragment.
 	 * Disconnects the fragment from the reserved area in the sublist.  New allocates will
@@ -50,6 +50,7 @@ MM_SublistPool::initialize(MM_EnvironmentBase *env, OMR::GC::AllocationCategory:
 {
 	memset(this, 0, sizeof(*this));
 	_allocCategory = category;
+	_puddleBatchCount = 1;
 	return (!omrthread_monitor_init_with_name(&_mutex, 0, "MM_SublistPool"));
 }
 
@@ -118,98 +119,115 @@ MM_SublistPool::createNewPuddle(MM_EnvironmentBase *env)
 	return MM_SublistPuddle::newInstance(env, puddleSize, this, _allocCategory);	
 }
 
+bool
+MM_SublistPool::allocateFromLinkedPuddles(MM_SublistFragment *fragment)
+{
+	MM_SublistPuddle *puddle = _allocPuddle;
+	while (NULL != puddle) {
+		if (puddle->allocate(fragment)) {
+			return true;
+		}
+		/* Any puddles past the alloc puddle are guaranteed to be empty */
+		MM_SublistPuddle *nextPuddle = puddle->getNext();
+		if (NULL == nextPuddle) {
+			break;
+		}
+		/* Losing the race only means another thread has already moved on */
+		MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_allocPuddle, (uintptr_t)puddle, (uintptr_t)nextPuddle);
+		puddle = _allocPuddle;
+	}
+	return false;
+}
+
+void
+MM_SublistPool::growFragment(MM_SublistFragment *fragment)
+{
+	uintptr_t fragmentSize = fragment->getFragmentSize();
+	if (fragmentSize < _maxFragmentSize) {
+		fragment->setFragmentSize(OMR_MIN(fragmentSize * 2, _maxFragmentSize));
+	}
+}
+
 /**
  * Allocate a new fragment from a sublist.
  * Reserve memory from the sublist and update the fragment.  If there is no room available
- * in the current sublist memory, allocate a new sublist puddle (until the maximum sublist size is reached).
+ * in the current sublist memory, allocate a batch of new sublist puddles (until the maximum sublist size is reached).
+ * The lock is only taken to grow the sublist.
  * 
  * @return true if the fragment allocate is successful, false otherwise.
  */
 bool
 MM_SublistPool::allocate(MM_EnvironmentBase *env, MM_SublistFragment *fragment)
 {
-	uintptr_t puddleSize = 0;
-	MM_SublistPuddle *emptyPuddle = NULL;
+	growFragment(fragment);
 
-	/* Attempt to allocate a fragment from the current allocation puddle. If successful, we are done. */
-	if(_allocPuddle && _allocPuddle->allocate(fragment)) {
+	/* Attempt to allocate a fragment from the current allocation puddle, or an empty one after it. If successful, we are done. */
+	if (allocateFromLinkedPuddles(fragment)) {
 		return true;
 	}
 
-	/* No new fragment is available.  Lock the sublist and allocate a new puddle */
+	/* No new fragment is available.  Lock the sublist and allocate new puddles */
 	omrthread_monitor_enter(_mutex);
 
-	/* Another thread may have allocated a puddle while attempting to get the lock
-	 * Check by attempting to allocate the puddle again 
+	/* Another thread may have allocated puddles while attempting to get the lock
+	 * Check by attempting to allocate the fragment again 
 	 */
-	if(_allocPuddle && _allocPuddle->allocate(fragment)) {
+	if (allocateFromLinkedPuddles(fragment)) {
 		omrthread_monitor_exit(_mutex);
 		return true;
 	}
 
-	/* Are there any puddles past the alloc puddle? */
-	if (_allocPuddle && _allocPuddle->getNext()) {
-		/* Yes - it's guaranteed to be empty */
-		emptyPuddle = _allocPuddle->getNext();
-		Assert_MM_true(NULL != emptyPuddle);
-		Assert_MM_true(emptyPuddle->isEmpty());
-	} else {
-		/* No - we need to allocate a new puddle */
-
-		/* If the sublist has a maximum size, be sure we aren't attempting to grow beyond it */
-		if(_maxSize) {
-			puddleSize = _maxSize - _currentSize;
-			if(0 == puddleSize) {
-				omrthread_monitor_exit(_mutex);
-				return false;
-			}
-			/* If the available size to grow is greater than the suggested size, reduce */
-			if(puddleSize > _growSize) {
-				puddleSize = _growSize;
-			}
-		} else {
-			/* No limit on the grow size - use the suggested grow size */
-			puddleSize = _growSize;
-		}
-	
-		/* Check that the determined grow size is valid */
-		if(0 == puddleSize) {
-			omrthread_monitor_exit(_mutex);
-			return false;
-		}
-	
-		/* Get a new puddle to add to the sublist pool */
-		if(NULL == (emptyPuddle = MM_SublistPuddle::newInstance(env, puddleSize, this, _allocCategory))) {
-			omrthread_monitor_exit(_mutex);
-			return false;
+	/* Puddles are only linked under the lock, so the alloc puddle is now full and the tail of the list */
+	MM_SublistPuddle *tailPuddle = _allocPuddle;
+	Assert_MM_true((NULL == tailPuddle) || (NULL == tailPuddle->getNext()));
+
+	/* Create the batch, stopping early if the sublist reaches its maximum size */
+	MM_SublistPuddle *firstPuddle = NULL;
+	MM_SublistPuddle *lastPuddle = NULL;
+	for (uintptr_t i = 0; i < _puddleBatchCount; i++) {
+		MM_SublistPuddle *emptyPuddle = createNewPuddle(env);
+		if (NULL == emptyPuddle) {
+			break;
 		}
 		Assert_MM_true(emptyPuddle->isEmpty());
 		Assert_MM_true(NULL == emptyPuddle->getNext());
-	 	_currentSize += emptyPuddle->totalSize();
+		_currentSize += emptyPuddle->totalSize();
+		if (NULL == firstPuddle) {
+			firstPuddle = emptyPuddle;
+		} else {
+			lastPuddle->setNext(emptyPuddle);
+		}
+		lastPuddle = emptyPuddle;
 	}
- 
- 	/* Allocate the fragment from the puddle. We are guaranteed to succeed because
- 	 * other threads don't have access yet -- either because it's new, or because
- 	 * they can't allocate from anything other than _allocPuddle
+	if (NULL == firstPuddle) {
+		omrthread_monitor_exit(_mutex);
+		return false;
+	}
+
+ 	/* Allocate the fragment from the first puddle. We are guaranteed to succeed because
+ 	 * other threads don't have access to the new puddles yet
  	 */
-	bool mustSucceed = emptyPuddle->allocate(fragment);
+	bool mustSucceed = firstPuddle->allocate(fragment);
  	Assert_MM_true(mustSucceed);
 
- 	/* Now that we have allocated our fragment, it is safe to expose the puddle to the rest of the VM */
+	/* The links within the batch must be visible before the batch is */
+	MM_AtomicOperations::storeSync();
+
+ 	/* Now that we have allocated our fragment, it is safe to expose the puddles to the rest of the VM */
 	if (NULL == _list) {
 		/* This is the first puddle. Make it the head of the list. */
 		/* (The list is empty, so there must not be an _allocPuddle) */
-		Assert_MM_true(NULL == _allocPuddle);
-		_list = emptyPuddle;
+		Assert_MM_true(NULL == tailPuddle);
+		_list = firstPuddle;
+		_allocPuddle = firstPuddle;
 	} else {
-		/* Add this puddle to the tail of the list */
+		/* Add the batch to the tail of the list */
 		/* (The list is non-empty so there must be an _allocPuddle) */
-		Assert_MM_true(NULL != _allocPuddle);
-		Assert_MM_true(NULL == _allocPuddle->getNext());
-		_allocPuddle->setNext(emptyPuddle);
+		Assert_MM_true(NULL != tailPuddle);
+		tailPuddle->setNext(firstPuddle);
+		/* Threads which saw the new link may already have moved the alloc puddle forward */
+		MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_allocPuddle, (uintptr_t)tailPuddle, (uintptr_t)firstPuddle);
 	}
-	_allocPuddle = emptyPuddle;
-	Assert_MM_true(NULL == _allocPuddle->getNext());
 
 	omrthread_monitor_exit(_mutex);
 
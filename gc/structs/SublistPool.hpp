@@ -56,9 +56,11 @@ class MM_SublistPool
  */
 private:
 	MM_SublistPuddle *_list;
-	MM_SublistPuddle *_allocPuddle;
+	MM_SublistPuddle * volatile _allocPuddle; /**< Puddle fragments are bump allocated from, advanced without the lock when it fills */
 	omrthread_monitor_t _mutex;
 	uintptr_t _growSize;
+	uintptr_t _puddleBatchCount; /**< Number of puddles created each time the pool has to grow */
+	uintptr_t _maxFragmentSize; /**< Size a fragment may grow to as its thread keeps refilling it, 0 for fixed size fragments */
 	uintptr_t _currentSize;
 	uintptr_t _maxSize;
 	volatile uintptr_t _count; /**< A count for number of elements across all sublistPuddles */
@@ -76,6 +78,21 @@ private:
 	MM_SublistPuddle *createNewPuddle(MM_EnvironmentBase *env);
 	void freePuddles(MM_EnvironmentBase *env, MM_SublistPuddle *list);
 
+	/**
+	 * Allocate the fragment from the current allocation puddle, stepping over full puddles to
+	 * the empty ones linked after it. No lock is taken: _allocPuddle only moves along links
+	 * which are published under the lock, and the puddles are only freed while the pool is
+	 * used exclusively.
+	 * @return true if the fragment was allocated, false if every linked puddle is full
+	 */
+	bool allocateFromLinkedPuddles(MM_SublistFragment *fragment);
+
+	/**
+	 * Double the size of a fragment which is being refilled, up to _maxFragmentSize. Threads
+	 * which hit the barrier often refill often, so they reach the pool less often as they go.
+	 */
+	void growFragment(MM_SublistFragment *fragment);
+
 protected:
 public:
 	bool initialize(MM_EnvironmentBase *env, OMR::GC::AllocationCategory::Enum category);
@@ -85,6 +102,10 @@ public:
 	MMINLINE uintptr_t getGrowSize() { return _growSize; }
 	MMINLINE void setMaxSize(uintptr_t maxSize) { _maxSize = maxSize; }
 	MMINLINE uintptr_t getMaxSize() { return _maxSize; }
+	MMINLINE void setPuddleBatchCount(uintptr_t puddleBatchCount) { _puddleBatchCount = OMR_MAX(puddleBatchCount, 1); }
+	MMINLINE uintptr_t getPuddleBatchCount() { return _puddleBatchCount; }
+	MMINLINE void setMaxFragmentSize(uintptr_t maxFragmentSize) { _maxFragmentSize = maxFragmentSize; }
+	MMINLINE uintptr_t getMaxFragmentSize() { return _maxFragmentSize; }
 	
 	MMINLINE void incrementCount(uintptr_t count)
 	{
@@ -131,6 +152,8 @@ public:
 		, _allocPuddle(NULL)
 		, _mutex(NULL)
 		, _growSize(0)
+		, _puddleBatchCount(1)
+		, _maxFragmentSize(0)
 		, _currentSize(0)
 		, _maxSize(0)
 		, _count(0)
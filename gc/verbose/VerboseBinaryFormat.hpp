@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYFORMAT_HPP_)
+#define VERBOSEBINARYFORMAT_HPP_
+
+/*
+ * Layout of the binary verbose GC log written by MM_VerboseWriterFileLoggingBinary
+ * (-Xgc:binaryLogging). This header is shared with the offline decoder in
+ * tools/verbosegcdecoder, so it must only depend on the C library.
+ *
+ * A log starts with a VerboseBinaryFileHeader, followed by records. Every record
+ * starts with a VerboseBinaryRecordHeader and is padded to VERBOSEGC_BINARY_RECORD_ALIGNMENT.
+ * All fields are in the byte order of the process that wrote the log.
+ *
+ * FORMAT   payload is the NUL terminated format string bound to formatID. It precedes the
+ *          first EVENT using formatID in each file, so every file of a rotating log decodes on its own.
+ * EVENT    payload holds the arguments of one formatAndOutput() call for formatID, in format
+ *          order. Integers, pointers and doubles take 8 bytes; a string is a uint32_t length
+ *          (VERBOSEGC_BINARY_NULL_STRING for NULL) followed by its bytes, without a terminator.
+ * LINE     payload is an already formatted line (used for formats the writer does not record).
+ * TEXT     payload is raw text (header, footer, initialized stanza), emitted without indent or newline.
+ *
+ * EVENT and LINE records decode to indent copies of VERBOSEGC_BINARY_INDENT, the line and a newline.
+ */
+
+#include <stdint.h>
+
+#define VERBOSEGC_BINARY_EYECATCHER "OMRVGCB"
+#define VERBOSEGC_BINARY_VERSION 1
+#define VERBOSEGC_BINARY_RECORD_ALIGNMENT 8
+#define VERBOSEGC_BINARY_NULL_STRING ((uint32_t)0xFFFFFFFF)
+#define VERBOSEGC_BINARY_INDENT "  "
+
+typedef enum {
+	VERBOSEGC_BINARY_RECORD_FORMAT = 1,
+	VERBOSEGC_BINARY_RECORD_EVENT = 2,
+	VERBOSEGC_BINARY_RECORD_LINE = 3,
+	VERBOSEGC_BINARY_RECORD_TEXT = 4
+} VerboseBinaryRecordType;
+
+typedef struct VerboseBinaryFileHeader {
+	char eyecatcher[8]; /**< VERBOSEGC_BINARY_EYECATCHER, NUL padded */
+	uint16_t version; /**< VERBOSEGC_BINARY_VERSION */
+	uint8_t pointerSize; /**< sizeof(uintptr_t) in the writing process; selects the width of %p and %z */
+	uint8_t bigEndian; /**< 1 if the writing process is big endian */
+	uint32_t reserved;
+} VerboseBinaryFileHeader;
+
+typedef struct VerboseBinaryRecordHeader {
+	uint32_t size; /**< size of the record including this header and padding */
+	uint16_t type; /**< a VerboseBinaryRecordType */
+	uint16_t indent; /**< indent level of EVENT and LINE records */
+	uint32_t formatID; /**< format bound by FORMAT and used by EVENT records, 0 otherwise */
+	uint32_t payloadSize; /**< number of payload bytes following this header */
+} VerboseBinaryRecordHeader;
+
+#endif /* VERBOSEBINARYFORMAT_HPP_ */
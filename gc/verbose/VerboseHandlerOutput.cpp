@@ -21,6 +21,7 @@
  *******************************************************************************/
 
 #include "AllocateDescription.hpp"
+#include "AllocationSampler.hpp"
 #include "AllocationStats.hpp"
 #include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
@@ -28,9 +29,14 @@
 #include "CollectionStatistics.hpp"
 #include "ConcurrentPhaseStatsBase.hpp"
 #include "Heap.hpp"
+#include "HeapMapScanner.hpp"
+#include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
+#include "MemoryMaintenanceThread.hpp"
 #include "ObjectAllocationInterface.hpp"
+#include "OMRVMThreadListIterator.hpp"
 #include "ParallelDispatcher.hpp"
+#include "TLHSizingStats.hpp"
 #include "VerboseHandlerOutput.hpp"
 #include "VerboseManager.hpp"
 #include "VerboseWriterChain.hpp"
@@ -299,6 +305,15 @@ MM_VerboseHandlerOutput::outputInitializedStanza(MM_EnvironmentBase *env, MM_Ver
 	buffer->formatAndOutput(env, 1, "<attribute name=\"pageType\" value=\"%s\" />", getPageTypeString(_extensions->heap->getPageFlags()));
 	buffer->formatAndOutput(env, 1, "<attribute name=\"requestedPageSize\" value=\"0x%zx\" />", _extensions->requestedPageSize);
 	buffer->formatAndOutput(env, 1, "<attribute name=\"requestedPageType\" value=\"%s\" />", getPageTypeString(_extensions->requestedPageFlags));
+	if (_extensions->mixedPageSizeHeap) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"mixedPageSizeHeap\" value=\"true\" />");
+	}
+	if (_extensions->backgroundDecommit) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"backgroundDecommitCPUPercent\" value=\"%zu\" />", _extensions->backgroundDecommitCPUPercent);
+	}
+	if (_extensions->allocationSampling) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"allocationSamplingInterval\" value=\"%zu\" />", _extensions->allocationSamplingInterval);
+	}
 	buffer->formatAndOutput(env, 1, "<attribute name=\"gcthreads\" value=\"%zu\" />", _extensions->gcThreadCount);
 
 	if (gc_policy_gencon == _extensions->configurationOptions._gcPolicy) {
@@ -320,6 +335,7 @@ MM_VerboseHandlerOutput::outputInitializedStanza(MM_EnvironmentBase *env, MM_Ver
 #endif /* OMR_GC_MODRON_SCAVENGER */
 	buffer->formatAndOutput(env, 1, "<attribute name=\"splitFreeListSplitAmount\" value=\"%zu\" />", _extensions->splitFreeListSplitAmount);
 	buffer->formatAndOutput(env, 1, "<attribute name=\"numaNodes\" value=\"%zu\" />", _extensions->_numaManager.getAffinityLeaderCount());
+	buffer->formatAndOutput(env, 1, "<attribute name=\"heapMapScan\" value=\"%s\" />", MM_HeapMapScanner::getKernelName());
 
 	outputInitializedInnerStanza(env, buffer);
 
@@ -784,6 +800,91 @@ MM_VerboseHandlerOutput::outputMemoryInfo(MM_EnvironmentBase *env, uintptr_t ind
 	writer->flush(env);
 }
 
+void
+MM_VerboseHandlerOutput::outputHeapPages(MM_EnvironmentBase *env, uintptr_t indent)
+{
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	MM_Heap *heap = _extensions->heap;
+	MM_HeapRegionManager *regionManager = heap->getHeapRegionManager();
+	uintptr_t pageSize = heap->getPageSize();
+	uintptr_t unusedBytes = 0;
+	/* an empty range only answers the large page size */
+	uintptr_t largePageSize = heap->getPageBacking(heap->getHeapBase(), heap->getHeapBase(), &unusedBytes, &unusedBytes);
+	uintptr_t explicitBytes = 0;
+	uintptr_t explicitRegions = 0;
+	uintptr_t transparentBytes = 0;
+	uintptr_t transparentRegions = 0;
+	uintptr_t defaultBytes = 0;
+	uintptr_t defaultRegions = 0;
+
+	/* a region counts towards every kind of page some of its memory is on */
+	regionManager->lock();
+	GC_HeapRegionIterator regionIterator(regionManager);
+	MM_HeapRegionDescriptor *region = NULL;
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (region->isCommitted()) {
+			uintptr_t regionExplicitBytes = region->getExplicitLargePageBytes();
+			uintptr_t regionTransparentBytes = region->getTransparentHugePageBytes();
+			uintptr_t regionDefaultBytes = region->getSize() - regionExplicitBytes - regionTransparentBytes;
+			if (0 != regionExplicitBytes) {
+				explicitBytes += regionExplicitBytes;
+				explicitRegions += 1;
+			}
+			if (0 != regionTransparentBytes) {
+				transparentBytes += regionTransparentBytes;
+				transparentRegions += 1;
+			}
+			if (0 != regionDefaultBytes) {
+				defaultBytes += regionDefaultBytes;
+				defaultRegions += 1;
+			}
+		}
+	}
+	regionManager->unlock();
+
+	if (0 != largePageSize) {
+		writer->formatAndOutput(env, indent, "<heap-pages>");
+		writer->formatAndOutput(env, indent + 1, "<page-size type=\"explicit\" size=\"0x%zx\" pages=\"%zu\" bytes=\"%zu\" regions=\"%zu\" />",
+				largePageSize, explicitBytes / largePageSize, explicitBytes, explicitRegions);
+		writer->formatAndOutput(env, indent + 1, "<page-size type=\"transparent\" size=\"0x%zx\" pages=\"%zu\" bytes=\"%zu\" regions=\"%zu\" />",
+				largePageSize, transparentBytes / largePageSize, transparentBytes, transparentRegions);
+		writer->formatAndOutput(env, indent + 1, "<page-size type=\"default\" size=\"0x%zx\" pages=\"%zu\" bytes=\"%zu\" regions=\"%zu\" />",
+				pageSize, defaultBytes / pageSize, defaultBytes, defaultRegions);
+		writer->formatAndOutput(env, indent, "</heap-pages>");
+	}
+}
+
+void
+MM_VerboseHandlerOutput::outputMemoryMaintenance(MM_EnvironmentBase *env, uintptr_t indent)
+{
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	uint64_t deferredBytes = 0;
+	uint64_t releasedBytes = 0;
+	uint64_t reclaimedBytes = 0;
+	uint64_t pendingBytes = 0;
+	uint64_t backgroundTime = 0;
+
+	_extensions->memoryMaintenanceThread->getStats(&deferredBytes, &releasedBytes, &reclaimedBytes, &pendingBytes, &backgroundTime);
+
+	writer->formatAndOutput(env, indent, "<memory-maintenance deferredbytes=\"%llu\" releasedbytes=\"%llu\" reclaimedbytes=\"%llu\" pendingbytes=\"%llu\" backgroundms=\"%llu.%03llu\" />",
+			deferredBytes, releasedBytes, reclaimedBytes, pendingBytes, backgroundTime / 1000, backgroundTime % 1000);
+}
+
+void
+MM_VerboseHandlerOutput::outputAllocationSampling(MM_EnvironmentBase *env, uintptr_t indent)
+{
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	uintptr_t sampleCount = 0;
+	uintptr_t stackCount = 0;
+	uintptr_t droppedCount = 0;
+	uint64_t sampleTime = 0;
+
+	_extensions->allocationSampler->getStats(&sampleCount, &stackCount, &droppedCount, &sampleTime);
+
+	writer->formatAndOutput(env, indent, "<allocation-sampling samples=\"%zu\" stacks=\"%zu\" dropped=\"%zu\" samplingms=\"%llu.%03llu\" />",
+			sampleCount, stackCount, droppedCount, sampleTime / 1000, sampleTime % 1000);
+}
+
 bool
 MM_VerboseHandlerOutput::hasOutputMemoryInfoInnerStanza()
 {
@@ -833,6 +934,28 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 		}
 		writer->formatAndOutput(env, 1, "<largest-consumer threadName=\"%s%s\" threadId=\"%p\" bytes=\"%zu\" />", escapedThreadName, dots, threadID, _extensions->bytesAllocatedMost);
 	}
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	if (_extensions->tlhAdaptiveSizing) {
+		GC_OMRVMThreadListIterator threadListIterator(_omrVM);
+		OMR_VMThread *walkThread = NULL;
+		while (NULL != (walkThread = threadListIterator.nextOMRVMThread())) {
+			MM_ObjectAllocationInterface *allocationInterface = MM_EnvironmentBase::getEnvironment(walkThread)->_objectAllocationInterface;
+			MM_TLHSizingStats *sizingStats = (NULL == allocationInterface) ? NULL : allocationInterface->getTLHSizingStats();
+			/* each interval is reported once; the limit is never 0 for an interval which has not been reported */
+			if ((NULL != sizingStats) && (0 != sizingStats->_refreshSizeLimit)) {
+				char escapedThreadName[128];
+				consumedEntireThreadName = getThreadName(escapedThreadName, sizeof(escapedThreadName), walkThread);
+				uintptr_t waste = sizingStats->getWasteHundredthsPercent();
+				writer->formatAndOutput(env, 1, "<tlh-sizing threadName=\"%s%s\" threadId=\"%p\" allocatedBytes=\"%zu\" discardedBytes=\"%zu\" waste=\"%zu.%02zu\" refreshes=\"%zu\" bytesPerMs=\"%zu\" refreshSizeLimit=\"%zu\" />",
+						escapedThreadName, consumedEntireThreadName ? "" : "...", walkThread->_language_vmthread,
+						sizingStats->_allocatedBytes, sizingStats->getDiscardedBytes(), waste / 100, waste % 100,
+						sizingStats->_refreshCount, sizingStats->getAllocationRate(), sizingStats->_refreshSizeLimit);
+				sizingStats->clear();
+			}
+		}
+	}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
 	writer->formatAndOutput(env, 0, "</allocation-stats>");
 	writer->flush(env);
 	exitAtomicReportingBlock();
@@ -898,6 +1021,15 @@ MM_VerboseHandlerOutput::handleGCEnd(J9HookInterface** hook, uintptr_t eventNum,
 	}
 	writer->formatAndOutput(env, 0, "<gc-end %s activeThreads=\"%zu\">", tagTemplate, activeThreads);
 	outputMemoryInfo(env, _manager->getIndentLevel() + 1, stats);
+	if (_extensions->mixedPageSizeHeap) {
+		outputHeapPages(env, _manager->getIndentLevel() + 1);
+	}
+	if (NULL != _extensions->memoryMaintenanceThread) {
+		outputMemoryMaintenance(env, _manager->getIndentLevel() + 1);
+	}
+	if (NULL != _extensions->allocationSampler) {
+		outputAllocationSampling(env, _manager->getIndentLevel() + 1);
+	}
 	writer->formatAndOutput(env, 0, "</gc-end>");
 	exitAtomicReportingBlock();
 }
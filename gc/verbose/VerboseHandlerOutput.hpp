@@ -201,6 +201,29 @@ protected:
 	 */
 	void outputMemoryInfo(MM_EnvironmentBase *env, uintptr_t indent, MM_CollectionStatistics *stats);
 
+	/**
+	 * Output a stand-alone stanza on the pages backing the committed heap, by page size, when the
+	 * heap mixes page sizes (-Xgc:mixedPageSizeHeap).
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 */
+	void outputHeapPages(MM_EnvironmentBase *env, uintptr_t indent);
+
+	/**
+	 * Output a stand-alone stanza on the memory the background maintenance thread has decommitted outside of
+	 * the pause (-Xgc:backgroundDecommit).  Totals are since startup.
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 */
+	void outputMemoryMaintenance(MM_EnvironmentBase *env, uintptr_t indent);
+
+	/**
+	 * Output a stand-alone stanza on the allocation samples taken so far (-Xgc:allocationSampling).
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 */
+	void outputAllocationSampling(MM_EnvironmentBase *env, uintptr_t indent);
+
 	virtual bool hasOutputMemoryInfoInnerStanza();
 
 	virtual void outputMemoryInfoInnerStanza(MM_EnvironmentBase *env, uintptr_t indent, MM_CollectionStatistics *stats);
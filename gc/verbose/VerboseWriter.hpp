@@ -24,6 +24,7 @@
 #define VERBOSEWRITER_HPP_
 
 #include "omrcfg.h"
+#include "omrstdarg.h"
 #include "modronbase.h"
 
 #include "Base.hpp"
@@ -35,7 +36,8 @@ typedef enum {
 	VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS = 2,
 	VERBOSE_WRITER_FILE_LOGGING_BUFFERED = 3,
 	VERBOSE_WRITER_TRACE = 4,
-	VERBOSE_WRITER_HOOK = 5
+	VERBOSE_WRITER_HOOK = 5,
+	VERBOSE_WRITER_FILE_LOGGING_BINARY = 6
 } WriterType;
 
 /**
@@ -69,6 +71,22 @@ public:
 
 	virtual void outputString(MM_EnvironmentBase *env, const char* string) = 0;
 
+	/**
+	 * Writers which record the format string and its arguments instead of the formatted text
+	 * answer true. The writer chain hands them each line through outputFormatV() and only
+	 * passes them text from outputString() when the buffer was filled directly.
+	 */
+	virtual bool recordsFormatArguments() { return false; }
+
+	/**
+	 * Record one line of output for a writer which records format arguments.
+	 * @param env[in] the current thread
+	 * @param indent[in] the indent level of the line
+	 * @param format[in] a format string; see omrstr_printf
+	 * @param args[in] the arguments to format
+	 */
+	virtual void outputFormatV(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args) {}
+
 	virtual bool reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t fileCount, uintptr_t iterations) = 0;
 
 	virtual void endOfCycle(MM_EnvironmentBase *env) = 0;
@@ -36,6 +36,8 @@ MM_VerboseWriterChain::MM_VerboseWriterChain()
 	: MM_Base()
 	,_buffer(NULL)
 	,_writers(NULL)
+	,_hasTextWriters(false)
+	,_recordedSinceFlush(false)
 {}
 
 MM_VerboseWriterChain *
@@ -59,9 +61,23 @@ MM_VerboseWriterChain::formatAndOutput(MM_EnvironmentBase *env, uintptr_t indent
 {
 	va_list args;
 
-	va_start(args, format);
-	_buffer->formatAndOutputV(env, indent, format, args);
-	va_end(args);
+	MM_VerboseWriter* writer = _writers;
+	while (NULL != writer) {
+		if (writer->recordsFormatArguments() && writer->isActive()) {
+			va_start(args, format);
+			writer->outputFormatV(env, indent, format, args);
+			va_end(args);
+			_recordedSinceFlush = true;
+		}
+		writer = writer->getNextWriter();
+	}
+
+	/* formatting is only paid for when some writer consumes the text */
+	if (_hasTextWriters) {
+		va_start(args, format);
+		_buffer->formatAndOutputV(env, indent, format, args);
+		va_end(args);
+	}
 }
 
 void
@@ -69,10 +85,16 @@ MM_VerboseWriterChain::flush(MM_EnvironmentBase *env)
 {
 	MM_VerboseWriter* writer = _writers;
 	while (NULL != writer) {
-		writer->outputString(env, _buffer->contents());
+		if (!writer->recordsFormatArguments()) {
+			writer->outputString(env, _buffer->contents());
+		} else if (!_recordedSinceFlush && writer->isActive() && (0 != _buffer->currentSize())) {
+			/* the buffer was filled directly (e.g. the initialized stanza) rather than through formatAndOutput() */
+			writer->outputString(env, _buffer->contents());
+		}
 		writer = writer->getNextWriter();
 	}
 	_buffer->reset();
+	_recordedSinceFlush = false;
 }
 
 void
@@ -115,6 +137,9 @@ MM_VerboseWriterChain::addWriter(MM_VerboseWriter* writer)
 {
 	writer->setNextWriter(_writers);
 	_writers = writer;
+	if (!writer->recordsFormatArguments()) {
+		_hasTextWriters = true;
+	}
 }
 
 void
@@ -45,6 +45,8 @@ protected:
 private:
 	MM_VerboseBuffer *_buffer;
 	MM_VerboseWriter *_writers;
+	bool _hasTextWriters; /**< true if any writer in the chain consumes formatted text */
+	bool _recordedSinceFlush; /**< true if lines were handed to writers recording format arguments since the last flush */
 
 public:
 	static MM_VerboseWriterChain *newInstance(MM_EnvironmentBase *env);
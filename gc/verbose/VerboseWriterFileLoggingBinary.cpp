@@ -0,0 +1,755 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "modronapicore.hpp"
+#include "omrutil.h"
+#include "VerboseManager.hpp"
+#include "VerboseWriterFileLoggingBinary.hpp"
+
+#include "GCExtensionsBase.hpp"
+#include "EnvironmentBase.hpp"
+#include "Math.hpp"
+#include "VerboseBinaryFormat.hpp"
+#include "VerboseBuffer.hpp"
+#include "VerboseHandlerOutput.hpp"
+
+#include <string.h>
+
+#define VERBOSE_BINARY_MINIMUM_RING_SIZE (64 * 1024)
+#define VERBOSE_BINARY_FLUSH_INTERVAL_MILLIS 100
+
+/* how an argument is read from the va_list, following the rules of omrstr_vprintf */
+enum {
+	VERBOSE_BINARY_ARG_U32 = 0,
+	VERBOSE_BINARY_ARG_U64,
+	VERBOSE_BINARY_ARG_DOUBLE,
+	VERBOSE_BINARY_ARG_POINTER,
+	VERBOSE_BINARY_ARG_STRING
+};
+
+MM_VerboseWriterFileLoggingBinary::MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_BINARY)
+	,_portLibrary(env->getPortLibrary())
+	,_logFileDescriptor(-1)
+	,_ringMonitor(NULL)
+	,_ring(NULL)
+	,_ringSize(0)
+	,_producedBytes(0)
+	,_writtenBytes(0)
+	,_writeInProgress(false)
+	,_flushThreadState(FLUSH_THREAD_NONE)
+	,_formats(NULL)
+	,_formatCount(0)
+	,_fileGeneration(0)
+	,_record(NULL)
+	,_recordCapacity(0)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingBinary instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingBinary.
+ */
+MM_VerboseWriterFileLoggingBinary *
+MM_VerboseWriterFileLoggingBinary::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingBinary *agent = (MM_VerboseWriterFileLoggingBinary *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingBinary), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingBinary(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingBinary instance.
+ * The ring, format table and flush thread survive reconfiguration, which re-enters this method.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (NULL == _ringMonitor) {
+		if (0 != omrthread_monitor_init_with_name(&_ringMonitor, 0, "MM_VerboseWriterFileLoggingBinary::_ringMonitor")) {
+			_ringMonitor = NULL;
+			return false;
+		}
+	}
+
+	if (NULL == _ring) {
+		_ringSize = VERBOSE_BINARY_MINIMUM_RING_SIZE;
+		while (_ringSize < extensions->binaryLoggingBufferSize) {
+			_ringSize <<= 1;
+		}
+		_ring = (uint8_t *)extensions->getForge()->allocate(_ringSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _ring) {
+			return false;
+		}
+	}
+
+	if (NULL == _formats) {
+		uintptr_t tableSize = sizeof(MM_VerboseBinaryFormat) * VERBOSE_BINARY_FORMAT_TABLE_SIZE;
+		_formats = (MM_VerboseBinaryFormat *)extensions->getForge()->allocate(tableSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _formats) {
+			return false;
+		}
+		memset(_formats, 0, tableSize);
+	}
+
+	if (!ensureRecordCapacity(env, INITIAL_BUFFER_SIZE)) {
+		return false;
+	}
+
+	if (FLUSH_THREAD_NONE == _flushThreadState) {
+		/* without the thread, producers write the ring out themselves when it fills */
+		startFlushThread(env);
+	}
+
+	return MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles);
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingBinary.
+ * Writes out anything left in the ring and stops the flush thread.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	closeFile(env);
+	stopFlushThread(env);
+
+	extensions->getForge()->free(_record);
+	_record = NULL;
+	if (NULL != _formats) {
+		for (uintptr_t i = 0; i < VERBOSE_BINARY_FORMAT_TABLE_SIZE; i++) {
+			extensions->getForge()->free(_formats[i].format);
+		}
+		extensions->getForge()->free(_formats);
+		_formats = NULL;
+	}
+	extensions->getForge()->free(_ring);
+	_ring = NULL;
+	if (NULL != _ringMonitor) {
+		omrthread_monitor_destroy(_ringMonitor);
+		_ringMonitor = NULL;
+	}
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+bool
+MM_VerboseWriterFileLoggingBinary::startFlushThread(MM_EnvironmentBase *env)
+{
+	bool success = false;
+
+	/* hold the monitor over start-up so the thread cannot report its state before we wait for it */
+	omrthread_monitor_enter(_ringMonitor);
+	_flushThreadState = FLUSH_THREAD_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_NORMAL,
+		0,
+		flushThreadEntryPoint,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (FLUSH_THREAD_STARTING == _flushThreadState) {
+			omrthread_monitor_wait(_ringMonitor);
+		}
+		success = (FLUSH_THREAD_RUNNING == _flushThreadState);
+	} else {
+		_flushThreadState = FLUSH_THREAD_NONE;
+	}
+	omrthread_monitor_exit(_ringMonitor);
+
+	return success;
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::stopFlushThread(MM_EnvironmentBase *env)
+{
+	if (NULL != _ringMonitor) {
+		omrthread_monitor_enter(_ringMonitor);
+		if (FLUSH_THREAD_RUNNING == _flushThreadState) {
+			/* tell the thread to write out the ring and exit, and wait for it to do so */
+			_flushThreadState = FLUSH_THREAD_TERMINATION_REQUESTED;
+			omrthread_monitor_notify_all(_ringMonitor);
+			while (FLUSH_THREAD_TERMINATED != _flushThreadState) {
+				omrthread_monitor_wait(_ringMonitor);
+			}
+		}
+		_flushThreadState = FLUSH_THREAD_NONE;
+		omrthread_monitor_exit(_ringMonitor);
+	}
+}
+
+int J9THREAD_PROC
+MM_VerboseWriterFileLoggingBinary::flushThreadEntryPoint(void *writer)
+{
+	((MM_VerboseWriterFileLoggingBinary *)writer)->flushThreadLoop();
+	return 0;
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::flushThreadLoop()
+{
+	omrthread_monitor_enter(_ringMonitor);
+	_flushThreadState = FLUSH_THREAD_RUNNING;
+	omrthread_monitor_notify_all(_ringMonitor);
+
+	while (FLUSH_THREAD_TERMINATION_REQUESTED != _flushThreadState) {
+		if ((_producedBytes != _writtenBytes) && !_writeInProgress) {
+			writeRing();
+		} else {
+			/* producers wake us early when the ring is half full or someone waits for it to drain */
+			omrthread_monitor_wait_timed(_ringMonitor, VERBOSE_BINARY_FLUSH_INTERVAL_MILLIS, 0);
+		}
+	}
+
+	drainRing();
+	_flushThreadState = FLUSH_THREAD_TERMINATED;
+	omrthread_monitor_notify_all(_ringMonitor);
+	omrthread_exit(_ringMonitor);
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::writeRing()
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+	uint64_t start = _writtenBytes;
+	uint64_t end = _producedBytes;
+	intptr_t fd = _logFileDescriptor;
+
+	_writeInProgress = true;
+	omrthread_monitor_exit(_ringMonitor);
+
+	/* producers only reuse ring space once _writtenBytes moves past it, so [start, end) is stable */
+	if (-1 != fd) {
+		uintptr_t offset = (uintptr_t)(start & (_ringSize - 1));
+		uintptr_t length = (uintptr_t)(end - start);
+		uintptr_t firstLength = OMR_MIN(length, _ringSize - offset);
+		omrfile_write(fd, _ring + offset, firstLength);
+		if (firstLength < length) {
+			omrfile_write(fd, _ring, length - firstLength);
+		}
+	}
+
+	omrthread_monitor_enter(_ringMonitor);
+	_writtenBytes = end;
+	_writeInProgress = false;
+	omrthread_monitor_notify_all(_ringMonitor);
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::drainRing()
+{
+	while ((_producedBytes != _writtenBytes) || _writeInProgress) {
+		if (_writeInProgress) {
+			omrthread_monitor_wait(_ringMonitor);
+		} else if (FLUSH_THREAD_RUNNING == _flushThreadState) {
+			omrthread_monitor_notify_all(_ringMonitor);
+			omrthread_monitor_wait(_ringMonitor);
+		} else {
+			writeRing();
+		}
+	}
+}
+
+/**
+ * Opens the file to log output to and writes the file header and the XML header.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::openFile(MM_EnvironmentBase *env, bool printInitializedHeader)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	omrthread_monitor_enter(_ringMonitor);
+	/* anything still in the ring belongs to the previous file */
+	drainRing();
+
+	_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if(-1 == _logFileDescriptor) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (-1 == _logFileDescriptor) {
+			omrthread_monitor_exit(_ringMonitor);
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	/* the ring is empty, so the file header can go straight to the file */
+	VerboseBinaryFileHeader fileHeader;
+	uint16_t byteOrderProbe = 1;
+	memset(&fileHeader, 0, sizeof(fileHeader));
+	strcpy(fileHeader.eyecatcher, VERBOSEGC_BINARY_EYECATCHER);
+	fileHeader.version = VERBOSEGC_BINARY_VERSION;
+	fileHeader.pointerSize = sizeof(uintptr_t);
+	fileHeader.bigEndian = (0 == *(uint8_t *)&byteOrderProbe) ? 1 : 0;
+	omrfile_write(_logFileDescriptor, &fileHeader, sizeof(fileHeader));
+
+	/* formats are defined again in each file, so every file decodes on its own */
+	_fileGeneration += 1;
+
+	const char *header = getHeader(env);
+	commitText(env, VERBOSEGC_BINARY_RECORD_TEXT, 0, header, strlen(header));
+	omrthread_monitor_exit(_ringMonitor);
+
+	/* Print an Initialized Stanza in new file */
+	if (printInitializedHeader) {
+		MM_VerboseBuffer* buffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+		if (NULL != buffer) {
+			_manager->getVerboseHandlerOutput()->outputInitializedStanza(env, buffer);
+			outputString(env, buffer->contents());
+			buffer->kill(env);
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Writes out the ring, prints the footer and closes the file being logged to.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::closeFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (NULL != _ringMonitor) {
+		omrthread_monitor_enter(_ringMonitor);
+		if(-1 != _logFileDescriptor) {
+			const char *footer = getFooter(env);
+			commitText(env, VERBOSEGC_BINARY_RECORD_TEXT, 0, footer, strlen(footer));
+			commitText(env, VERBOSEGC_BINARY_RECORD_TEXT, 0, "\n", strlen("\n"));
+			drainRing();
+			omrfile_close(_logFileDescriptor);
+			_logFileDescriptor = -1;
+		}
+		omrthread_monitor_exit(_ringMonitor);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	if(-1 == _logFileDescriptor) {
+		/**
+		 * Under normal circumstances, new file should be opened during endOfCycle call.
+		 * This path works as one backup, in case we failed to open the file,  we’ll attempt to open it again before outputting the string.
+		 */
+		openFile(env);
+	}
+
+	omrthread_monitor_enter(_ringMonitor);
+	commitText(env, VERBOSEGC_BINARY_RECORD_TEXT, 0, string, strlen(string));
+	omrthread_monitor_exit(_ringMonitor);
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::outputFormatV(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	va_list argsCopy;
+
+	if(-1 == _logFileDescriptor) {
+		/* see outputString() */
+		openFile(env);
+	}
+
+	omrthread_monitor_enter(_ringMonitor);
+
+	MM_VerboseBinaryFormat *entry = lookupFormat(env, format);
+	if ((NULL == entry) || !entry->recordable) {
+		/* format table full or out of memory, or a format the decoder cannot replay: record the formatted line */
+		COPY_VA_LIST(argsCopy, args);
+		uintptr_t length = omrstr_vprintf(NULL, 0, format, argsCopy);
+		END_VA_LIST_COPY(argsCopy);
+		/* room for the '\0' omrstr_vprintf appends */
+		if (ensureRecordCapacity(env, recordSize(length + 1))) {
+			uint8_t *payload = startRecord(_record, VERBOSEGC_BINARY_RECORD_LINE, indent, 0, length);
+			COPY_VA_LIST(argsCopy, args);
+			omrstr_vprintf((char *)payload, length + 1, format, argsCopy);
+			END_VA_LIST_COPY(argsCopy);
+			commitRecord(recordSize(length));
+		}
+	} else {
+		if (_fileGeneration != entry->fileGeneration) {
+			uintptr_t formatLength = strlen(format) + 1;
+			if (ensureRecordCapacity(env, recordSize(formatLength))) {
+				uint8_t *payload = startRecord(_record, VERBOSEGC_BINARY_RECORD_FORMAT, 0, entry->id, formatLength);
+				memcpy(payload, format, formatLength);
+				commitRecord(recordSize(formatLength));
+				entry->fileGeneration = _fileGeneration;
+			}
+		}
+
+		/* first pass sizes the payload, second pass copies the arguments */
+		uintptr_t payloadSize = 0;
+		COPY_VA_LIST(argsCopy, args);
+		for (uint32_t i = 0; i < entry->argCount; i++) {
+			switch (entry->argTypes[i]) {
+			case VERBOSE_BINARY_ARG_U32:
+				va_arg(argsCopy, uint32_t);
+				payloadSize += sizeof(uint64_t);
+				break;
+			case VERBOSE_BINARY_ARG_U64:
+				va_arg(argsCopy, uint64_t);
+				payloadSize += sizeof(uint64_t);
+				break;
+			case VERBOSE_BINARY_ARG_DOUBLE:
+				va_arg(argsCopy, double);
+				payloadSize += sizeof(uint64_t);
+				break;
+			case VERBOSE_BINARY_ARG_POINTER:
+				va_arg(argsCopy, void *);
+				payloadSize += sizeof(uint64_t);
+				break;
+			case VERBOSE_BINARY_ARG_STRING:
+			{
+				const char *string = va_arg(argsCopy, const char *);
+				payloadSize += sizeof(uint32_t) + ((NULL == string) ? 0 : strlen(string));
+				break;
+			}
+			}
+		}
+		END_VA_LIST_COPY(argsCopy);
+
+		if (ensureRecordCapacity(env, recordSize(payloadSize))) {
+			uint8_t *cursor = startRecord(_record, VERBOSEGC_BINARY_RECORD_EVENT, indent, entry->id, payloadSize);
+			COPY_VA_LIST(argsCopy, args);
+			for (uint32_t i = 0; i < entry->argCount; i++) {
+				uint64_t value = 0;
+				switch (entry->argTypes[i]) {
+				case VERBOSE_BINARY_ARG_U32:
+					value = va_arg(argsCopy, uint32_t);
+					break;
+				case VERBOSE_BINARY_ARG_U64:
+					value = va_arg(argsCopy, uint64_t);
+					break;
+				case VERBOSE_BINARY_ARG_DOUBLE:
+				{
+					double dbl = va_arg(argsCopy, double);
+					memcpy(&value, &dbl, sizeof(value));
+					break;
+				}
+				case VERBOSE_BINARY_ARG_POINTER:
+					value = (uint64_t)(uintptr_t)va_arg(argsCopy, void *);
+					break;
+				case VERBOSE_BINARY_ARG_STRING:
+				{
+					const char *string = va_arg(argsCopy, const char *);
+					uint32_t length = (NULL == string) ? VERBOSEGC_BINARY_NULL_STRING : (uint32_t)strlen(string);
+					memcpy(cursor, &length, sizeof(length));
+					cursor += sizeof(length);
+					if (NULL != string) {
+						memcpy(cursor, string, length);
+						cursor += length;
+					}
+					continue;
+				}
+				}
+				memcpy(cursor, &value, sizeof(value));
+				cursor += sizeof(value);
+			}
+			END_VA_LIST_COPY(argsCopy);
+			commitRecord(recordSize(payloadSize));
+		}
+	}
+
+	omrthread_monitor_exit(_ringMonitor);
+}
+
+MM_VerboseBinaryFormat *
+MM_VerboseWriterFileLoggingBinary::lookupFormat(MM_EnvironmentBase *env, const char *format)
+{
+	/* FNV-1a */
+	uintptr_t hash = 2166136261U;
+	uintptr_t formatLength = 0;
+	for (; '\0' != format[formatLength]; formatLength++) {
+		hash = (hash ^ (uint8_t)format[formatLength]) * 16777619U;
+	}
+
+	uintptr_t mask = VERBOSE_BINARY_FORMAT_TABLE_SIZE - 1;
+	uintptr_t index = hash & mask;
+
+	for (uintptr_t probe = 0; probe < VERBOSE_BINARY_FORMAT_TABLE_SIZE; probe++) {
+		MM_VerboseBinaryFormat *entry = &_formats[(index + probe) & mask];
+		if ((hash == entry->hash) && (NULL != entry->format) && (0 == strcmp(format, entry->format))) {
+			return entry;
+		}
+		if (NULL == entry->format) {
+			char *copy = (char *)env->getForge()->allocate(formatLength + 1, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+			if (NULL == copy) {
+				return NULL;
+			}
+			memcpy(copy, format, formatLength + 1);
+			entry->format = copy;
+			entry->hash = hash;
+			entry->id = ++_formatCount;
+			entry->fileGeneration = 0;
+			parseFormat(entry);
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Work out which arguments a format consumes, mirroring the format parser of omrstr_vprintf.
+ * Formats using argument indexes or unsupported conversions are marked unrecordable.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::parseFormat(MM_VerboseBinaryFormat *entry)
+{
+	const char *cursor = entry->format;
+	uint32_t argCount = 0;
+	bool recordable = true;
+
+	while (recordable && ('\0' != *cursor)) {
+		if ('%' != *cursor++) {
+			continue;
+		}
+		if ('%' == *cursor) {
+			cursor += 1;
+			continue;
+		}
+
+		/* an argument index (e.g. "%1$s") is not replayed */
+		const char *digits = cursor;
+		while (('0' <= *digits) && ('9' >= *digits)) {
+			digits += 1;
+		}
+		if ('$' == *digits) {
+			recordable = false;
+			break;
+		}
+
+		/* flag */
+		if (NULL != strchr("0 -+#", *cursor)) {
+			cursor += ('\0' == *cursor) ? 0 : 1;
+		}
+
+		/* width and precision; '*' consumes a 32 bit argument */
+		bool isLongLong = false;
+		uint8_t types[3];
+		uint32_t typeCount = 0;
+		if ('*' == *cursor) {
+			types[typeCount++] = VERBOSE_BINARY_ARG_U32;
+			cursor += 1;
+		} else {
+			while (('0' <= *cursor) && ('9' >= *cursor)) {
+				cursor += 1;
+			}
+		}
+		if ('.' == *cursor) {
+			cursor += 1;
+			if ('*' == *cursor) {
+				types[typeCount++] = VERBOSE_BINARY_ARG_U32;
+				cursor += 1;
+			} else {
+				while (('0' <= *cursor) && ('9' >= *cursor)) {
+					cursor += 1;
+				}
+			}
+		}
+
+		/* modifier */
+		if ('z' == *cursor) {
+			cursor += 1;
+			isLongLong = (8 == sizeof(uintptr_t));
+		} else if ('l' == *cursor) {
+			cursor += 1;
+			if ('l' == *cursor) {
+				cursor += 1;
+				isLongLong = true;
+			} else if (('s' == *cursor) || ('c' == *cursor)) {
+				/* wide strings and characters are not replayed */
+				recordable = false;
+				break;
+			}
+		}
+
+		switch (*cursor) {
+		case 'c':
+			types[typeCount++] = VERBOSE_BINARY_ARG_U32;
+			break;
+		case 'i':
+		case 'd':
+		case 'u':
+		case 'x':
+		case 'X':
+			types[typeCount++] = isLongLong ? VERBOSE_BINARY_ARG_U64 : VERBOSE_BINARY_ARG_U32;
+			break;
+		case 'p':
+			types[typeCount++] = VERBOSE_BINARY_ARG_POINTER;
+			break;
+		case 's':
+			types[typeCount++] = VERBOSE_BINARY_ARG_STRING;
+			break;
+		case 'f':
+		case 'e':
+		case 'E':
+		case 'F':
+		case 'g':
+		case 'G':
+			types[typeCount++] = VERBOSE_BINARY_ARG_DOUBLE;
+			break;
+		default:
+			recordable = false;
+			break;
+		}
+		if (!recordable || ((argCount + typeCount) > VERBOSE_BINARY_MAX_FORMAT_ARGS)) {
+			recordable = false;
+			break;
+		}
+		cursor += 1;
+
+		for (uint32_t i = 0; i < typeCount; i++) {
+			entry->argTypes[argCount++] = types[i];
+		}
+	}
+
+	entry->argCount = argCount;
+	entry->recordable = recordable;
+}
+
+bool
+MM_VerboseWriterFileLoggingBinary::ensureRecordCapacity(MM_EnvironmentBase *env, uintptr_t size)
+{
+	if (size > _recordCapacity) {
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		uintptr_t newCapacity = OMR_MAX(size, 2 * _recordCapacity);
+		uint8_t *newRecord = (uint8_t *)extensions->getForge()->allocate(newCapacity, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == newRecord) {
+			return false;
+		}
+		extensions->getForge()->free(_record);
+		_record = newRecord;
+		_recordCapacity = newCapacity;
+	}
+	return true;
+}
+
+uintptr_t
+MM_VerboseWriterFileLoggingBinary::recordSize(uintptr_t payloadSize)
+{
+	return MM_Math::roundToCeiling(VERBOSEGC_BINARY_RECORD_ALIGNMENT, sizeof(VerboseBinaryRecordHeader) + payloadSize);
+}
+
+uint8_t *
+MM_VerboseWriterFileLoggingBinary::startRecord(uint8_t *cursor, uint16_t type, uintptr_t indent, uint32_t formatID, uintptr_t payloadSize)
+{
+	VerboseBinaryRecordHeader header;
+	uintptr_t size = recordSize(payloadSize);
+
+	header.size = (uint32_t)size;
+	header.type = type;
+	header.indent = (uint16_t)indent;
+	header.formatID = formatID;
+	header.payloadSize = (uint32_t)payloadSize;
+	memcpy(cursor, &header, sizeof(header));
+
+	/* clear the padding so logs are reproducible */
+	memset(cursor + sizeof(header) + payloadSize, 0, size - sizeof(header) - payloadSize);
+	return cursor + sizeof(header);
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::commitText(MM_EnvironmentBase *env, uint16_t type, uintptr_t indent, const char *text, uintptr_t length)
+{
+	if (ensureRecordCapacity(env, recordSize(length))) {
+		uint8_t *payload = startRecord(_record, type, indent, 0, length);
+		memcpy(payload, text, length);
+		commitRecord(recordSize(length));
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::commitRecord(uintptr_t size)
+{
+	if (size > _ringSize) {
+		/* too large to stage: write it behind everything already in the ring */
+		OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+		drainRing();
+		if (-1 != _logFileDescriptor) {
+			omrfile_write(_logFileDescriptor, _record, size);
+		}
+		return;
+	}
+
+	while ((_ringSize - (uintptr_t)(_producedBytes - _writtenBytes)) < size) {
+		if (_writeInProgress) {
+			omrthread_monitor_wait(_ringMonitor);
+		} else if (FLUSH_THREAD_RUNNING == _flushThreadState) {
+			omrthread_monitor_notify_all(_ringMonitor);
+			omrthread_monitor_wait(_ringMonitor);
+		} else {
+			writeRing();
+		}
+	}
+
+	uintptr_t offset = (uintptr_t)(_producedBytes & (_ringSize - 1));
+	uintptr_t firstLength = OMR_MIN(size, _ringSize - offset);
+	memcpy(_ring + offset, _record, firstLength);
+	if (firstLength < size) {
+		memcpy(_ring, _record + firstLength, size - firstLength);
+	}
+	_producedBytes += size;
+
+	if (((uintptr_t)(_producedBytes - _writtenBytes) >= (_ringSize / 2)) && (FLUSH_THREAD_RUNNING == _flushThreadState)) {
+		omrthread_monitor_notify_all(_ringMonitor);
+	}
+}
@@ -0,0 +1,146 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGBINARY_HPP_)
+#define VERBOSEWRITERFILELOGGINGBINARY_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+
+#include "VerboseWriterFileLogging.hpp"
+
+#define VERBOSE_BINARY_MAX_FORMAT_ARGS 32
+#define VERBOSE_BINARY_FORMAT_TABLE_SIZE 1024
+
+/**
+ * A format string seen by the binary writer, with the argument layout parsed out of it.
+ * Some formats are built in stack buffers, so they are identified by content and the writer
+ * keeps its own copy of each one.
+ */
+struct MM_VerboseBinaryFormat {
+	char *format; /**< the writer's copy of the format string, NULL if the slot is unused */
+	uintptr_t hash; /**< hash of the format string */
+	uint32_t id; /**< formatID written to the log */
+	uint32_t argCount; /**< number of va_list arguments the format consumes */
+	uintptr_t fileGeneration; /**< file the FORMAT record was last written to */
+	bool recordable; /**< false if the format uses a conversion the decoder does not replay */
+	uint8_t argTypes[VERBOSE_BINARY_MAX_FORMAT_ARGS]; /**< how each argument is read from the va_list */
+};
+
+/**
+ * Output agent which records verbosegc output to file as binary events.
+ * Lines are stored as a format identifier plus raw arguments in a ring buffer, which
+ * a background thread writes to the file. Formatting is deferred to the offline decoder
+ * (tools/verbosegcdecoder), which reproduces the XML the text writers would have written.
+ * @see VerboseBinaryFormat.hpp
+ */
+class MM_VerboseWriterFileLoggingBinary : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	enum FlushThreadState {
+		FLUSH_THREAD_NONE = 0, /**< not started, or could not be started; producers write the ring out themselves */
+		FLUSH_THREAD_STARTING,
+		FLUSH_THREAD_RUNNING,
+		FLUSH_THREAD_TERMINATION_REQUESTED,
+		FLUSH_THREAD_TERMINATED
+	};
+
+	OMRPortLibrary *_portLibrary; /**< used by the flush thread, which has no environment */
+	intptr_t _logFileDescriptor; /**< the file being written to */
+	omrthread_monitor_t _ringMonitor; /**< protects the ring, the format table and the file */
+	uint8_t *_ring; /**< staging ring, _ringSize bytes */
+	uintptr_t _ringSize; /**< power of two */
+	uint64_t _producedBytes; /**< total bytes added to the ring */
+	uint64_t _writtenBytes; /**< total bytes written from the ring to the file */
+	bool _writeInProgress; /**< true while a thread writes part of the ring to the file outside the monitor */
+	volatile FlushThreadState _flushThreadState;
+
+	MM_VerboseBinaryFormat *_formats; /**< open addressed table of formats, VERBOSE_BINARY_FORMAT_TABLE_SIZE entries */
+	uint32_t _formatCount; /**< formats in the table, also the last formatID handed out */
+	uintptr_t _fileGeneration; /**< incremented when a file is opened, so formats are redefined in each file */
+
+	uint8_t *_record; /**< scratch space a record is assembled in before it is copied to the ring */
+	uintptr_t _recordCapacity;
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingBinary *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+
+	virtual bool recordsFormatArguments() { return true; }
+	virtual void outputFormatV(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args);
+
+protected:
+	MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env, bool printInitializedHeader = false);
+	void closeFile(MM_EnvironmentBase *env);
+
+	bool startFlushThread(MM_EnvironmentBase *env);
+	void stopFlushThread(MM_EnvironmentBase *env);
+	static int J9THREAD_PROC flushThreadEntryPoint(void *writer);
+	void flushThreadLoop();
+
+	/**
+	 * Write pending ring bytes to the file. Called with _ringMonitor held; the monitor is released
+	 * while the file is written.
+	 */
+	void writeRing();
+
+	/**
+	 * Wait until every byte added to the ring has been written. Called with _ringMonitor held.
+	 */
+	void drainRing();
+
+	MM_VerboseBinaryFormat *lookupFormat(MM_EnvironmentBase *env, const char *format);
+	static void parseFormat(MM_VerboseBinaryFormat *entry);
+
+	bool ensureRecordCapacity(MM_EnvironmentBase *env, uintptr_t size);
+	uint8_t *startRecord(uint8_t *cursor, uint16_t type, uintptr_t indent, uint32_t formatID, uintptr_t payloadSize);
+	uintptr_t recordSize(uintptr_t payloadSize);
+
+	/**
+	 * Add the record assembled in _record to the ring, waiting for room if necessary.
+	 * Called with _ringMonitor held.
+	 */
+	void commitRecord(uintptr_t size);
+
+	/**
+	 * Assemble a LINE or TEXT record holding text and commit it. Called with _ringMonitor held.
+	 */
+	void commitText(MM_EnvironmentBase *env, uint16_t type, uintptr_t indent, const char *text, uintptr_t length);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGBINARY_HPP_ */
@@ -30,6 +30,12 @@
 #include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapResizeStats.hpp"
+#include "HeapSizingCostModel.hpp"
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#include "SizeClasses.hpp"
+#endif /* OMR_GC_SEGREGATED_HEAP */
 #include "VerboseHandlerOutputStandard.hpp"
 #include "VerboseManager.hpp"
 #include "VerboseWriterChain.hpp"
@@ -263,6 +269,62 @@ MM_VerboseHandlerOutputStandard::getConcurrentTypeString(uintptr_t type)
 	return cycleType;
 }
 
+MM_HeapSizingStats *
+MM_VerboseHandlerOutputStandard::getUnreportedHeapSizing()
+{
+	MM_HeapSizingStats *heapSizing = NULL;
+	if (_extensions->heapSizingCostModel) {
+		heapSizing = _extensions->heap->getResizeStats()->getHeapSizingStats();
+		if ((heapSizing->_gcCount == _heapSizingReportedGCCount)
+			|| (heapSizing->_gcCount != _extensions->globalGCStats.gcCount)
+			|| (HEAP_SIZING_LIMIT_NONE == heapSizing->_limit)
+		) {
+			heapSizing = NULL;
+		}
+	}
+	return heapSizing;
+}
+
+bool
+MM_VerboseHandlerOutputStandard::hasCycleEndInnerStanzas()
+{
+	return NULL != getUnreportedHeapSizing();
+}
+
+void
+MM_VerboseHandlerOutputStandard::handleCycleEndInnerStanzas(J9HookInterface** hook, uintptr_t eventNum, void* eventData, uintptr_t indentDepth)
+{
+	MM_GCPostCycleEndEvent* event = (MM_GCPostCycleEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_HeapSizingStats *heapSizing = getUnreportedHeapSizing();
+
+	/* checkResize() may decide after compaction, past the sweep, so the decision is reported with the end of the cycle */
+	if (NULL != heapSizing) {
+		outputHeapSizing(env, indentDepth, heapSizing);
+		_heapSizingReportedGCCount = heapSizing->_gcCount;
+	}
+}
+
+void
+MM_VerboseHandlerOutputStandard::outputHeapSizing(MM_EnvironmentBase *env, uintptr_t indent, MM_HeapSizingStats *heapSizing)
+{
+	MM_GCExtensionsBase *extensions = _extensions;
+	MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+	MM_HeapSizingSample *sample = &heapSizing->_sample;
+	uintptr_t gcTimeTarget = (extensions->heapExpansionGCTimeThreshold + extensions->heapContractionGCTimeThreshold) / 2;
+
+	writer->formatAndOutput(env, indent, "<heap-sizing target=\"%zu\" limit=\"%s\" allocationrate=\"%llu\" markuspermb=\"%llu\" sweepuspermb=\"%llu\" predictedpausems=\"%llu.%03llu\">",
+			heapSizing->_targetSize, MM_HeapSizingCostModel::getLimitAsString(heapSizing->_limit), heapSizing->_allocationRate,
+			heapSizing->_markMicrosPerMB, heapSizing->_sweepMicrosPerMB, heapSizing->_predictedPauseMicros / 1000, heapSizing->_predictedPauseMicros % 1000);
+	writer->formatAndOutput(env, indent + 1, "<heap-sizing-sample intervalms=\"%llu.%03llu\" pausems=\"%llu.%03llu\" allocated=\"%zu\" live=\"%zu\" current=\"%zu\" minimum=\"%zu\" maximum=\"%zu\" containerbudget=\"%zu\" required=\"%zu\" />",
+			sample->intervalMicros / 1000, sample->intervalMicros % 1000, sample->pauseMicros / 1000, sample->pauseMicros % 1000,
+			sample->allocatedBytes, sample->liveBytes, sample->currentSize, sample->minimumSize, sample->maximumSize,
+			sample->containerBudget, sample->bytesRequired);
+	writer->formatAndOutput(env, indent + 1, "<heap-sizing-targets gctimetarget=\"%zu\" pausetargetms=\"%zu\" granule=\"%zu\" containerlimit=\"%llu\" />",
+			gcTimeTarget, extensions->heapSizingPauseTarget, extensions->regionSize, heapSizing->_containerLimit);
+	writer->formatAndOutput(env, indent, "</heap-sizing>");
+}
+
 void
 MM_VerboseHandlerOutputStandard::handleGCOPStanza(MM_EnvironmentBase* env, const char *type, uintptr_t contextID, uint64_t duration, bool deltaTimeSuccess)
 {
@@ -298,6 +360,17 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
 			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
 
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	if (extensions->workStealingMarking) {
+		MM_WorkPacketStats *workPacketStats = &extensions->globalGCStats.workPacketStats;
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		writer->formatAndOutput(env, 1, "<work-stealing attempts=\"%zu\" stolen=\"%zu\" stealtimems=\"%llu\" stalltimems=\"%llu\" />",
+				workPacketStats->_stealAttemptCount, workPacketStats->workPacketsStolen,
+				omrtime_hires_delta(0, workPacketStats->_stealTime, OMRPORT_TIME_DELTA_IN_MILLISECONDS),
+				omrtime_hires_delta(0, workPacketStats->getStallTime(), OMRPORT_TIME_DELTA_IN_MILLISECONDS));
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
 	handleMarkEndInternal(env, eventData);
 
 	handleGCOPOuterStanzaEnd(env);
@@ -322,7 +395,33 @@ MM_VerboseHandlerOutputStandard::handleSweepEnd(J9HookInterface** hook, uintptr_
 	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, sweepStats->_startTime, sweepStats->_endTime);
 
 	enterAtomicReportingBlock();
-	handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	uintptr_t smallRegionCount = 0;
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		smallRegionCount += sweepStats->_sizeClassRegionsSwept[sizeClass] + sweepStats->_sizeClassRegionsDeferred[sizeClass];
+	}
+	if (0 != smallRegionCount) {
+		MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+		MM_SizeClasses *sizeClasses = extensions->defaultSizeClasses;
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+		handleGCOPOuterStanzaStart(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+		for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+			uintptr_t regionsSwept = sweepStats->_sizeClassRegionsSwept[sizeClass];
+			uintptr_t regionsDeferred = sweepStats->_sizeClassRegionsDeferred[sizeClass];
+			if (0 != (regionsSwept + regionsDeferred)) {
+				uint64_t sweepTimeUs = omrtime_hires_delta(0, sweepStats->_sizeClassSweepTime[sizeClass], OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+				writer->formatAndOutput(env, 1, "<sweep-sizeclass cellsize=\"%zu\" regions=\"%zu\" deferred=\"%zu\" timems=\"%llu.%03llu\" />",
+						sizeClasses->getCellSize(sizeClass), regionsSwept, regionsDeferred, sweepTimeUs / 1000, sweepTimeUs % 1000);
+			}
+		}
+		handleGCOPOuterStanzaEnd(env);
+		writer->flush(env);
+	} else
+#endif /* OMR_GC_SEGREGATED_HEAP */
+	{
+		handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+	}
 
 	handleSweepEndInternal(env, eventData);
 	exitAtomicReportingBlock();
@@ -372,6 +471,11 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 	if(COMPACT_PREVENTED_NONE == compactStats->_compactPreventedReason) {
 		writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" />",
 				compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason));
+		if (compactStats->_incremental) {
+			writer->formatAndOutput(env, 1, "<compact-incremental ranges=\"%zu\" budget=\"%zu\" fragmentedbytes=\"%zu\" remainingfragmentedbytes=\"%zu\" />",
+					compactStats->_incrementalRanges, MM_GCExtensionsBase::getExtensions(env->getOmrVM())->incrementalCompactBudget,
+					compactStats->_fragmentedBytes, compactStats->_remainingFragmentedBytes);
+		}
 	} else {
 		writer->formatAndOutput(env, 1, "<compact-info reason=\"%s\" />", getCompactionReasonAsString(compactStats->_compactReason));
 		writer->formatAndOutput(env, 1, "<warning details=\"compaction prevented due to %s\" />", getCompactionPreventedReasonAsString(compactStats->_compactPreventedReason));
@@ -393,6 +497,34 @@ MM_VerboseHandlerOutputStandard::handleCompactEndInternal(MM_EnvironmentBase* en
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
+void
+MM_VerboseHandlerOutputStandard::outputTenurePrediction(MM_EnvironmentBase *env, MM_ScavengerStats *cycleScavengerStats)
+{
+	MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+	MM_ScavengerStats::FlipHistory *current = cycleScavengerStats->getFlipHistory(0);
+	MM_ScavengerStats::FlipHistory *previous = cycleScavengerStats->getFlipHistory(1);
+
+	uintptr_t predictedBytes = 0;
+	uintptr_t actualBytes = 0;
+	for (uintptr_t age = 0; age <= OBJECT_HEADER_AGE_MAX; age++) {
+		predictedBytes += cycleScavengerStats->_predictedLiveBytes[age];
+		actualBytes += current->_flipBytes[age + 1] + current->_tenureBytes[age + 1];
+	}
+
+	writer->formatAndOutput(env, 1, "<tenure-prediction predictedbytes=\"%zu\" actualbytes=\"%zu\">", predictedBytes, actualBytes);
+	for (uintptr_t age = 0; age <= OBJECT_HEADER_AGE_MAX; age++) {
+		uintptr_t population = (0 == age) ? 0 : previous->_flipBytes[age];
+		uintptr_t flipped = current->_flipBytes[age + 1];
+		uintptr_t tenured = current->_tenureBytes[age + 1];
+		uintptr_t predicted = cycleScavengerStats->_predictedLiveBytes[age];
+		if (0 != (population | flipped | tenured | predicted)) {
+			writer->formatAndOutput(env, 2, "<age-survival age=\"%zu\" population=\"%zu\" flipped=\"%zu\" tenured=\"%zu\" predicted=\"%zu\" />",
+					age, population, flipped, tenured, predicted);
+		}
+	}
+	writer->formatAndOutput(env, 1, "</tenure-prediction>");
+}
+
 void
 MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
 {
@@ -414,6 +546,10 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 				cycleScavengerStats->_tenureAge, cycleScavengerStats->getFlipHistory(0)->_tenureMask, cycleScavengerStats->_tiltRatio);
 	}
 
+	if (event->cycleEnd && extensions->scvTenureStrategyPredictive) {
+		outputTenurePrediction(env, cycleScavengerStats);
+	}
+
 	if (0 != scavengerStats->_flipCount) {
 		writer->formatAndOutput(env, 1, "<memory-copied type=\"nursery\" objects=\"%zu\" bytes=\"%zu\" bytesdiscarded=\"%zu\" />",
 				scavengerStats->_flipCount, scavengerStats->_flipBytes, scavengerStats->_flipDiscardBytes);
@@ -422,6 +558,10 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 		writer->formatAndOutput(env, 1, "<memory-copied type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" bytesdiscarded=\"%zu\" />",
 				scavengerStats->_tenureAggregateCount, scavengerStats->_tenureAggregateBytes, scavengerStats->_tenureDiscardBytes);
 	}
+	if (extensions->scavengerNumaAffinity && (0 != (scavengerStats->_numaLocalCopyBytes + scavengerStats->_numaRemoteCopyBytes))) {
+		writer->formatAndOutput(env, 1, "<numa-copy localbytes=\"%zu\" remotebytes=\"%zu\" />",
+				scavengerStats->_numaLocalCopyBytes, scavengerStats->_numaRemoteCopyBytes);
+	}
 	if (0 != scavengerStats->_failedFlipCount) {
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"nursery\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedFlipCount, scavengerStats->_failedFlipBytes);
@@ -604,9 +744,15 @@ MM_VerboseHandlerOutputStandard::handleConcurrentCardCleaningEnd(J9HookInterface
 	enterAtomicReportingBlock();
 	handleGCOPOuterStanzaStart(env, "card-cleaning", env->_cycleState->_verboseContextID, durationUs, true);
 
-	writer->formatAndOutput(
-			env, 1, "<card-cleaning cardsCleaned=\"%zu\" bytesTraced=\"%zu\" workStackOverflowCount=\"%zu\" />",
-			event->finalcleanedCards, event->bytesTraced, event->workStackOverflowCount);
+	if (_extensions->dirtyCardSummary) {
+		writer->formatAndOutput(
+				env, 1, "<card-cleaning cardsCleaned=\"%zu\" cardsSkipped=\"%zu\" bytesTraced=\"%zu\" workStackOverflowCount=\"%zu\" />",
+				event->finalcleanedCards, event->finalSkippedCards, event->bytesTraced, event->workStackOverflowCount);
+	} else {
+		writer->formatAndOutput(
+				env, 1, "<card-cleaning cardsCleaned=\"%zu\" bytesTraced=\"%zu\" workStackOverflowCount=\"%zu\" />",
+				event->finalcleanedCards, event->bytesTraced, event->workStackOverflowCount);
+	}
 
 	handleConcurrentCardCleaningEndInternal(env, eventData);
 
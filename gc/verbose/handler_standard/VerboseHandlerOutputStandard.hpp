@@ -31,10 +31,13 @@
 
 class MM_CollectionStatistics;
 class MM_EnvironmentBase;
+class MM_ScavengerStats;
+struct MM_HeapSizingStats;
 
 class MM_VerboseHandlerOutputStandard : public MM_VerboseHandlerOutput
 {
 private:
+	uintptr_t _heapSizingReportedGCCount; /**< global collection whose heap sizing decision was last reported */
 protected:
 public:
 
@@ -66,6 +69,15 @@ protected:
 	virtual void outputMemoryInfoInnerStanza(MM_EnvironmentBase *env, uintptr_t indent, MM_CollectionStatistics *stats);
 	virtual const char *getSubSpaceType(uintptr_t typeFlags);
 
+	/**
+	 * Answer the heap sizing cost model decision made in this global collection, if it was not reported yet.
+	 * @return the decision, or NULL if there is nothing to report
+	 */
+	MM_HeapSizingStats *getUnreportedHeapSizing();
+	void outputHeapSizing(MM_EnvironmentBase *env, uintptr_t indent, MM_HeapSizingStats *heapSizing);
+	virtual bool hasCycleEndInnerStanzas();
+	virtual void handleCycleEndInnerStanzas(J9HookInterface** hook, uintptr_t eventNum, void* eventData, uintptr_t indentDepth);
+
 	/* Language-extendable internal logic for GC events. */
 	virtual void handleMarkEndInternal(MM_EnvironmentBase* env, void* eventData);
 	virtual void handleSweepEndInternal(MM_EnvironmentBase* env, void* eventData);
@@ -95,6 +107,7 @@ protected:
 
 	MM_VerboseHandlerOutputStandard(MM_GCExtensionsBase *extensions) :
 		MM_VerboseHandlerOutput(extensions)
+		, _heapSizingReportedGCCount(0)
 	{};
 
 public:
@@ -141,6 +154,14 @@ public:
 	void handleScavengeEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
 	void handleScavengeEndNoLock(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
 
+	/**
+	 * Write the survival histogram of the scavenge that just ended, next to what the
+	 * Predictive tenure strategy expected it to find live (-Xgc:scvTenureStrategyPredictive).
+	 * @param env The thread writing the stanza.
+	 * @param cycleScavengerStats The scavenger stats of the cycle.
+	 */
+	void outputTenurePrediction(MM_EnvironmentBase *env, MM_ScavengerStats *cycleScavengerStats);
+
 	/**
 	 * Write verbose stanza for a percolate event.
 	 * @param hook Hook interface used by the JVM.
@@ -237,6 +237,16 @@ struct ModronLnrlOptions {
 #define MMINLINE_DEBUG inline
 #endif /* OMR_OS_WINDOWS */
 
+/* Hint that the memory at address will be read soon; no-op where the compiler offers no prefetch builtin */
+#if defined(__GNUC__) || defined(__clang__)
+#define MM_PREFETCH_FOR_READ(address) __builtin_prefetch((const void *)(address), 0, 3)
+#else /* defined(__GNUC__) || defined(__clang__) */
+#define MM_PREFETCH_FOR_READ(address)
+#endif /* defined(__GNUC__) || defined(__clang__) */
+
+/* Largest number of pending objects (marking) or slots (scavenging) held by -Xgc:scanPrefetchDistance= */
+#define MM_SCAN_PREFETCH_DISTANCE_MAX 16
+
 /**
  * Lightweight Non-Reentrant Locks (LWNR) Spinlock Support
  * We can't use spinlocks on platforms that do not support semaphores.
@@ -423,7 +433,8 @@ typedef enum {
 	SCAV_RATIO_TOO_LOW,
 	HEAP_RESIZE,
 	SATISFY_EXPAND,
-	FORCED_NURSERY_CONTRACT
+	FORCED_NURSERY_CONTRACT,
+	ABOVE_COST_MODEL_TARGET
 } ContractReason;
 
 typedef enum {
@@ -434,7 +445,8 @@ typedef enum {
 	SATISFY_COLLECTOR,
 	EXPAND_DESPERATE,
 	FORCED_NURSERY_EXPAND,
-	HINT_PREVIOUS_RUNS
+	HINT_PREVIOUS_RUNS,
+	BELOW_COST_MODEL_TARGET
 } ExpandReason;
 
 typedef enum {
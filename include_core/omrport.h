@@ -1137,6 +1137,10 @@ typedef struct J9ProcessorInfos {
 #define OMRPORT_VMEM_RESERVE_USED_MMAP_SHM 12
 #define OMRPORT_VMEM_RESERVE_USED_MMAP_RESTORE_MMAP 13
 
+#define OMRPORT_VMEM_PAGE_BACKING_DEFAULT  0
+#define OMRPORT_VMEM_PAGE_BACKING_TRANSPARENT  1
+#define OMRPORT_VMEM_PAGE_BACKING_EXPLICIT  2
+
 #define OMRPORT_ENSURE_CAPACITY_FAILED  0
 #define OMRPORT_ENSURE_CAPACITY_SUCCESS  1
 #define OMRPORT_ENSURE_CAPACITY_NOT_REQUIRED  2
@@ -2083,6 +2087,8 @@ typedef struct OMRPortLibrary {
 	int32_t (*vmem_get_available_physical_memory)(struct OMRPortLibrary *portLibrary, uint64_t *freePhysicalMemorySize);
 	/** see @ref omrvmem.c::omrvmem_get_process_memory_size "omrvmem_get_process_memory_size"*/
 	int32_t (*vmem_get_process_memory_size)(struct OMRPortLibrary *portLibrary, J9VMemMemoryQuery queryType, uint64_t *memorySize);
+	/** see @ref omrvmem.c::omrvmem_back_with_large_pages "omrvmem_back_with_large_pages"*/
+	uintptr_t (*vmem_back_with_large_pages)(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uintptr_t pageSize, struct J9PortVmemIdentifier *identifier);
 	/** see @ref omrstr.c::omrstr_startup "omrstr_startup"*/
 	int32_t (*str_startup)(struct OMRPortLibrary *portLibrary) ;
 	/** see @ref omrstr.c::omrstr_shutdown "omrstr_shutdown"*/
@@ -2868,6 +2874,7 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrvmem_numa_get_node_details(param1,param2) privateOmrPortLibrary->vmem_numa_get_node_details(privateOmrPortLibrary, (param1), (param2))
 #define omrvmem_get_available_physical_memory(param1) privateOmrPortLibrary->vmem_get_available_physical_memory(privateOmrPortLibrary, (param1))
 #define omrvmem_get_process_memory_size(param1,param2) privateOmrPortLibrary->vmem_get_process_memory_size(privateOmrPortLibrary, (param1), (param2))
+#define omrvmem_back_with_large_pages(param1,param2,param3,param4) privateOmrPortLibrary->vmem_back_with_large_pages(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
 #define omrstr_startup() privateOmrPortLibrary->str_startup(privateOmrPortLibrary)
 #define omrstr_shutdown() privateOmrPortLibrary->str_shutdown(privateOmrPortLibrary)
 #define omrstr_printf(...) privateOmrPortLibrary->str_printf(privateOmrPortLibrary, __VA_ARGS__)
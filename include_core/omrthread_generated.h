@@ -290,6 +290,7 @@ typedef struct J9ThreadAbstractMonitor {
 #define J9THREAD_MONITOR_IGNORE_ENTER  0x4000000
 #define J9THREAD_MONITOR_SLOW_ENTER  0x8000000
 #define J9THREAD_MONITOR_TRY_ENTER_SPIN  0x10000000
+#define J9THREAD_MONITOR_FUTEX  0x20000000
 #define J9THREAD_MONITOR_SPINLOCK_UNOWNED  0
 #define J9THREAD_MONITOR_SPINLOCK_OWNED  1
 #define J9THREAD_MONITOR_SPINLOCK_EXCEEDED  2
@@ -389,6 +389,22 @@ omrWildcardMatch(U_32 matchFlag, const char* needle, UDATA needleLength, const c
 
 /* ---------------- omrcrc32.c ---------------- */
 
+/* implementations of omrcrc32, see omrcrc32Init */
+#define OMRCRC32_TABLE 0
+#define OMRCRC32_SLICE_BY_8 1
+#define OMRCRC32_HARDWARE 2
+
+/**
+* @brief Choose how omrcrc32 computes the CRC. Every implementation gives the same result.
+* Until this is called omrcrc32 uses slicing-by-8.
+* @param portLibrary used to detect the processor features
+* @param implementation OMRCRC32_TABLE for a table lookup per byte, OMRCRC32_SLICE_BY_8,
+* or OMRCRC32_HARDWARE for PCLMULQDQ on x86-64 or the CRC32 instructions on AArch64 when
+* the processor has them, falling back to slicing-by-8
+* @return U_32 the implementation chosen
+*/
+U_32 omrcrc32Init(struct OMRPortLibrary *portLibrary, U_32 implementation);
+
 /**
 * @brief
 * @param crc
@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+#if !defined(STACKSAMPLETABLE_H_)
+#define STACKSAMPLETABLE_H_
+
+#include "omrcomp.h"
+#include "omrport.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define OMR_STACK_SAMPLE_MAX_FRAMES 24 /* deepest native stack a sample can hold */
+#define OMR_STACK_SAMPLE_NAME_LENGTH 64 /* longest key name kept, including the terminating NUL */
+#define OMR_STACK_SAMPLE_HASH_CLAIMED 1 /* hash of a sample whose key is being written by the thread that claimed it */
+/* room for the frames and symbols of one stack while it is printed */
+#define OMR_STACK_SAMPLE_PRINT_HEAP_SIZE (OMR_STACK_SAMPLE_MAX_FRAMES * (sizeof(J9PlatformStackFrame) + 640))
+
+/*
+ * The samples aggregated for one (key, native stack) pair.
+ */
+typedef struct OMRStackSample {
+	volatile uintptr_t hash; /* 0 if the sample is unused, OMR_STACK_SAMPLE_HASH_CLAIMED while its key is being written */
+	uintptr_t key;
+	char name[OMR_STACK_SAMPLE_NAME_LENGTH]; /* name of the key when it was first recorded */
+	uintptr_t frameCount;
+	uintptr_t frames[OMR_STACK_SAMPLE_MAX_FRAMES]; /* instruction pointers, innermost first */
+	volatile uintptr_t sampleCount;
+	volatile uint64_t weight; /* sum of the weights recorded, samples are sorted by it */
+	volatile uint64_t maxWeight; /* largest weight recorded */
+	volatile uint64_t extra; /* sum of the extra values recorded */
+} OMRStackSample;
+
+/*
+ * Fixed size open addressed table of samples keyed by (key, native stack), which threads update without locking.
+ * The caller owns the memory of the table and its samples, so that it can use its own allocator.
+ */
+typedef struct OMRStackSampleTable {
+	OMRPortLibrary *portLibrary;
+	uintptr_t size; /* number of samples, a power of two */
+	uintptr_t skipFrames; /* frames at the top of a captured stack which belong to the stack walk */
+	volatile uintptr_t recordedCount; /* records added to a sample */
+	volatile uintptr_t droppedCount; /* records lost because every sample held another pair */
+	OMRStackSample *samples;
+} OMRStackSampleTable;
+
+/*
+ * Set up an empty table and measure the stack walk, so that captured stacks start at the caller of stackSampleTableCapture.
+ * @param table the table to set up
+ * @param portLibrary the port library used to walk and print stacks
+ * @param samples storage for size samples
+ * @param size number of samples, must be a power of two
+ */
+void stackSampleTableInit(OMRStackSampleTable *table, OMRPortLibrary *portLibrary, OMRStackSample *samples, uintptr_t size);
+
+/*
+ * Walk the native stack of the current thread without calling malloc.
+ * @param[out] frames instruction pointers, innermost first, starting with the caller of this function
+ * @return the number of frames stored, 0 where stacks cannot be walked
+ */
+uintptr_t stackSampleTableCapture(OMRStackSampleTable *table, uintptr_t *frames, uintptr_t maxFrames);
+
+/*
+ * Add a record to the sample for its (key, stack) pair, claiming an unused sample if the pair has not been seen before.
+ * @param name copied to the sample when it is claimed, may be NULL
+ * @param frameCount at most OMR_STACK_SAMPLE_MAX_FRAMES
+ * @return TRUE if the record was added, FALSE if the table is full
+ */
+BOOLEAN stackSampleTableRecord(OMRStackSampleTable *table, uintptr_t key, const char *name, uintptr_t *frames, uintptr_t frameCount, uint64_t weight, uint64_t extra);
+
+/*
+ * @return the number of (key, stack) pairs recorded
+ */
+uintptr_t stackSampleTableCount(OMRStackSampleTable *table);
+
+/*
+ * Collect the samples holding records, heaviest first.  Records keep arriving while they are collected,
+ * each sample is read as it is at the time.
+ * @param[out] sorted room for table->size pointers
+ * @return the number of samples stored
+ */
+uintptr_t stackSampleTableSort(OMRStackSampleTable *table, OMRStackSample **sorted);
+
+/*
+ * Print the stack of a sample, one frame per line, resolved to symbols where possible.
+ * @param heapBuffer scratch space of OMR_STACK_SAMPLE_PRINT_HEAP_SIZE bytes, aligned as a uintptr_t
+ */
+void stackSampleTablePrintStack(OMRStackSampleTable *table, intptr_t fd, OMRStackSample *sample, void *heapBuffer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STACKSAMPLETABLE_H_ */
@@ -48,6 +48,10 @@ extern "C" {
 #define J9THREAD_RWMUTEX_FAIL	 	 1
 #define J9THREAD_RWMUTEX_WOULDBLOCK -1
 
+/* flags for omrthread_rwmutex_init */
+#define J9THREAD_RWMUTEX_DEFAULT		0x0
+#define J9THREAD_RWMUTEX_READER_BIASED	0x1 /* readers count themselves in per-thread slots rather than entering the mutex's monitor */
+
 /* Define conversions for units of time used in thrprof.c */
 #define SEC_TO_NANO_CONVERSION_CONSTANT		(1000 * 1000 * 1000)
 #define MICRO_TO_NANO_CONVERSION_CONSTANT	1000
@@ -228,7 +232,7 @@ omrthread_monitor_owned_by_self(omrthread_monitor_t monitor);
 void
 omrthread_lib_enable_cpu_monitor(omrthread_t thread);
 
-/* ---------------- rwmutex.c ---------------- */
+/* ---------------- rwmutex.cpp ---------------- */
 
 /**
 * @struct
@@ -310,6 +314,168 @@ omrthread_rwmutex_init(omrthread_rwmutex_t *handle, uintptr_t flags, const char
 BOOLEAN
 omrthread_rwmutex_is_writelocked(omrthread_rwmutex_t mutex);
 
+/* ---------------- omrthreadcontention.cpp ---------------- */
+
+#define J9THREAD_CONTENTION_MAX_FRAMES 16 /* deepest native stack kept for a sample */
+#define J9THREAD_CONTENTION_NAME_LENGTH 64 /* longest monitor name kept, including the terminating NUL */
+
+struct OMRPortLibrary;
+
+/**
+ * Blocking attributed by the contention profiler to one monitor entered from one call stack.
+ */
+typedef struct J9ThreadContentionSample {
+	omrthread_monitor_t monitor; /* may have been destroyed since the samples were taken */
+	char monitorName[J9THREAD_CONTENTION_NAME_LENGTH];
+	uintptr_t sampleCount; /* sampled enters which blocked */
+	uint64_t blockedTime; /* total time, in nanoseconds, the sampled enters were blocked */
+	uint64_t maxBlockedTime; /* longest time, in nanoseconds, one sampled enter was blocked */
+	uintptr_t frameCount;
+	uintptr_t frames[J9THREAD_CONTENTION_MAX_FRAMES]; /* instruction pointers, innermost first */
+} J9ThreadContentionSample;
+
+/**
+ * @brief Start sampling three-tier monitor enters which have to block.  The samples of earlier runs are discarded.
+ * @param portLibrary port library used to capture stacks
+ * @param sampleInterval sample one in this many contended enters, 1 samples them all
+ * @return J9THREAD_SUCCESS, or J9THREAD_ERR_NOMEMORY if the profiler could not be allocated
+ */
+intptr_t
+omrthread_contention_profiler_start(struct OMRPortLibrary *portLibrary, uintptr_t sampleInterval);
+
+/**
+ * @brief Stop sampling.  The samples taken so far are kept until the profiler is started again.
+ * @return void
+ */
+void
+omrthread_contention_profiler_stop(void);
+
+/**
+ * @brief Copy out the samples taken so far, most blocked time first.
+ * @param[out] samples array to fill
+ * @param[in] maxSamples number of entries in samples
+ * @param[out] contendedCount if not NULL, set to the number of contended enters seen while sampling
+ * @return the number of entries stored in samples
+ */
+uintptr_t
+omrthread_contention_profiler_dump(J9ThreadContentionSample *samples, uintptr_t maxSamples, uintptr_t *contendedCount);
+
+/**
+ * @brief Write the samples taken so far as text, most blocked time first, with the frames resolved to symbols.
+ * @param portLibrary port library used to write the report and resolve symbols
+ * @param fd file to write to, e.g. OMRPORT_TTY_OUT
+ * @return J9THREAD_SUCCESS, or J9THREAD_ERR if the profiler was never started or the report could not be built
+ */
+intptr_t
+omrthread_contention_profiler_report(struct OMRPortLibrary *portLibrary, intptr_t fd);
+
+/* ---------------- omrthreadtaskpool.cpp ---------------- */
+
+/* flags for omrthread_taskpool_create */
+#define J9THREAD_TASKPOOL_DEFAULT		0x0
+#define J9THREAD_TASKPOOL_NUMA_SPREAD	0x1 /* bind the workers to the NUMA nodes in turn, where the platform has them */
+
+/* returned by omrthread_taskgroup_join() if the group was cancelled before all of its tasks ran */
+#define J9THREAD_TASKGROUP_CANCELLED	-1
+
+typedef struct J9ThreadTaskPool *omrthread_taskpool_t;
+typedef struct J9ThreadTaskGroup *omrthread_taskgroup_t;
+
+/**
+ * A task submitted to a group.  It may submit more tasks to the same group, or join other groups.
+ */
+typedef void (*omrthread_task_t)(omrthread_taskgroup_t group, void *userData);
+
+/**
+ * The body of omrthread_taskpool_parallel_for(), run over [start, end).  Returning non-zero cancels the rest of the range.
+ */
+typedef intptr_t (*omrthread_range_task_t)(uintptr_t start, uintptr_t end, void *userData);
+
+/**
+ * @brief Start a pool of worker threads which run tasks, stealing from each other when they run out.
+ * @param[out] handle the new pool
+ * @param[in] workerCount number of worker threads, at least 1
+ * @param[in] flags J9THREAD_TASKPOOL_DEFAULT or J9THREAD_TASKPOOL_NUMA_SPREAD
+ * @param[in] name name given to the worker threads, may be NULL
+ * @return J9THREAD_SUCCESS, J9THREAD_ERR_NOMEMORY, or the error from creating a worker
+ */
+intptr_t
+omrthread_taskpool_create(omrthread_taskpool_t *handle, uintptr_t workerCount, uintptr_t flags, const char *name);
+
+/**
+ * @brief Stop the workers and free the pool.  Every group using the pool must have been joined.
+ * @param[in] pool
+ * @return void
+ */
+void
+omrthread_taskpool_destroy(omrthread_taskpool_t pool);
+
+/**
+ * @brief Run task over [start, end) in pieces of at most grain, splitting the range among the workers, and wait for it.
+ * @param[in] pool
+ * @param[in] start
+ * @param[in] end
+ * @param[in] grain largest piece given to one call of task, at least 1.  If a piece cannot be queued for lack of
+ * memory, the caller runs the rest of its range in one call instead of failing.
+ * @param[in] task
+ * @param[in] userData passed to task
+ * @return J9THREAD_SUCCESS, or J9THREAD_TASKGROUP_CANCELLED if a call of task returned non-zero
+ */
+intptr_t
+omrthread_taskpool_parallel_for(omrthread_taskpool_t pool, uintptr_t start, uintptr_t end, uintptr_t grain, omrthread_range_task_t task, void *userData);
+
+/**
+ * @brief Create a group of tasks which are joined together.
+ * @param[out] handle the new group
+ * @param[in] pool pool which runs the group's tasks
+ * @return J9THREAD_SUCCESS or J9THREAD_ERR_NOMEMORY
+ */
+intptr_t
+omrthread_taskgroup_create(omrthread_taskgroup_t *handle, omrthread_taskpool_t pool);
+
+/**
+ * @brief Free a group which has no tasks left to run.
+ * @param[in] group
+ * @return void
+ */
+void
+omrthread_taskgroup_destroy(omrthread_taskgroup_t group);
+
+/**
+ * @brief Add a task to a group.  A task submitted by a worker goes on that worker's own queue.
+ * @param[in] group
+ * @param[in] task
+ * @param[in] userData passed to task
+ * @return J9THREAD_SUCCESS or J9THREAD_ERR_NOMEMORY
+ */
+intptr_t
+omrthread_taskgroup_submit(omrthread_taskgroup_t group, omrthread_task_t task, void *userData);
+
+/**
+ * @brief Wait until every task of the group has run or been skipped.  The caller runs tasks while it waits.
+ * The group may be used again afterwards, and is no longer cancelled.
+ * @param[in] group
+ * @return J9THREAD_SUCCESS, or J9THREAD_TASKGROUP_CANCELLED if the group was cancelled
+ */
+intptr_t
+omrthread_taskgroup_join(omrthread_taskgroup_t group);
+
+/**
+ * @brief Skip the tasks of the group which have not started yet.  Running tasks may poll omrthread_taskgroup_is_cancelled().
+ * @param[in] group
+ * @return void
+ */
+void
+omrthread_taskgroup_cancel(omrthread_taskgroup_t group);
+
+/**
+ * @brief Check whether the group has been cancelled, so that a long running task can return early.
+ * @param[in] group
+ * @return TRUE if the group has been cancelled since it was last joined
+ */
+BOOLEAN
+omrthread_taskgroup_is_cancelled(omrthread_taskgroup_t group);
+
 /* ---------------- omrthreadpriority.c ---------------- */
 
 /**
@@ -64,6 +64,9 @@ typedef struct J9ThreadMonitor {
 	J9_ABSTRACT_MONITOR_FIELDS
 	J9OSMutex mutex;
 	struct J9Thread *notifyAllWaiting;
+#if defined(OMR_THR_THREE_TIER_LOCKING)
+	volatile uint32_t futexSequence; /* bumped to wake threads parked on a J9THREAD_MONITOR_FUTEX monitor */
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
 } J9ThreadMonitor;
 
 
@@ -117,6 +120,7 @@ typedef struct J9ThreadLibrary {
 	uintptr_t defaultMonitorSpinCount1;
 	uintptr_t defaultMonitorSpinCount2;
 	uintptr_t defaultMonitorSpinCount3;
+	struct J9ThreadContentionProfiler *contentionProfiler;
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
  	uintptr_t maxSpinThreads;
  	uintptr_t maxWakeThreads;
@@ -85,11 +85,19 @@ typedef zos_sem_t OSSEMAPHORE;
 
 #include "thrtypes.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 int linux_pthread_cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *mutex, const struct timespec *abstime);
 intptr_t init_thread_library(void);
 intptr_t set_pthread_priority(pthread_t handle, omrthread_prio_t j9ThreadPriority);
 intptr_t set_pthread_name(pthread_t self, pthread_t thread, const char *name);
 
+#ifdef __cplusplus
+}
+#endif
+
 extern struct J9ThreadLibrary default_library;
 
 /* priority_map */
@@ -373,6 +381,10 @@ extern pthread_condattr_t *defaultCondAttr;
 
 #if defined(OMR_THR_FORK_SUPPORT)
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 intptr_t j9OSMutex_allocAndInit(J9OSMutex *mutex);
 intptr_t j9OSMutex_freeAndDestroy(J9OSMutex mutex);
 intptr_t j9OSMutex_enter(J9OSMutex mutex);
@@ -383,6 +395,10 @@ intptr_t j9OSCond_freeAndDestroy(J9OSCond cond);
 intptr_t j9OSCond_notify(J9OSCond cond);
 intptr_t j9OSCond_notifyAll(J9OSCond cond);
 
+#ifdef __cplusplus
+}
+#endif
+
 #define OMROSCOND_WAIT_IF_TIMEDOUT(cond, mutex, millis, nanos) 							\
 	do {																				\
 		struct timespec ts_;															\
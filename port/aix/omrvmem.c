@@ -1549,3 +1549,10 @@ omrvmem_create_double_mapped_region(struct OMRPortLibrary *portLibrary, void* re
 	portLibrary->error_set_last_error(portLibrary, errno, OMRPORT_ERROR_VMEM_NOT_SUPPORTED);
 	return NULL;
 }
+
+uintptr_t
+omrvmem_back_with_large_pages(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uintptr_t pageSize, struct J9PortVmemIdentifier *identifier)
+{
+	/* mixed page size backing is not supported, the range stays on the page size it was reserved with */
+	return OMRPORT_VMEM_PAGE_BACKING_DEFAULT;
+}
@@ -433,3 +433,27 @@ omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemory
 {
 	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
 }
+
+/**
+ * Back a page aligned sub-range of memory reserved with the default page size with larger pages.
+ * Explicit large pages of pageSize are tried first. When they can not be provided the range is
+ * advised as transparent huge page eligible where the platform supports it, and otherwise left on
+ * default pages.  The contents of the range are discarded.
+ *
+ * Explicitly backed memory is accessible on return and must not be committed or decommitted again
+ * through @ref omrvmem_commit_memory or @ref omrvmem_decommit_memory.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] address The starting address of the range, aligned to pageSize.
+ * @param[in] byteAmount The size of the range, a multiple of pageSize.
+ * @param[in] pageSize The large page size to back the range with.
+ * @param[in] identifier Descriptor for the virtual memory block containing the range.
+ *
+ * @return OMRPORT_VMEM_PAGE_BACKING_EXPLICIT, OMRPORT_VMEM_PAGE_BACKING_TRANSPARENT or OMRPORT_VMEM_PAGE_BACKING_DEFAULT
+ * to describe how the range is now backed.
+ */
+uintptr_t
+omrvmem_back_with_large_pages(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uintptr_t pageSize, struct J9PortVmemIdentifier *identifier)
+{
+	return OMRPORT_VMEM_PAGE_BACKING_DEFAULT;
+}
@@ -729,6 +729,75 @@ omrvmem_decommit_memory(struct OMRPortLibrary *portLibrary, void *address, uintp
 	return result;
 }
 
+uintptr_t
+omrvmem_back_with_large_pages(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uintptr_t pageSize, struct J9PortVmemIdentifier *identifier)
+{
+	uintptr_t result = OMRPORT_VMEM_PAGE_BACKING_DEFAULT;
+
+	Trc_PRT_vmem_omrvmem_back_with_large_pages_Entry(address, byteAmount, pageSize);
+
+#if defined(MAP_ANON) || defined(MAP_ANONYMOUS)
+	/* only private anonymous reservations of default pages can have their backing replaced */
+	if ((OMRPORT_VMEM_RESERVE_USED_MMAP == identifier->allocator)
+		&& (PPG_vmem_pageSize[0] == identifier->pageSize)
+		&& (OMRPORT_INVALID_FD == identifier->fd)
+		&& (0 == (identifier->mode & OMRPORT_VMEM_MEMORY_MODE_SHARE_FILE_OPEN))
+		&& (pageSize > PPG_vmem_pageSize[0])
+		&& (0 != byteAmount)
+		&& (0 == ((uintptr_t)address % pageSize))
+		&& (0 == (byteAmount % pageSize))
+		&& rangeIsValid(identifier, address, byteAmount)
+	) {
+		BOOLEAN isExplicitPageSize = FALSE;
+		BOOLEAN isReserved = TRUE;
+		uintptr_t i = 0;
+
+		for (i = 1; (i < OMRPORT_VMEM_PAGESIZE_COUNT) && (0 != PPG_vmem_pageSize[i]); i++) {
+			if (pageSize == PPG_vmem_pageSize[i]) {
+				isExplicitPageSize = TRUE;
+				break;
+			}
+		}
+
+		if (isExplicitPageSize) {
+			int flags = MAP_FIXED | MAP_HUGETLB;
+			void *mapped = NULL;
+
+			set_flags_for_mmap(&flags);
+			/* Huge pages are populated on first touch and can not be committed through mprotect later,
+			 * so map them with the access the identifier will be committed with. Private hugetlb
+			 * mappings are charged against the pool here, so a short pool fails the mmap rather than
+			 * faulting later.
+			 */
+			mapped = mmap(address, (size_t)byteAmount, get_protectionBits(identifier->mode), flags, -1, 0);
+			if (address == mapped) {
+				result = OMRPORT_VMEM_PAGE_BACKING_EXPLICIT;
+			} else {
+				Trc_PRT_vmem_omrvmem_back_with_large_pages_explicit_failure(errno);
+				if (MAP_FAILED != mapped) {
+					munmap(mapped, (size_t)byteAmount);
+				}
+				/* the failed MAP_FIXED may already have dropped the reservation, put it back */
+				flags = MAP_FIXED | MAP_NORESERVE;
+				set_flags_for_mmap(&flags);
+				isReserved = (address == mmap(address, (size_t)byteAmount, PROT_NONE, flags, -1, 0));
+			}
+		}
+
+		if ((OMRPORT_VMEM_PAGE_BACKING_DEFAULT == result)
+			&& isReserved
+			&& portLibrary->portGlobals->vmemEnableMadvise
+			&& (0 == adviseHugepage(portLibrary, address, byteAmount))
+		) {
+			result = OMRPORT_VMEM_PAGE_BACKING_TRANSPARENT;
+		}
+	}
+#endif /* defined(MAP_ANON) || defined(MAP_ANONYMOUS) */
+
+	Trc_PRT_vmem_omrvmem_back_with_large_pages_Exit(result);
+	return result;
+}
+
 int32_t
 omrvmem_free_memory(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier)
 {
@@ -254,6 +254,9 @@ omrthread_init(omrthread_library_t lib)
 	lib->stack_usage = 0;
 #endif /* defined(OMR_OS_WINDOWS) */
 	lib->flags = 0;
+#if defined(OMR_THR_THREE_TIER_LOCKING)
+	lib->contentionProfiler = NULL;
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
 
 	omrthread_mem_init(lib);
 
@@ -702,6 +705,7 @@ omrthread_shutdown(void)
 #if defined(OMR_PORT_NUMA_SUPPORT)
 	omrthread_numa_shutdown(lib);
 #endif /* OMR_PORT_NUMA_SUPPORT */
+	omrthread_contention_profiler_free(lib);
 	omrthread_attr_destroy(&lib->systemThreadAttr);
 	OMROSMUTEX_DESTROY(lib->tls_mutex);
 	OMROSMUTEX_DESTROY(lib->monitor_mutex);
@@ -2931,6 +2935,13 @@ interrupt_blocked_thread(omrthread_t self, omrthread_t threadToInterrupt)
 
 	monitor = threadToInterrupt->monitor;
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+	if (OMR_ARE_ANY_BITS_SET(monitor->flags, J9THREAD_MONITOR_FUTEX)) {
+		/* the thread is parked on the futex unless it is a notified waiter, which the mutex path below wakes */
+		omrthread_futex_monitor_wake(monitor, TRUE);
+	}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 	if (MONITOR_TRY_LOCK(monitor) == 0) {
 		NOTIFY_WRAPPER(threadToInterrupt);
 	} else {
@@ -3398,7 +3409,9 @@ omrthread_current_stack_free(void)
  * Acquire and initialize a new monitor from the threading library.
  *
  * @param[out] handle pointer to a omrthread_monitor_t to be set to point to the new monitor
- * @param[in] flags initial flag values for the monitor
+ * @param[in] flags initial flag values for the monitor<br>
+ * J9THREAD_MONITOR_FUTEX makes threads which fail to spin for the monitor sleep on a futex instead of the
+ * monitor's mutex, on platforms which support it; elsewhere the flag is ignored.
  * @param[in] name pointer to a C string with a description of how the monitor will be used (may be NULL)<br>
  * If non-NULL, the C string must be valid for the entire life of the monitor
  *
@@ -3732,6 +3745,9 @@ monitor_init(omrthread_monitor_t monitor, uintptr_t flags, omrthread_library_t l
 	/* Default to no sampling. */
 	monitor->flags |= J9THREAD_MONITOR_STOP_SAMPLING;
 #endif /* defined(OMR_THR_ADAPTIVE_SPIN) */
+#if !defined(OMR_THR_FUTEX_MONITORS)
+	monitor->flags &= ~(uintptr_t)J9THREAD_MONITOR_FUTEX;
+#endif /* !defined(OMR_THR_FUTEX_MONITORS) */
 	monitor->userData = 0;
 	monitor->name = NULL;
 	monitor->pinCount = 0;
@@ -3759,6 +3775,7 @@ monitor_init(omrthread_monitor_t monitor, uintptr_t flags, omrthread_library_t l
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
 	monitor->spinThreads = 0;
 #endif /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
+	monitor->futexSequence = 0;
 
 	ASSERT(monitor->spinCount1 != 0);
 	ASSERT(monitor->spinCount2 != 0);
@@ -3988,13 +4005,66 @@ monitor_enter(omrthread_t self, omrthread_monitor_t monitor)
  * @return 0 on success, J9THREAD_INTERRUPTED_MONITOR_ENTER otherwise
  * @todo Get JLM code out of here
  */
+#if defined(OMR_THR_FUTEX_MONITORS)
+/*
+ * Sleep on a J9THREAD_MONITOR_FUTEX monitor's futex until its spinlock can be swapped out.
+ *
+ * The spinlock is taken as J9THREAD_MONITOR_SPINLOCK_EXCEEDED, so the exit which follows always
+ * wakes the next sleeper. A thread which gives up because it was aborted passes on the wake it may
+ * have used up.
+ *
+ * @param[in] self current thread
+ * @param[in] monitor monitor to enter
+ * @param[in] isAbortable SET_ABORTABLE if the enter can be aborted
+ * @return 0 once the spinlock is owned, J9THREAD_INTERRUPTED_MONITOR_ENTER if aborted
+ */
+static intptr_t
+monitor_park_futex(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN isAbortable)
+{
+	BOOLEAN parked = FALSE;
+
+	while (1) {
+		uint32_t sequence = omrthread_futex_monitor_sequence(monitor);
+
+		if (J9THREAD_MONITOR_SPINLOCK_UNOWNED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_EXCEEDED)) {
+			break;
+		}
+
+		if (!parked || (SET_ABORTABLE == isAbortable)) {
+			THREAD_LOCK(self, CALLER_MONITOR_ENTER_THREE_TIER2);
+			if ((SET_ABORTABLE == isAbortable) && OMR_ARE_ANY_BITS_SET(self->flags, J9THREAD_FLAG_ABORTED)) {
+				self->flags &= ~J9THREAD_FLAGM_BLOCKED_ABORTABLE;
+				self->monitor = 0;
+				THREAD_UNLOCK(self);
+				omrthread_futex_monitor_wake(monitor, FALSE);
+				return J9THREAD_INTERRUPTED_MONITOR_ENTER;
+			}
+			if (SET_ABORTABLE == isAbortable) {
+				self->flags |= J9THREAD_FLAGM_BLOCKED_ABORTABLE;
+			} else {
+				self->flags |= J9THREAD_FLAG_BLOCKED;
+			}
+			self->monitor = monitor;
+			THREAD_UNLOCK(self);
+			parked = TRUE;
+		}
+
+		omrthread_futex_monitor_park(monitor, sequence);
+	}
+
+	return 0;
+}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 static intptr_t
 monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN isAbortable)
 {
 	int blockedCount = 0;
+	J9ThreadContentionBlock contentionBlock;
 #if defined(OMR_THR_MCS_LOCKS)
 	omrthread_mcs_node_t mcsNode = omrthread_mcs_node_allocate(self);
 #endif /* defined(OMR_THR_MCS_LOCKS) */
+	contentionBlock.startTime = 0;
 	ASSERT(self);
 	ASSERT(monitor);
 	ASSERT(monitor->spinCount1 != 0);
@@ -4016,6 +4086,24 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 			break;
 		}
 
+		/* sample the enter before it blocks, so the stack walk does not hold the monitor's mutex */
+		if ((0 == blockedCount) && (0 == contentionBlock.startTime) && (NULL != self->library->contentionProfiler)) {
+			omrthread_contention_block_start(self->library, &contentionBlock);
+		}
+
+#if defined(OMR_THR_FUTEX_MONITORS)
+		if (OMR_ARE_ANY_BITS_SET(monitor->flags, J9THREAD_MONITOR_FUTEX)) {
+			if (0 != monitor_park_futex(self, monitor, isAbortable)) {
+				return J9THREAD_INTERRUPTED_MONITOR_ENTER;
+			}
+			blockedCount++;
+			monitor->owner = self;
+			monitor->count = 1;
+			ASSERT(monitor->spinlockState != J9THREAD_MONITOR_SPINLOCK_UNOWNED);
+			break;
+		}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 		MONITOR_LOCK(monitor, CALLER_MONITOR_ENTER_THREE_TIER1);
 
 #if !defined(OMR_THR_MCS_LOCKS)
@@ -4118,6 +4206,10 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 		THREAD_UNLOCK(self);
 	}
 
+	if ((0 != contentionBlock.startTime) && (0 < blockedCount)) {
+		omrthread_contention_block_end(self->library, monitor, &contentionBlock);
+	}
+
 	UPDATE_JLM_MON_ENTER(self, monitor, !IS_RECURSIVE_ENTER, (blockedCount > 0));
 
 	ASSERT(!(self->flags & J9THREAD_FLAG_BLOCKED));
@@ -4150,6 +4242,13 @@ unblock_spinlock_threads(omrthread_t self, omrthread_monitor_t monitor)
 #endif /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
 	ASSERT(monitor);
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+	if (OMR_ARE_ANY_BITS_SET(monitor->flags, J9THREAD_MONITOR_FUTEX)) {
+		/* only notified waiters are queued, threads blocked in enter are parked on the futex */
+		omrthread_futex_monitor_wake(monitor, FALSE);
+	}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 	next = monitor->blocking;
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
 	for (; (NULL != next) && (i > 0); i--)
@@ -4378,9 +4477,20 @@ monitor_exit(omrthread_t self, omrthread_monitor_t monitor)
  		MONITOR_UNLOCK(monitor);
 #else /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
 		if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
-			MONITOR_LOCK(monitor, CALLER_MONITOR_EXIT1);
-			unblock_spinlock_threads(self, monitor);
-			MONITOR_UNLOCK(monitor);
+#if defined(OMR_THR_FUTEX_MONITORS)
+			/*
+			 * Only the owner queues notified waiters, so if none were queued before the spinlock was
+			 * released there is no one waiting on the mutex and the next sleeper can be woken without it.
+			 */
+			if (OMR_ARE_ANY_BITS_SET(monitor->flags, J9THREAD_MONITOR_FUTEX) && (NULL == monitor->blocking)) {
+				omrthread_futex_monitor_wake(monitor, FALSE);
+			} else
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+			{
+				MONITOR_LOCK(monitor, CALLER_MONITOR_EXIT1);
+				unblock_spinlock_threads(self, monitor);
+				MONITOR_UNLOCK(monitor);
+			}
 		}
 #endif /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
 #endif /* defined(OMR_THR_MCS_LOCKS) */
@@ -0,0 +1,245 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Thread
+ * @brief Monitor contention profiler
+ *
+ * Samples three-tier monitor enters which fail to get the spinlock.  A sampled enter captures the native stack of
+ * its caller before it blocks and, once it owns the monitor, adds the time it was blocked to the sample for the
+ * (monitor, stack) pair in an OMRStackSampleTable.
+ */
+
+#include <string.h>
+
+#include "omrport.h"
+#include "stacksampletable.h"
+#include "AtomicSupport.hpp"
+
+#include "threaddef.h"
+#include "thread_internal.h"
+
+#define CONTENTION_TABLE_SIZE 512 /* number of (monitor, stack) pairs the profiler can tell apart, must be a power of two */
+#define NANOSECONDS_PER_SECOND J9CONST_U64(1000000000)
+
+typedef struct J9ThreadContentionProfiler {
+	volatile uintptr_t active;
+	uintptr_t sampleInterval;
+	uint64_t hiresFrequency; /* omrthread_get_hires_clock() ticks per second, 0 if they are already nanoseconds or the frequency is unknown */
+	volatile uintptr_t contendedCount; /* enters which failed to get the spinlock while sampling */
+	OMRStackSampleTable stacks; /* blocked time by (monitor, stack) */
+	OMRStackSample samples[CONTENTION_TABLE_SIZE]; /* storage of stacks */
+} J9ThreadContentionProfiler;
+
+extern "C" {
+
+#if defined(OMR_THR_THREE_TIER_LOCKING)
+
+void
+omrthread_contention_block_start(omrthread_library_t lib, J9ThreadContentionBlock *block)
+{
+	J9ThreadContentionProfiler *profiler = lib->contentionProfiler;
+
+	if (0 != profiler->active) {
+		uintptr_t contended = VM_AtomicSupport::add(&profiler->contendedCount, 1);
+		if (0 == (contended % profiler->sampleInterval)) {
+			block->frameCount = stackSampleTableCapture(&profiler->stacks, block->frames, J9THREAD_CONTENTION_MAX_FRAMES);
+			/* the clock starts after the stack walk, which is not time spent waiting for the monitor */
+			block->startTime = omrthread_get_hires_clock();
+		}
+	}
+}
+
+void
+omrthread_contention_block_end(omrthread_library_t lib, omrthread_monitor_t monitor, J9ThreadContentionBlock *block)
+{
+	J9ThreadContentionProfiler *profiler = lib->contentionProfiler;
+	uint64_t blockedTime = omrthread_get_hires_clock() - block->startTime;
+	uint64_t frequency = profiler->hiresFrequency;
+
+	if (0 != frequency) {
+		/* split the ticks so that the conversion to nanoseconds cannot overflow */
+		blockedTime = ((blockedTime / frequency) * NANOSECONDS_PER_SECOND) + (((blockedTime % frequency) * NANOSECONDS_PER_SECOND) / frequency);
+	}
+	stackSampleTableRecord(&profiler->stacks, (uintptr_t)monitor, omrthread_monitor_get_name(monitor), block->frames, block->frameCount, blockedTime, 0);
+}
+
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
+
+intptr_t
+omrthread_contention_profiler_start(struct OMRPortLibrary *portLibrary, uintptr_t sampleInterval)
+{
+#if defined(OMR_THR_THREE_TIER_LOCKING)
+	omrthread_library_t lib = (omrthread_library_t)GLOBAL_DATA(default_library);
+	J9ThreadContentionProfiler *profiler = lib->contentionProfiler;
+
+	if (NULL == profiler) {
+		profiler = (J9ThreadContentionProfiler *)omrthread_allocate_memory(lib, sizeof(J9ThreadContentionProfiler), OMRMEM_CATEGORY_THREADS);
+		if (NULL == profiler) {
+			return J9THREAD_ERR_NOMEMORY;
+		}
+		memset(profiler, 0, sizeof(J9ThreadContentionProfiler));
+
+		/* blocking threads only look at the profiler once it is set up, and it stays until the library shuts down */
+		VM_AtomicSupport::writeBarrier();
+		if (0 != VM_AtomicSupport::lockCompareExchange((volatile uintptr_t *)&lib->contentionProfiler, 0, (uintptr_t)profiler)) {
+			omrthread_free_memory(lib, profiler);
+			profiler = lib->contentionProfiler;
+		}
+	}
+
+	/* each start discards the samples of earlier runs, an enter sampled before it may still add one record once it unblocks */
+	profiler->active = 0;
+	stackSampleTableInit(&profiler->stacks, portLibrary, profiler->samples, CONTENTION_TABLE_SIZE);
+	profiler->contendedCount = 0;
+	profiler->sampleInterval = OMR_MAX(sampleInterval, 1);
+	profiler->hiresFrequency = omrthread_get_hires_clock_frequency();
+	if (NANOSECONDS_PER_SECOND == profiler->hiresFrequency) {
+		profiler->hiresFrequency = 0;
+	}
+	VM_AtomicSupport::writeBarrier();
+	profiler->active = 1;
+	return J9THREAD_SUCCESS;
+#else /* defined(OMR_THR_THREE_TIER_LOCKING) */
+	return J9THREAD_ERR_UNSUPPORTED_ATTR;
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
+}
+
+void
+omrthread_contention_profiler_stop(void)
+{
+#if defined(OMR_THR_THREE_TIER_LOCKING)
+	omrthread_library_t lib = (omrthread_library_t)GLOBAL_DATA(default_library);
+	if (NULL != lib->contentionProfiler) {
+		lib->contentionProfiler->active = 0;
+	}
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
+}
+
+#if defined(OMR_THR_THREE_TIER_LOCKING)
+/**
+ * Collect the samples of the profiler, most blocked time first.
+ * @return the number of samples stored, or UDATA_MAX if samples could not be allocated
+ */
+static uintptr_t
+sortedSamples(omrthread_library_t lib, OMRStackSample ***samples)
+{
+	*samples = (OMRStackSample **)omrthread_allocate_memory(lib, sizeof(OMRStackSample *) * CONTENTION_TABLE_SIZE, OMRMEM_CATEGORY_THREADS);
+	if (NULL == *samples) {
+		return UDATA_MAX;
+	}
+	return stackSampleTableSort(&lib->contentionProfiler->stacks, *samples);
+}
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
+
+uintptr_t
+omrthread_contention_profiler_dump(J9ThreadContentionSample *samples, uintptr_t maxSamples, uintptr_t *contendedCount)
+{
+	uintptr_t sampleCount = 0;
+	if (NULL != contendedCount) {
+		*contendedCount = 0;
+	}
+
+#if defined(OMR_THR_THREE_TIER_LOCKING)
+	omrthread_library_t lib = (omrthread_library_t)GLOBAL_DATA(default_library);
+	if (NULL != lib->contentionProfiler) {
+		OMRStackSample **sorted = NULL;
+		uintptr_t sortedCount = sortedSamples(lib, &sorted);
+		if (UDATA_MAX != sortedCount) {
+			for (; (sampleCount < sortedCount) && (sampleCount < maxSamples); sampleCount++) {
+				OMRStackSample *stack = sorted[sampleCount];
+				J9ThreadContentionSample *sample = &samples[sampleCount];
+				sample->monitor = (omrthread_monitor_t)stack->key;
+				memcpy(sample->monitorName, stack->name, J9THREAD_CONTENTION_NAME_LENGTH);
+				sample->monitorName[J9THREAD_CONTENTION_NAME_LENGTH - 1] = '\0';
+				sample->sampleCount = stack->sampleCount;
+				sample->blockedTime = stack->weight;
+				sample->maxBlockedTime = stack->maxWeight;
+				sample->frameCount = OMR_MIN(stack->frameCount, J9THREAD_CONTENTION_MAX_FRAMES);
+				memcpy(sample->frames, stack->frames, sample->frameCount * sizeof(uintptr_t));
+			}
+			omrthread_free_memory(lib, sorted);
+		}
+		if (NULL != contendedCount) {
+			*contendedCount = lib->contentionProfiler->contendedCount;
+		}
+	}
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
+
+	return sampleCount;
+}
+
+intptr_t
+omrthread_contention_profiler_report(struct OMRPortLibrary *portLibrary, intptr_t fd)
+{
+	intptr_t result = J9THREAD_ERR;
+
+#if defined(OMR_THR_THREE_TIER_LOCKING)
+	omrthread_library_t lib = (omrthread_library_t)GLOBAL_DATA(default_library);
+	J9ThreadContentionProfiler *profiler = lib->contentionProfiler;
+	if (NULL != profiler) {
+		OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+		OMRStackSample **sorted = NULL;
+		uintptr_t sortedCount = sortedSamples(lib, &sorted);
+		uintptr_t *heapBuffer = (uintptr_t *)omrthread_allocate_memory(lib, OMR_STACK_SAMPLE_PRINT_HEAP_SIZE, OMRMEM_CATEGORY_THREADS);
+
+		if ((UDATA_MAX != sortedCount) && (NULL != heapBuffer)) {
+			omrfile_printf(fd, "Monitor contention: %zu contended enters, sampling 1 in %zu, %zu samples dropped\n",
+					(uintptr_t)profiler->contendedCount, profiler->sampleInterval, (uintptr_t)profiler->stacks.droppedCount);
+
+			for (uintptr_t i = 0; i < sortedCount; i++) {
+				OMRStackSample *stack = sorted[i];
+				uintptr_t sampleCount = stack->sampleCount;
+				uint64_t blockedTime = stack->weight;
+				omrfile_printf(fd, "Stack %zu: monitor \"%s\" (%p), %zu samples, blocked %llu us, mean %llu us, max %llu us\n",
+						i + 1, stack->name, (void *)stack->key, sampleCount, blockedTime / 1000,
+						(blockedTime / sampleCount) / 1000, stack->maxWeight / 1000);
+				stackSampleTablePrintStack(&profiler->stacks, fd, stack, heapBuffer);
+			}
+			result = J9THREAD_SUCCESS;
+		}
+
+		if (NULL != heapBuffer) {
+			omrthread_free_memory(lib, heapBuffer);
+		}
+		if (UDATA_MAX != sortedCount) {
+			omrthread_free_memory(lib, sorted);
+		}
+	}
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
+
+	return result;
+}
+
+void
+omrthread_contention_profiler_free(omrthread_library_t lib)
+{
+#if defined(OMR_THR_THREE_TIER_LOCKING)
+	if (NULL != lib->contentionProfiler) {
+		omrthread_free_memory(lib, lib->contentionProfiler);
+		lib->contentionProfiler = NULL;
+	}
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
+}
+
+} /* extern "C" */
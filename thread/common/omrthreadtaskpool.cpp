@@ -0,0 +1,636 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Thread
+ * @brief Work-stealing task pool
+ *
+ * Each worker owns a bounded Chase-Lev deque: it pushes and pops tasks at the bottom without locking, and
+ * idle workers steal the oldest task from the top with a compare and swap.  Tasks submitted by threads which
+ * are not workers of the pool, and tasks which do not fit in a full deque, go on a shared queue protected by
+ * the pool's monitor.  A worker which finds no work spins briefly and then waits on the monitor; a thread
+ * which makes work available only enters the monitor if a thread is waiting on it.
+ */
+
+#include <string.h>
+
+#include "AtomicSupport.hpp"
+
+#include "threaddef.h"
+#include "thread_internal.h"
+
+#define TASKPOOL_DEQUE_SIZE 256 /* tasks a worker can queue before they overflow to the shared queue, must be a power of two */
+#define TASKPOOL_IDLE_SPINS 32 /* looks for work, with a yield between them, before an idle thread waits */
+#define TASKPOOL_CACHE_LINE 128
+
+typedef struct TaskSlot {
+	omrthread_task_t task;
+	omrthread_range_task_t rangeTask; /* set instead of task for the pieces of a parallel_for */
+	void *userData;
+	struct J9ThreadTaskGroup *group;
+	uintptr_t start; /* range tasks only */
+	uintptr_t end;
+} TaskSlot;
+
+typedef struct SharedTask {
+	struct SharedTask *next;
+	TaskSlot slot;
+} SharedTask;
+
+typedef struct TaskDeque {
+	volatile intptr_t top; /* next task to steal, advanced by compare and swap */
+	uint8_t topPadding[TASKPOOL_CACHE_LINE - sizeof(intptr_t)];
+	volatile intptr_t bottom; /* next free slot, written only by the owner */
+	uint8_t bottomPadding[TASKPOOL_CACHE_LINE - sizeof(intptr_t)];
+	TaskSlot slots[TASKPOOL_DEQUE_SIZE];
+} TaskDeque;
+
+typedef struct TaskWorker {
+	TaskDeque deque;
+	struct J9ThreadTaskPool *pool;
+	omrthread_t thread;
+	uintptr_t numaNode; /* 0 if the worker is not bound to a node */
+	uintptr_t stealSeed;
+} TaskWorker;
+
+typedef struct J9ThreadTaskPool {
+	omrthread_monitor_t monitor; /* protects the shared queue, idle threads wait on it */
+	SharedTask *sharedHead;
+	SharedTask *sharedTail;
+	volatile uintptr_t sharedCount; /* read without the monitor to skip an empty shared queue */
+	volatile uintptr_t idleCount; /* threads waiting on monitor, which must be notified of new work */
+	volatile uintptr_t joinWaiting; /* joiners among them, which must be notified when a group finishes */
+	volatile uintptr_t shutdown;
+	omrthread_tls_key_t workerKey; /* the TaskWorker of the current thread, NULL if it is not a worker of this pool */
+	uintptr_t workerCount;
+	TaskWorker *workers;
+	void *workersMemory;
+} J9ThreadTaskPool;
+
+typedef struct J9ThreadTaskGroup {
+	J9ThreadTaskPool *pool;
+	volatile uintptr_t pending; /* tasks submitted which have not finished */
+	volatile uintptr_t cancelled;
+} J9ThreadTaskGroup;
+
+extern "C" {
+
+static int J9THREAD_PROC workerMain(void *arg);
+
+/**
+ * Push a task on the bottom of the current worker's deque.
+ * @return FALSE if the deque is full
+ */
+static BOOLEAN
+dequePush(TaskDeque *deque, TaskSlot *slot)
+{
+	intptr_t bottom = deque->bottom;
+	intptr_t top = deque->top;
+
+	if ((bottom - top) >= TASKPOOL_DEQUE_SIZE) {
+		return FALSE;
+	}
+	deque->slots[bottom & (TASKPOOL_DEQUE_SIZE - 1)] = *slot;
+	/* the task must be visible before a thief can see the new bottom */
+	VM_AtomicSupport::writeBarrier();
+	deque->bottom = bottom + 1;
+	return TRUE;
+}
+
+/**
+ * Pop the newest task from the bottom of the current worker's deque.
+ * @return FALSE if the deque is empty
+ */
+static BOOLEAN
+dequePop(TaskDeque *deque, TaskSlot *slot)
+{
+	intptr_t bottom = deque->bottom - 1;
+	BOOLEAN found = FALSE;
+
+	deque->bottom = bottom;
+	/* a thief must either see the lower bottom or have taken top before it is read here */
+	VM_AtomicSupport::readWriteBarrier();
+	intptr_t top = deque->top;
+	if (top <= bottom) {
+		*slot = deque->slots[bottom & (TASKPOOL_DEQUE_SIZE - 1)];
+		found = TRUE;
+		if (top == bottom) {
+			/* last task, race the thieves for it */
+			if ((uintptr_t)top != VM_AtomicSupport::lockCompareExchange((volatile uintptr_t *)&deque->top, (uintptr_t)top, (uintptr_t)(top + 1))) {
+				found = FALSE;
+			}
+			deque->bottom = bottom + 1;
+		}
+	} else {
+		deque->bottom = bottom + 1;
+	}
+	return found;
+}
+
+/**
+ * Steal the oldest task from the top of another worker's deque.
+ * @return FALSE if the deque was empty or another thread took the task first
+ */
+static BOOLEAN
+dequeSteal(TaskDeque *deque, TaskSlot *slot)
+{
+	intptr_t top = deque->top;
+	VM_AtomicSupport::readWriteBarrier();
+	intptr_t bottom = deque->bottom;
+
+	if (top < bottom) {
+		VM_AtomicSupport::readBarrier();
+		/* the copy may be torn if the owner or another thief gets there first, in which case the swap fails */
+		*slot = deque->slots[top & (TASKPOOL_DEQUE_SIZE - 1)];
+		if ((uintptr_t)top == VM_AtomicSupport::lockCompareExchange((volatile uintptr_t *)&deque->top, (uintptr_t)top, (uintptr_t)(top + 1))) {
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+/**
+ * Wake a thread waiting for work, if there is one.  Called after a task has been queued.
+ */
+static void
+notifyIdle(J9ThreadTaskPool *pool)
+{
+	/* pairs with the barrier an idle thread issues between counting itself and looking for work */
+	VM_AtomicSupport::readWriteBarrier();
+	if (0 != pool->idleCount) {
+		omrthread_monitor_enter(pool->monitor);
+		if (0 != pool->joinWaiting) {
+			/* a joiner whose group has finished would swallow a single notify without taking the task */
+			omrthread_monitor_notify_all(pool->monitor);
+		} else {
+			omrthread_monitor_notify(pool->monitor);
+		}
+		omrthread_monitor_exit(pool->monitor);
+	}
+}
+
+/**
+ * Queue a task on the current worker's deque or, failing that, on the shared queue.
+ * @param[in] worker the current thread's worker, or NULL if it is not a worker of the pool
+ * @return J9THREAD_SUCCESS or J9THREAD_ERR_NOMEMORY
+ */
+static intptr_t
+queueTask(J9ThreadTaskPool *pool, TaskWorker *worker, TaskSlot *slot)
+{
+	if ((NULL == worker) || !dequePush(&worker->deque, slot)) {
+		omrthread_library_t lib = (omrthread_library_t)GLOBAL_DATA(default_library);
+		SharedTask *shared = (SharedTask *)omrthread_allocate_memory(lib, sizeof(SharedTask), OMRMEM_CATEGORY_THREADS);
+		if (NULL == shared) {
+			return J9THREAD_ERR_NOMEMORY;
+		}
+		shared->next = NULL;
+		shared->slot = *slot;
+		omrthread_monitor_enter(pool->monitor);
+		if (NULL == pool->sharedTail) {
+			pool->sharedHead = shared;
+		} else {
+			pool->sharedTail->next = shared;
+		}
+		pool->sharedTail = shared;
+		pool->sharedCount += 1;
+		omrthread_monitor_exit(pool->monitor);
+	}
+	notifyIdle(pool);
+	return J9THREAD_SUCCESS;
+}
+
+/**
+ * Take the oldest task from the shared queue.
+ * @return FALSE if the queue is empty
+ */
+static BOOLEAN
+takeShared(J9ThreadTaskPool *pool, TaskSlot *slot)
+{
+	SharedTask *shared = NULL;
+
+	if (0 == pool->sharedCount) {
+		return FALSE;
+	}
+	omrthread_monitor_enter(pool->monitor);
+	shared = pool->sharedHead;
+	if (NULL != shared) {
+		pool->sharedHead = shared->next;
+		if (NULL == pool->sharedHead) {
+			pool->sharedTail = NULL;
+		}
+		pool->sharedCount -= 1;
+	}
+	omrthread_monitor_exit(pool->monitor);
+
+	if (NULL == shared) {
+		return FALSE;
+	}
+	*slot = shared->slot;
+	omrthread_free_memory((omrthread_library_t)GLOBAL_DATA(default_library), shared);
+	return TRUE;
+}
+
+/**
+ * Try to steal a task from each worker in turn, starting at a random one.  A worker bound to a NUMA node
+ * tries the workers on its own node first.
+ */
+static BOOLEAN
+stealTask(J9ThreadTaskPool *pool, TaskWorker *worker, TaskSlot *slot)
+{
+	uintptr_t count = pool->workerCount;
+	uintptr_t first = 0;
+	uintptr_t pass = 0;
+
+	if (NULL != worker) {
+		/* xorshift */
+		uintptr_t seed = worker->stealSeed;
+		seed ^= seed << 13;
+		seed ^= seed >> 7;
+		seed ^= seed << 17;
+		worker->stealSeed = seed;
+		first = seed % count;
+		pass = (0 == worker->numaNode) ? 1 : 0;
+	} else {
+		pass = 1;
+	}
+
+	for (; pass < 2; pass++) {
+		for (uintptr_t i = 0; i < count; i++) {
+			TaskWorker *victim = &pool->workers[(first + i) % count];
+			if (victim == worker) {
+				continue;
+			}
+			if ((0 == pass) && (victim->numaNode != worker->numaNode)) {
+				continue;
+			}
+			if (dequeSteal(&victim->deque, slot)) {
+				return TRUE;
+			}
+		}
+	}
+	return FALSE;
+}
+
+/**
+ * Find a task for the current thread: its own newest task, then one from the shared queue, then a stolen one.
+ */
+static BOOLEAN
+findTask(J9ThreadTaskPool *pool, TaskWorker *worker, TaskSlot *slot)
+{
+	if ((NULL != worker) && dequePop(&worker->deque, slot)) {
+		return TRUE;
+	}
+	return takeShared(pool, slot) || stealTask(pool, worker, slot);
+}
+
+/**
+ * Count a task of the group as finished, waking the joiners when it was the last one.  The group may be
+ * freed by its joiner as soon as pending reaches 0, so it is not touched after that.
+ */
+static void
+finishTask(J9ThreadTaskGroup *group)
+{
+	J9ThreadTaskPool *pool = group->pool;
+
+	if (0 == VM_AtomicSupport::subtract(&group->pending, 1)) {
+		/* pairs with the barrier a joiner issues between counting itself in joinWaiting and checking pending */
+		VM_AtomicSupport::readWriteBarrier();
+		if (0 != pool->joinWaiting) {
+			omrthread_monitor_enter(pool->monitor);
+			omrthread_monitor_notify_all(pool->monitor);
+			omrthread_monitor_exit(pool->monitor);
+		}
+	}
+}
+
+/**
+ * Run a task, unless its group has been cancelled.  A piece of a parallel_for is split first, queueing
+ * its upper halves, until what is left fits in the grain; userData then points at the grain and the
+ * caller's data.
+ */
+static void
+runTask(J9ThreadTaskPool *pool, TaskWorker *worker, TaskSlot *slot)
+{
+	J9ThreadTaskGroup *group = slot->group;
+
+	if (0 == group->cancelled) {
+		if (NULL != slot->rangeTask) {
+			uintptr_t grain = ((uintptr_t *)slot->userData)[0];
+			uintptr_t start = slot->start;
+			uintptr_t end = slot->end;
+
+			/* hand the upper halves to other workers until what is left fits in the grain */
+			while (((end - start) > grain) && (0 == group->cancelled)) {
+				TaskSlot upper = *slot;
+				uintptr_t middle = start + ((end - start) / 2);
+				upper.start = middle;
+				upper.end = end;
+				VM_AtomicSupport::add(&group->pending, 1);
+				if (J9THREAD_SUCCESS != queueTask(pool, worker, &upper)) {
+					/* run the whole remainder here instead */
+					VM_AtomicSupport::subtract(&group->pending, 1);
+					break;
+				}
+				end = middle;
+			}
+			if (0 == group->cancelled) {
+				void *rangeData = (void *)((uintptr_t *)slot->userData)[1];
+				if (0 != slot->rangeTask(start, end, rangeData)) {
+					group->cancelled = 1;
+				}
+			}
+		} else {
+			slot->task(group, slot->userData);
+		}
+	}
+	finishTask(group);
+}
+
+/**
+ * Wait on the pool's monitor until there may be work, the group is done, or the pool is shutting down.
+ * @param[in] group group being joined, or NULL when called by an idle worker
+ * @return TRUE if slot was filled with a task to run
+ */
+static BOOLEAN
+waitForTask(J9ThreadTaskPool *pool, TaskWorker *worker, J9ThreadTaskGroup *group, TaskSlot *slot)
+{
+	BOOLEAN found = FALSE;
+
+	for (uintptr_t spin = 0; spin < TASKPOOL_IDLE_SPINS; spin++) {
+		if (findTask(pool, worker, slot)) {
+			return TRUE;
+		}
+		if ((0 != pool->shutdown) || ((NULL != group) && (0 == group->pending))) {
+			return FALSE;
+		}
+		omrthread_yield();
+	}
+
+	omrthread_monitor_enter(pool->monitor);
+	pool->idleCount += 1;
+	if (NULL != group) {
+		pool->joinWaiting += 1;
+	}
+	/* pairs with the barriers in notifyIdle() and finishTask() */
+	VM_AtomicSupport::readWriteBarrier();
+	found = findTask(pool, worker, slot);
+	if (!found && (0 == pool->shutdown) && ((NULL == group) || (0 != group->pending))) {
+		omrthread_monitor_wait(pool->monitor);
+	}
+	if (NULL != group) {
+		pool->joinWaiting -= 1;
+	}
+	pool->idleCount -= 1;
+	omrthread_monitor_exit(pool->monitor);
+
+	return found;
+}
+
+static int J9THREAD_PROC
+workerMain(void *arg)
+{
+	TaskWorker *worker = (TaskWorker *)arg;
+	J9ThreadTaskPool *pool = worker->pool;
+	omrthread_t self = omrthread_self();
+	TaskSlot slot;
+
+	omrthread_tls_set(self, pool->workerKey, worker);
+	if (0 != worker->numaNode) {
+		omrthread_numa_set_node_affinity(self, &worker->numaNode, 1, 0);
+	}
+
+	while (0 == pool->shutdown) {
+		if (findTask(pool, worker, &slot) || waitForTask(pool, worker, NULL, &slot)) {
+			runTask(pool, worker, &slot);
+		}
+	}
+	return 0;
+}
+
+intptr_t
+omrthread_taskpool_create(omrthread_taskpool_t *handle, uintptr_t workerCount, uintptr_t flags, const char *name)
+{
+	omrthread_library_t lib = (omrthread_library_t)GLOBAL_DATA(default_library);
+	J9ThreadTaskPool *pool = NULL;
+	omrthread_attr_t attr = NULL;
+	uintptr_t maxNode = 0;
+	intptr_t rc = J9THREAD_SUCCESS;
+
+	ASSERT(NULL != handle);
+	ASSERT(0 != workerCount);
+
+	pool = (J9ThreadTaskPool *)omrthread_allocate_memory(lib, sizeof(J9ThreadTaskPool), OMRMEM_CATEGORY_THREADS);
+	if (NULL == pool) {
+		return J9THREAD_ERR_NOMEMORY;
+	}
+	memset(pool, 0, sizeof(J9ThreadTaskPool));
+	pool->workerCount = workerCount;
+	pool->workersMemory = omrthread_allocate_memory(lib, (workerCount * sizeof(TaskWorker)) + TASKPOOL_CACHE_LINE - 1, OMRMEM_CATEGORY_THREADS);
+	if (NULL == pool->workersMemory) {
+		omrthread_free_memory(lib, pool);
+		return J9THREAD_ERR_NOMEMORY;
+	}
+	pool->workers = (TaskWorker *)(((uintptr_t)pool->workersMemory + TASKPOOL_CACHE_LINE - 1) & ~(uintptr_t)(TASKPOOL_CACHE_LINE - 1));
+	memset(pool->workers, 0, workerCount * sizeof(TaskWorker));
+
+	if (0 != omrthread_tls_alloc(&pool->workerKey)) {
+		omrthread_free_memory(lib, pool->workersMemory);
+		omrthread_free_memory(lib, pool);
+		return J9THREAD_ERR;
+	}
+	if (0 != omrthread_monitor_init_with_name(&pool->monitor, 0, "omrthread task pool")) {
+		omrthread_tls_free(pool->workerKey);
+		omrthread_free_memory(lib, pool->workersMemory);
+		omrthread_free_memory(lib, pool);
+		return J9THREAD_ERR;
+	}
+
+	if (J9THREAD_TASKPOOL_NUMA_SPREAD == (flags & J9THREAD_TASKPOOL_NUMA_SPREAD)) {
+		maxNode = omrthread_numa_get_max_node();
+	}
+
+	rc = omrthread_attr_init(&attr);
+	if (J9THREAD_SUCCESS == rc) {
+		omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE);
+		if (NULL != name) {
+			omrthread_attr_set_name(&attr, name);
+		}
+		for (uintptr_t i = 0; i < workerCount; i++) {
+			TaskWorker *worker = &pool->workers[i];
+			worker->pool = pool;
+			/* NUMA nodes are numbered from 1 */
+			worker->numaNode = (0 == maxNode) ? 0 : ((i % maxNode) + 1);
+			worker->stealSeed = (i + 1) * (uintptr_t)2654435769U;
+			rc = omrthread_create_ex(&worker->thread, &attr, 0, workerMain, worker);
+			if (J9THREAD_SUCCESS != rc) {
+				worker->thread = NULL;
+				break;
+			}
+		}
+		omrthread_attr_destroy(&attr);
+	}
+
+	if (J9THREAD_SUCCESS != rc) {
+		omrthread_taskpool_destroy(pool);
+		return rc;
+	}
+	*handle = pool;
+	return J9THREAD_SUCCESS;
+}
+
+void
+omrthread_taskpool_destroy(omrthread_taskpool_t pool)
+{
+	omrthread_library_t lib = (omrthread_library_t)GLOBAL_DATA(default_library);
+
+	omrthread_monitor_enter(pool->monitor);
+	pool->shutdown = 1;
+	omrthread_monitor_notify_all(pool->monitor);
+	omrthread_monitor_exit(pool->monitor);
+
+	for (uintptr_t i = 0; i < pool->workerCount; i++) {
+		if (NULL != pool->workers[i].thread) {
+			omrthread_join(pool->workers[i].thread);
+		}
+	}
+
+	ASSERT(NULL == pool->sharedHead);
+	omrthread_monitor_destroy(pool->monitor);
+	omrthread_tls_free(pool->workerKey);
+	omrthread_free_memory(lib, pool->workersMemory);
+	omrthread_free_memory(lib, pool);
+}
+
+intptr_t
+omrthread_taskgroup_create(omrthread_taskgroup_t *handle, omrthread_taskpool_t pool)
+{
+	omrthread_library_t lib = (omrthread_library_t)GLOBAL_DATA(default_library);
+	J9ThreadTaskGroup *group = (J9ThreadTaskGroup *)omrthread_allocate_memory(lib, sizeof(J9ThreadTaskGroup), OMRMEM_CATEGORY_THREADS);
+
+	if (NULL == group) {
+		return J9THREAD_ERR_NOMEMORY;
+	}
+	group->pool = pool;
+	group->pending = 0;
+	group->cancelled = 0;
+	*handle = group;
+	return J9THREAD_SUCCESS;
+}
+
+void
+omrthread_taskgroup_destroy(omrthread_taskgroup_t group)
+{
+	ASSERT(0 == group->pending);
+	omrthread_free_memory((omrthread_library_t)GLOBAL_DATA(default_library), group);
+}
+
+intptr_t
+omrthread_taskgroup_submit(omrthread_taskgroup_t group, omrthread_task_t task, void *userData)
+{
+	J9ThreadTaskPool *pool = group->pool;
+	TaskWorker *worker = (TaskWorker *)omrthread_tls_get(omrthread_self(), pool->workerKey);
+	TaskSlot slot;
+	intptr_t rc = J9THREAD_SUCCESS;
+
+	slot.task = task;
+	slot.rangeTask = NULL;
+	slot.userData = userData;
+	slot.group = group;
+	slot.start = 0;
+	slot.end = 0;
+
+	VM_AtomicSupport::add(&group->pending, 1);
+	rc = queueTask(pool, worker, &slot);
+	if (J9THREAD_SUCCESS != rc) {
+		finishTask(group);
+	}
+	return rc;
+}
+
+intptr_t
+omrthread_taskgroup_join(omrthread_taskgroup_t group)
+{
+	J9ThreadTaskPool *pool = group->pool;
+	TaskWorker *worker = (TaskWorker *)omrthread_tls_get(omrthread_self(), pool->workerKey);
+	TaskSlot slot;
+	intptr_t rc = J9THREAD_SUCCESS;
+
+	while (0 != group->pending) {
+		if (findTask(pool, worker, &slot) || waitForTask(pool, worker, group, &slot)) {
+			runTask(pool, worker, &slot);
+		}
+	}
+	/* the tasks' writes must be visible to the joiner */
+	VM_AtomicSupport::readBarrier();
+
+	if (0 != group->cancelled) {
+		group->cancelled = 0;
+		rc = J9THREAD_TASKGROUP_CANCELLED;
+	}
+	return rc;
+}
+
+void
+omrthread_taskgroup_cancel(omrthread_taskgroup_t group)
+{
+	group->cancelled = 1;
+}
+
+BOOLEAN
+omrthread_taskgroup_is_cancelled(omrthread_taskgroup_t group)
+{
+	return (0 != group->cancelled) ? TRUE : FALSE;
+}
+
+intptr_t
+omrthread_taskpool_parallel_for(omrthread_taskpool_t pool, uintptr_t start, uintptr_t end, uintptr_t grain, omrthread_range_task_t task, void *userData)
+{
+	J9ThreadTaskGroup group;
+	/* every piece shares the grain and the caller's data */
+	uintptr_t rangeData[2];
+	TaskSlot slot;
+
+	ASSERT(0 != grain);
+	if (start >= end) {
+		return J9THREAD_SUCCESS;
+	}
+
+	group.pool = pool;
+	group.pending = 1;
+	group.cancelled = 0;
+	rangeData[0] = grain;
+	rangeData[1] = (uintptr_t)userData;
+
+	slot.task = NULL;
+	slot.rangeTask = task;
+	slot.userData = rangeData;
+	slot.group = &group;
+	slot.start = start;
+	slot.end = end;
+
+	/* the caller splits the range itself, then helps with the pieces until they are all done */
+	runTask(pool, (TaskWorker *)omrthread_tls_get(omrthread_self(), pool->workerKey), &slot);
+	return omrthread_taskgroup_join(&group);
+}
+
+} /* extern "C" */
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -22,16 +22,40 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+
+#include "AtomicSupport.hpp"
+
 #include "threaddef.h"
 #include "thread_internal.h"
 
 #undef  ASSERT
 #define ASSERT(x) /**/
 
+/*
+ * A mutex created with J9THREAD_RWMUTEX_READER_BIASED keeps its readers out of syncMon.  Each reader
+ * counts itself in one of RWMUTEX_READER_SLOT_COUNT slots, chosen by hashing its omrthread_t, so
+ * readers on different CPUs touch different cache lines.  A writer sets writerPending under syncMon
+ * and waits for every slot to drain; a reader that finds writerPending set after counting itself backs
+ * out and waits on syncMon until the writers are done.  status only counts (recursive) writer entries.
+ */
+#define RWMUTEX_READER_SLOT_SHIFT 6
+#define RWMUTEX_READER_SLOT_COUNT ((uintptr_t)1 << RWMUTEX_READER_SLOT_SHIFT)
+#define RWMUTEX_READER_SLOT_BYTES 128
+
+typedef struct RWMutexReaderSlot {
+	volatile uintptr_t readers;
+	uint8_t padding[RWMUTEX_READER_SLOT_BYTES - sizeof(uintptr_t)];
+} RWMutexReaderSlot;
+
 typedef struct RWMutex {
 	omrthread_monitor_t syncMon;
 	intptr_t status;
 	omrthread_t writer;
+	uintptr_t flags;
+	volatile uintptr_t writerPending; /* reader-biased only: non-zero while a writer holds or waits for the mutex */
+	uintptr_t waitingWriters; /* reader-biased only: writers waiting in enter_write, protected by syncMon */
+	RWMutexReaderSlot *readerSlots; /* reader-biased only: cache line aligned reader counts, NULL otherwise */
+	void *readerSlotsMemory;
 } RWMutex;
 
 #define ASSERT_RWMUTEX(m)\
@@ -41,12 +65,135 @@ typedef struct RWMutex {
 #define RWMUTEX_STATUS_IDLE(m)     ((m)->status == 0)
 #define RWMUTEX_STATUS_READING(m)  ((m)->status > 0)
 #define RWMUTEX_STATUS_WRITING(m)  ((m)->status < 0)
+#define RWMUTEX_READER_BIASED(m)   (NULL != (m)->readerSlots)
+
+/**
+ * Find the reader slot used by a thread.  The same thread always maps to the same slot.
+ */
+static RWMutexReaderSlot *
+readerSlot(RWMutex *mutex, omrthread_t self)
+{
+	uint32_t hash = (uint32_t)((uintptr_t)self >> 4) * (uint32_t)2654435769U;
+	return &mutex->readerSlots[hash >> (32 - RWMUTEX_READER_SLOT_SHIFT)];
+}
+
+/**
+ * @return TRUE if no reader is counted in any slot of a reader-biased mutex
+ */
+static BOOLEAN
+readersDrained(RWMutex *mutex)
+{
+	for (uintptr_t i = 0; i < RWMUTEX_READER_SLOT_COUNT; i++) {
+		if (0 != mutex->readerSlots[i].readers) {
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+/**
+ * Remove a reader from its slot, waking writers waiting for the slots to drain.
+ * The barrier pairs with the one in enterWriteBiased(): either the writer sees
+ * the slot go to zero, or the reader sees writerPending and notifies it.
+ */
+static void
+leaveReaderSlot(RWMutex *mutex, RWMutexReaderSlot *slot)
+{
+	uintptr_t readers = VM_AtomicSupport::subtract(&slot->readers, 1);
+	VM_AtomicSupport::readWriteBarrier();
+	if ((0 == readers) && (0 != mutex->writerPending)) {
+		omrthread_monitor_enter(mutex->syncMon);
+		omrthread_monitor_notify_all(mutex->syncMon);
+		omrthread_monitor_exit(mutex->syncMon);
+	}
+}
+
+static intptr_t
+enterReadBiased(RWMutex *mutex, omrthread_t self)
+{
+	RWMutexReaderSlot *slot = readerSlot(mutex, self);
+
+	VM_AtomicSupport::add(&slot->readers, 1);
+	VM_AtomicSupport::readWriteBarrier();
+	if (0 == mutex->writerPending) {
+		return J9THREAD_RWMUTEX_OK;
+	}
+
+	/* a writer holds or wants the mutex: back out and wait for it */
+	leaveReaderSlot(mutex, slot);
+	omrthread_monitor_enter(mutex->syncMon);
+	/* Writers waiting for the slots to drain go first, unless this thread's slot is still counted.
+	 * The thread may already hold the mutex for read, and making it wait would deadlock it with the writer.
+	 */
+	while (RWMUTEX_STATUS_WRITING(mutex) || ((0 != mutex->writerPending) && (0 == slot->readers))) {
+		omrthread_monitor_wait(mutex->syncMon);
+	}
+	VM_AtomicSupport::add(&slot->readers, 1);
+	omrthread_monitor_exit(mutex->syncMon);
+
+	return J9THREAD_RWMUTEX_OK;
+}
+
+static intptr_t
+enterWriteBiased(RWMutex *mutex, omrthread_t self)
+{
+	omrthread_monitor_enter(mutex->syncMon);
+
+	/* stop new readers taking the fast path, then wait for the ones already counted to leave */
+	mutex->waitingWriters += 1;
+	mutex->writerPending = 1;
+	VM_AtomicSupport::readWriteBarrier();
+	while (!RWMUTEX_STATUS_IDLE(mutex) || !readersDrained(mutex)) {
+		omrthread_monitor_wait(mutex->syncMon);
+	}
+	mutex->waitingWriters -= 1;
+	mutex->status--;
+	mutex->writer = self;
+
+	omrthread_monitor_exit(mutex->syncMon);
+
+	return J9THREAD_RWMUTEX_OK;
+}
+
+static intptr_t
+tryEnterWriteBiased(RWMutex *mutex, omrthread_t self)
+{
+	intptr_t ret = J9THREAD_RWMUTEX_OK;
+
+	omrthread_monitor_enter(mutex->syncMon);
+	if (!RWMUTEX_STATUS_IDLE(mutex)) {
+		ret = J9THREAD_RWMUTEX_WOULDBLOCK;
+	} else {
+		mutex->writerPending = 1;
+		VM_AtomicSupport::readWriteBarrier();
+		if (readersDrained(mutex)) {
+			mutex->status--;
+			mutex->writer = self;
+		} else {
+			if (0 == mutex->waitingWriters) {
+				/* let through the readers which backed out on seeing writerPending */
+				mutex->writerPending = 0;
+				omrthread_monitor_notify_all(mutex->syncMon);
+			}
+			ret = J9THREAD_RWMUTEX_WOULDBLOCK;
+		}
+	}
+	omrthread_monitor_exit(mutex->syncMon);
+
+	return ret;
+}
 
 /**
  * Acquire and initialize a new read/write mutex from the threading library.
  *
+ * With J9THREAD_RWMUTEX_READER_BIASED in flags, readers do not enter the mutex's
+ * monitor unless a writer holds or waits for the mutex.  Writers are preferred
+ * over new readers and must wait for every reader to leave, so this suits mutexes
+ * which are read very often and written rarely.
+ *
  * @param[out] handle pointer to a omrthread_rwmutex_t to be set to point to the new mutex
  * @param[in] flags initial flag values for the mutex
+ * @param[in] name the name of the mutex's monitor
  * @return J9THREAD_RWMUTEX_OK on success
  *
  * @see omrthread_rwmutex_destroy
@@ -54,7 +201,7 @@ typedef struct RWMutex {
 intptr_t
 omrthread_rwmutex_init(omrthread_rwmutex_t *handle, uintptr_t flags, const char *name)
 {
-	omrthread_library_t lib = GLOBAL_DATA(default_library);
+	omrthread_library_t lib = (omrthread_library_t)GLOBAL_DATA(default_library);
 	intptr_t ret = J9THREAD_RWMUTEX_OK;
 	RWMutex *mutex = NULL;
 
@@ -69,9 +216,33 @@ omrthread_rwmutex_init(omrthread_rwmutex_t *handle, uintptr_t flags, const char
 	if (NULL == mutex) {
 		ret = J9THREAD_RWMUTEX_FAIL;
 	} else {
-		omrthread_monitor_init_with_name(&mutex->syncMon, 0, (char *)name);
 		mutex->status = 0;
 		mutex->writer = 0;
+		mutex->flags = flags;
+		mutex->writerPending = 0;
+		mutex->waitingWriters = 0;
+		mutex->readerSlots = NULL;
+		mutex->readerSlotsMemory = NULL;
+
+		if (J9THREAD_RWMUTEX_READER_BIASED == (flags & J9THREAD_RWMUTEX_READER_BIASED)) {
+			uintptr_t slotsSize = RWMUTEX_READER_SLOT_COUNT * sizeof(RWMutexReaderSlot);
+			mutex->readerSlotsMemory = omrthread_allocate_memory(lib, slotsSize + RWMUTEX_READER_SLOT_BYTES - 1, OMRMEM_CATEGORY_THREADS);
+			if (NULL == mutex->readerSlotsMemory) {
+#if defined(OMR_THR_FORK_SUPPORT)
+				GLOBAL_LOCK_SIMPLE(lib);
+				pool_removeElement(lib->rwmutexPool, mutex);
+				GLOBAL_UNLOCK_SIMPLE(lib);
+#else /* defined(OMR_THR_FORK_SUPPORT) */
+				omrthread_free_memory(lib, mutex);
+#endif /* defined(OMR_THR_FORK_SUPPORT) */
+				return J9THREAD_RWMUTEX_FAIL;
+			}
+			uintptr_t slotsBase = ((uintptr_t)mutex->readerSlotsMemory + RWMUTEX_READER_SLOT_BYTES - 1) & ~(uintptr_t)(RWMUTEX_READER_SLOT_BYTES - 1);
+			mutex->readerSlots = (RWMutexReaderSlot *)slotsBase;
+			memset(mutex->readerSlots, 0, slotsSize);
+		}
+
+		omrthread_monitor_init_with_name(&mutex->syncMon, 0, (char *)name);
 
 		ASSERT(handle);
 		*handle = mutex;
@@ -97,12 +268,15 @@ omrthread_rwmutex_init(omrthread_rwmutex_t *handle, uintptr_t flags, const char
 intptr_t
 omrthread_rwmutex_destroy(omrthread_rwmutex_t mutex)
 {
-	omrthread_library_t lib = GLOBAL_DATA(default_library);
+	omrthread_library_t lib = (omrthread_library_t)GLOBAL_DATA(default_library);
 	ASSERT(mutex);
 	ASSERT(mutex->syncMon);
 	ASSERT(0 == mutex->status);
 	ASSERT(0 == mutex->writer);
 	omrthread_monitor_destroy(mutex->syncMon);
+	if (NULL != mutex->readerSlotsMemory) {
+		omrthread_free_memory(lib, mutex->readerSlotsMemory);
+	}
 #if defined(OMR_THR_FORK_SUPPORT)
 	ASSERT(0 != lib->rwmutexPool);
 	GLOBAL_LOCK_SIMPLE(lib);
@@ -142,11 +316,16 @@ omrthread_rwmutex_destroy(omrthread_rwmutex_t mutex)
 intptr_t
 omrthread_rwmutex_enter_read(omrthread_rwmutex_t mutex)
 {
+	omrthread_t self = omrthread_self();
 	ASSERT_RWMUTEX(mutex);
-	if (mutex->writer == omrthread_self()) {
+	if (mutex->writer == self) {
 		return J9THREAD_RWMUTEX_OK;
 	}
 
+	if (RWMUTEX_READER_BIASED(mutex)) {
+		return enterReadBiased(mutex, self);
+	}
+
 	omrthread_monitor_enter(mutex->syncMon);
 
 	while (mutex->status < 0) {
@@ -170,8 +349,14 @@ omrthread_rwmutex_enter_read(omrthread_rwmutex_t mutex)
 intptr_t
 omrthread_rwmutex_exit_read(omrthread_rwmutex_t mutex)
 {
+	omrthread_t self = omrthread_self();
 	ASSERT_RWMUTEX(mutex);
-	if (mutex->writer == omrthread_self()) {
+	if (mutex->writer == self) {
+		return J9THREAD_RWMUTEX_OK;
+	}
+
+	if (RWMUTEX_READER_BIASED(mutex)) {
+		leaveReaderSlot(mutex, readerSlot(mutex, self));
 		return J9THREAD_RWMUTEX_OK;
 	}
 
@@ -224,6 +409,10 @@ omrthread_rwmutex_enter_write(omrthread_rwmutex_t mutex)
 		return J9THREAD_RWMUTEX_OK;
 	}
 
+	if (RWMUTEX_READER_BIASED(mutex)) {
+		return enterWriteBiased(mutex, self);
+	}
+
 	omrthread_monitor_enter(mutex->syncMon);
 
 	while (mutex->status != 0) {
@@ -262,6 +451,10 @@ omrthread_rwmutex_try_enter_write(omrthread_rwmutex_t mutex)
 		return J9THREAD_RWMUTEX_OK;
 	}
 
+	if (RWMUTEX_READER_BIASED(mutex)) {
+		return tryEnterWriteBiased(mutex, self);
+	}
+
 	omrthread_monitor_enter(mutex->syncMon);
 	if (mutex->status != 0) {
 		/* must get out */
@@ -299,6 +492,9 @@ omrthread_rwmutex_exit_write(omrthread_rwmutex_t mutex)
 	mutex->status++;
 	if (0 == mutex->status) {
 		mutex->writer = NULL;
+		if (0 == mutex->waitingWriters) {
+			mutex->writerPending = 0;
+		}
 		omrthread_monitor_notify_all(mutex->syncMon);
 	}
 
@@ -330,10 +526,12 @@ omrthread_rwmutex_is_writelocked(omrthread_rwmutex_t mutex)
 void
 omrthread_rwmutex_reset(omrthread_rwmutex_t rwmutex, omrthread_t self)
 {
-	if (RWMUTEX_STATUS_READING(rwmutex)) {
+	if (RWMUTEX_STATUS_READING(rwmutex) || (RWMUTEX_READER_BIASED(rwmutex) && !readersDrained(rwmutex))) {
 		fprintf(stderr, "ERROR: found read-locked rwmutex during post-fork reset!\n");
 		abort();
 	}
+	/* writers waiting in the parent do not exist in the child */
+	rwmutex->waitingWriters = 0;
 	if (rwmutex->writer != self) {
 		/* If another thread was writing or reading and the current thread is not blocked,
 		 * reset it. If current thread is writer, it stays writer. The syncMon is reset
@@ -341,6 +539,7 @@ omrthread_rwmutex_reset(omrthread_rwmutex_t rwmutex, omrthread_t self)
 		 */
 		rwmutex->writer = NULL;
 		rwmutex->status = 0;
+		rwmutex->writerPending = 0;
 	}
 }
 
@@ -40,6 +40,11 @@
 #include "omrpool.h"
 #endif /* defined(OMR_THR_FORK_SUPPORT) */
 
+/* J9THREAD_MONITOR_FUTEX is honoured only where the kernel provides futexes and the monitor has a spinlock word */
+#if defined(LINUX) && !defined(OMRZTPF) && defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_MCS_LOCKS) && !defined(OMR_THR_SPIN_WAKE_CONTROL)
+#define OMR_THR_FUTEX_MONITORS
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -141,6 +146,13 @@ paint_stack(omrthread_t thread);
 uint64_t
 omrthread_get_hires_clock(void);
 
+/**
+ * @brief Return the number of omrthread_get_hires_clock() ticks per second, 0 if unknown.
+ * @return uint64_t
+ */
+uint64_t
+omrthread_get_hires_clock_frequency(void);
+
 /* ------------- omrthreadnuma.c ------------ */
 void
 omrthread_numa_init(omrthread_library_t threadLibrary);
@@ -261,6 +273,76 @@ initialize_thread_priority(omrthread_t thread);
 intptr_t
 set_priority_spread(void);
 
+/* ---------------- omrthreadcontention.cpp ---------------- */
+
+#if defined(OMR_THR_THREE_TIER_LOCKING)
+/**
+ * State of a sampled three-tier monitor enter from the time it first fails to get the spinlock.
+ */
+typedef struct J9ThreadContentionBlock {
+	uint64_t startTime; /* 0 if the enter is not sampled */
+	uintptr_t frameCount;
+	uintptr_t frames[J9THREAD_CONTENTION_MAX_FRAMES];
+} J9ThreadContentionBlock;
+
+/**
+ * @brief Count a contended enter and, if it is sampled, capture the caller's stack and start timing it.
+ * @param lib thread library, whose contentionProfiler must not be NULL
+ * @param[out] block set up for omrthread_contention_block_end()
+ * @return void
+ */
+void
+omrthread_contention_block_start(omrthread_library_t lib, J9ThreadContentionBlock *block);
+
+/**
+ * @brief Charge the time a sampled enter was blocked to its (monitor, stack) entry.
+ * @param lib thread library
+ * @param monitor the monitor now owned by the current thread
+ * @param block as set up by omrthread_contention_block_start()
+ * @return void
+ */
+void
+omrthread_contention_block_end(omrthread_library_t lib, omrthread_monitor_t monitor, J9ThreadContentionBlock *block);
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
+
+/**
+ * @brief Free the contention profiler when the thread library shuts down.
+ * @param lib thread library
+ * @return void
+ */
+void
+omrthread_contention_profiler_free(omrthread_library_t lib);
+
+/* ---------------- omrthreadfutex.cpp ---------------- */
+
+#if defined(OMR_THR_FUTEX_MONITORS)
+/**
+ * @brief Read the futex sequence of a J9THREAD_MONITOR_FUTEX monitor, before trying its spinlock for the last time.
+ * @param monitor
+ * @return the sequence to pass to omrthread_futex_monitor_park()
+ */
+uint32_t
+omrthread_futex_monitor_sequence(omrthread_monitor_t monitor);
+
+/**
+ * @brief Sleep until the monitor's futex sequence moves on from sequence. May return spuriously.
+ * @param monitor
+ * @param sequence as returned by omrthread_futex_monitor_sequence()
+ * @return void
+ */
+void
+omrthread_futex_monitor_park(omrthread_monitor_t monitor, uint32_t sequence);
+
+/**
+ * @brief Wake one, or all, of the threads parked on the monitor.
+ * @param monitor
+ * @param wakeAll TRUE to wake every parked thread
+ * @return void
+ */
+void
+omrthread_futex_monitor_wake(omrthread_monitor_t monitor, BOOLEAN wakeAll);
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 #if defined(OMR_THR_FORK_SUPPORT)
 /**
  * @param [in] omrthread_rwmutex_t rwmutex to reset
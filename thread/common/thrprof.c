@@ -56,6 +56,12 @@
 #define I32MAXVAL	0x7FFFFFFF
 #endif
 
+#if defined(LINUXPPC)
+#include <sys/platform/ppc.h> /* for __ppc_get_timebase_freq() */
+#elif defined(AIXPPC) /* defined(LINUXPPC) */
+#include <sys/systemcfg.h> /* for _system_configuration */
+#endif /* defined(LINUXPPC) */
+
 #if defined(LINUX)
 /* pthread_getcpuclockid() is not always declared in pthread.h */
 extern int pthread_getcpuclockid(pthread_t thread_id, clockid_t *clock_id);
@@ -859,6 +865,46 @@ omrthread_get_hires_clock(void)
 #endif /* defined(OSX) */
 }
 
+/**
+ * Return the frequency of omrthread_get_hires_clock().  Only the platforms which
+ * read a raw time base, and Windows, tick at anything other than 1GHz.
+ *
+ * @return ticks per second, or 0 if the frequency is not known on this platform
+ */
+uint64_t
+omrthread_get_hires_clock_frequency(void)
+{
+#if (defined(LINUX) && (defined(J9HAMMER) || defined(J9X86) || defined(RISCV64))) || defined(OSX)
+	return J9CONST_U64(1000000000);
+#elif defined(OMR_OS_WINDOWS) /* (defined(LINUX) && (defined(J9HAMMER) || defined(J9X86) || defined(RISCV64))) || defined(OSX) */
+	LARGE_INTEGER i;
+
+	if (QueryPerformanceFrequency(&i)) {
+		return (uint64_t)i.QuadPart;
+	} else {
+		/* omrthread_get_hires_clock() falls back to GetTickCount(), in milliseconds */
+		return 1000;
+	}
+#elif defined(LINUX) && (defined(OMR_ARCH_ARM) || defined(OMR_ARCH_RISCV)) /* defined(OMR_OS_WINDOWS) */
+	/* getTimebase() reads the monotonic clock in nanoseconds */
+	return J9CONST_U64(1000000000);
+#elif defined(AARCH64) /* defined(LINUX) && (defined(OMR_ARCH_ARM) || defined(OMR_ARCH_RISCV)) */
+	uint64_t frequency = 0;
+	asm volatile("mrs %0, cntfrq_el0" : "=r" (frequency));
+	return frequency;
+#elif (defined(LINUX) && defined(S390)) || defined(J9ZOS390) /* defined(AARCH64) */
+	/* bit 51 of the TOD clock ticks once a microsecond */
+	return J9CONST_U64(4096000000);
+#elif defined(LINUXPPC) /* (defined(LINUX) && defined(S390)) || defined(J9ZOS390) */
+	return __ppc_get_timebase_freq();
+#elif defined(AIXPPC) /* defined(LINUXPPC) */
+	/* the time base advances Xfrac ticks every Xint nanoseconds */
+	return (J9CONST_U64(1000000000) * _system_configuration.Xfrac) / _system_configuration.Xint;
+#else /* defined(AIXPPC) */
+	return 0;
+#endif /* defined(AIXPPC) */
+}
+
 #define THREAD_WALK_RESOURCE_USAGE_MUTEX_HELD	0x1
 #define THREAD_WALK_MONITOR_MUTEX_HELD			0x2
 
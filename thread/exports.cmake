@@ -101,6 +101,19 @@ omr_add_exports(j9thr_obj
 	omrthread_rwmutex_try_enter_write
 	omrthread_rwmutex_exit_write
 	omrthread_rwmutex_is_writelocked
+	omrthread_contention_profiler_start
+	omrthread_contention_profiler_stop
+	omrthread_contention_profiler_dump
+	omrthread_contention_profiler_report
+	omrthread_taskpool_create
+	omrthread_taskpool_destroy
+	omrthread_taskpool_parallel_for
+	omrthread_taskgroup_create
+	omrthread_taskgroup_destroy
+	omrthread_taskgroup_submit
+	omrthread_taskgroup_join
+	omrthread_taskgroup_cancel
+	omrthread_taskgroup_is_cancelled
 	omrthread_park
 	omrthread_unpark
 	omrthread_numa_get_max_node
@@ -0,0 +1,74 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Thread
+ * @brief Futex parking for monitors created with J9THREAD_MONITOR_FUTEX
+ *
+ * The monitor's spinlockState stays the lock word.  A thread which cannot get it sets it to
+ * J9THREAD_MONITOR_SPINLOCK_EXCEEDED and sleeps in the kernel on the monitor's futexSequence, so an
+ * exit which swaps EXCEEDED out only has to bump the sequence and wake one sleeper, without taking
+ * the monitor's mutex.  A sleeper reads the sequence before it looks at the lock word, so a wake
+ * which lands between the two is never lost.
+ */
+
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "AtomicSupport.hpp"
+
+#include "threaddef.h"
+#include "thread_internal.h"
+
+extern "C" {
+
+#if defined(OMR_THR_FUTEX_MONITORS)
+
+uint32_t
+omrthread_futex_monitor_sequence(omrthread_monitor_t monitor)
+{
+	uint32_t sequence = monitor->futexSequence;
+	/* the sequence must be read before the lock word the caller swaps next */
+	VM_AtomicSupport::readWriteBarrier();
+	return sequence;
+}
+
+void
+omrthread_futex_monitor_park(omrthread_monitor_t monitor, uint32_t sequence)
+{
+	/* returns at once if the sequence has moved on; EINTR and spurious returns are retried by the caller */
+	syscall(SYS_futex, &monitor->futexSequence, FUTEX_WAIT_PRIVATE, sequence, NULL, NULL, 0);
+}
+
+void
+omrthread_futex_monitor_wake(omrthread_monitor_t monitor, BOOLEAN wakeAll)
+{
+	VM_AtomicSupport::addU32(&monitor->futexSequence, 1);
+	syscall(SYS_futex, &monitor->futexSequence, FUTEX_WAKE_PRIVATE, wakeAll ? INT_MAX : 1, NULL, NULL, 0);
+}
+
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
+} /* extern "C" */
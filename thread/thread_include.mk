@@ -33,12 +33,14 @@ OBJECTS :=\
   j9sem \
   omrthread \
   omrthreadattr \
+  omrthreadcontention \
   omrthreaddebug \
   omrthreaderror \
   omrthreadinspect \
   omrthreadmem \
   omrthreadnuma \
   omrthreadpriority \
+  omrthreadtaskpool \
   omrthreadtls \
   priority \
   thrcreate \
@@ -70,6 +72,7 @@ ifeq (zos,$(OMR_HOST_OS))
 endif
 
 ifeq ($(OMR_HOST_OS),$(filter $(OMR_HOST_OS),linux linux_ztpf))
+  OBJECTS += omrthreadfutex
   vpath % $(THREAD_SRCDIR)linux
   vpath % $(THREAD_SRCDIR)unix
   MODULE_INCLUDES += $(THREAD_SRCDIR)linux $(THREAD_SRCDIR)unix
@@ -209,6 +212,19 @@ define WRITE_COMMON_THREAD_EXPORTS
 @echo omrthread_rwmutex_try_enter_write >>$@
 @echo omrthread_rwmutex_exit_write >>$@
 @echo omrthread_rwmutex_is_writelocked >>$@
+@echo omrthread_contention_profiler_start >>$@
+@echo omrthread_contention_profiler_stop >>$@
+@echo omrthread_contention_profiler_dump >>$@
+@echo omrthread_contention_profiler_report >>$@
+@echo omrthread_taskpool_create >>$@
+@echo omrthread_taskpool_destroy >>$@
+@echo omrthread_taskpool_parallel_for >>$@
+@echo omrthread_taskgroup_create >>$@
+@echo omrthread_taskgroup_destroy >>$@
+@echo omrthread_taskgroup_submit >>$@
+@echo omrthread_taskgroup_join >>$@
+@echo omrthread_taskgroup_cancel >>$@
+@echo omrthread_taskgroup_is_cancelled >>$@
 @echo omrthread_park >>$@
 @echo omrthread_unpark >>$@
 @echo omrthread_numa_get_max_node >>$@
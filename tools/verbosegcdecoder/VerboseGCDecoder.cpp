@@ -0,0 +1,542 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "VerboseGCDecoder.hpp"
+
+/* width or precision not given, as in omrstr_vprintf */
+#define NO_VALUE ((uint64_t)-1)
+
+static const char digitsDecimal[] = "0123456789";
+static const char digitsHexLower[] = "0123456789abcdef";
+static const char digitsHexUpper[] = "0123456789ABCDEF";
+
+void
+VerboseGCDecoder::displayUsage()
+{
+	fprintf(stderr, "verbosegcdecoder usage:\n");
+	fprintf(stderr, "  verbosegcdecoder <binary verbose GC log> [<output XML file>]\n");
+	fprintf(stderr, "  Converts a log written with -Xgc:binaryLogging to verbose GC XML. Writes to stdout if no output file is given.\n");
+}
+
+RCType
+VerboseGCDecoder::parseOptions(int argc, char *argv[], const char **inputFileName, const char **outputFileName)
+{
+	if ((argc < 2) || (argc > 3)) {
+		displayUsage();
+		return RC_FAILED;
+	}
+	*inputFileName = argv[1];
+	*outputFileName = (3 == argc) ? argv[2] : NULL;
+	return RC_OK;
+}
+
+RCType
+VerboseGCDecoder::decodeFile(const char *inputFileName, const char *outputFileName)
+{
+	RCType rc = RC_FAILED;
+	FILE *input = fopen(inputFileName, "rb");
+	if (NULL == input) {
+		fprintf(stderr, "Failed to open %s for reading\n", inputFileName);
+		return RC_FAILED;
+	}
+
+	FILE *output = stdout;
+	if (NULL != outputFileName) {
+		output = fopen(outputFileName, "wb");
+		if (NULL == output) {
+			fprintf(stderr, "Failed to open %s for writing\n", outputFileName);
+			fclose(input);
+			return RC_FAILED;
+		}
+	}
+
+	rc = decode(input, output);
+
+	fclose(input);
+	if (stdout != output) {
+		if (0 != fclose(output)) {
+			rc = RC_FAILED;
+		}
+	} else {
+		fflush(output);
+	}
+	return rc;
+}
+
+RCType
+VerboseGCDecoder::decode(FILE *input, FILE *output)
+{
+	_input = input;
+	_output = output;
+
+	RCType rc = readFileHeader();
+	while (RC_OK == rc) {
+		VerboseBinaryRecordHeader header;
+		size_t headerRead = fread(&header, 1, sizeof(header), _input);
+		if (0 == headerRead) {
+			break;
+		}
+		if (sizeof(header) != headerRead) {
+			fprintf(stderr, "Warning: log ends in a partial record, output is truncated\n");
+			break;
+		}
+		if ((header.size < sizeof(header))
+			|| (0 != (header.size % VERBOSEGC_BINARY_RECORD_ALIGNMENT))
+			|| (header.payloadSize > (header.size - sizeof(header)))
+		) {
+			fprintf(stderr, "Corrupt record at offset %ld\n", ftell(_input) - (long)sizeof(header));
+			rc = RC_FAILED;
+			break;
+		}
+
+		uint32_t bodySize = header.size - (uint32_t)sizeof(header);
+		if (bodySize > _payloadCapacity) {
+			uint8_t *payload = (uint8_t *)realloc(_payload, bodySize);
+			if (NULL == payload) {
+				fprintf(stderr, "Failed to allocate %u bytes\n", bodySize);
+				rc = RC_FAILED;
+				break;
+			}
+			_payload = payload;
+			_payloadCapacity = bodySize;
+		}
+		if (bodySize != fread(_payload, 1, bodySize, _input)) {
+			fprintf(stderr, "Warning: log ends in a partial record, output is truncated\n");
+			break;
+		}
+
+		switch (header.type) {
+		case VERBOSEGC_BINARY_RECORD_FORMAT:
+			rc = defineFormat(header.formatID, (const char *)_payload, header.payloadSize);
+			break;
+		case VERBOSEGC_BINARY_RECORD_EVENT:
+			rc = writeEvent(header.formatID, header.indent, header.payloadSize);
+			break;
+		case VERBOSEGC_BINARY_RECORD_LINE:
+			writeIndent(header.indent);
+			fwrite(_payload, 1, header.payloadSize, _output);
+			fputc('\n', _output);
+			break;
+		case VERBOSEGC_BINARY_RECORD_TEXT:
+			fwrite(_payload, 1, header.payloadSize, _output);
+			break;
+		default:
+			/* records added by later versions are skipped */
+			break;
+		}
+	}
+
+	if ((RC_OK == rc) && ferror(_output)) {
+		fprintf(stderr, "Failed to write output\n");
+		rc = RC_FAILED;
+	}
+	return rc;
+}
+
+RCType
+VerboseGCDecoder::readFileHeader()
+{
+	VerboseBinaryFileHeader header;
+	char eyecatcher[sizeof(header.eyecatcher)];
+	uint16_t byteOrderProbe = 1;
+	uint8_t bigEndian = (0 == *(uint8_t *)&byteOrderProbe) ? 1 : 0;
+
+	memset(eyecatcher, 0, sizeof(eyecatcher));
+	strcpy(eyecatcher, VERBOSEGC_BINARY_EYECATCHER);
+	if ((sizeof(header) != fread(&header, 1, sizeof(header), _input))
+		|| (0 != memcmp(eyecatcher, header.eyecatcher, sizeof(eyecatcher)))
+	) {
+		fprintf(stderr, "Not a binary verbose GC log\n");
+		return RC_FAILED;
+	}
+	if (bigEndian != header.bigEndian) {
+		fprintf(stderr, "Log was written with a different byte order; decode it on a %s endian host\n", (0 != header.bigEndian) ? "big" : "little");
+		return RC_FAILED;
+	}
+	if (VERBOSEGC_BINARY_VERSION < header.version) {
+		fprintf(stderr, "Unsupported log version %u\n", (unsigned int)header.version);
+		return RC_FAILED;
+	}
+	if ((4 != header.pointerSize) && (8 != header.pointerSize)) {
+		fprintf(stderr, "Unsupported pointer size %u\n", (unsigned int)header.pointerSize);
+		return RC_FAILED;
+	}
+	_pointerSize = header.pointerSize;
+	return RC_OK;
+}
+
+RCType
+VerboseGCDecoder::defineFormat(uint32_t formatID, const char *format, uint32_t length)
+{
+	if (formatID >= _formatsSize) {
+		uint32_t newSize = (formatID + 1) * 2;
+		char **formats = (char **)realloc(_formats, newSize * sizeof(char *));
+		if (NULL == formats) {
+			fprintf(stderr, "Failed to allocate format table\n");
+			return RC_FAILED;
+		}
+		memset(formats + _formatsSize, 0, (newSize - _formatsSize) * sizeof(char *));
+		_formats = formats;
+		_formatsSize = newSize;
+	}
+
+	char *copy = (char *)malloc(length + 1);
+	if (NULL == copy) {
+		fprintf(stderr, "Failed to allocate format\n");
+		return RC_FAILED;
+	}
+	memcpy(copy, format, length);
+	copy[length] = '\0';
+	free(_formats[formatID]);
+	_formats[formatID] = copy;
+	return RC_OK;
+}
+
+void
+VerboseGCDecoder::writeIndent(uint32_t indent)
+{
+	for (uint32_t i = 0; i < indent; i++) {
+		fputs(VERBOSEGC_BINARY_INDENT, _output);
+	}
+}
+
+RCType
+VerboseGCDecoder::writeEvent(uint32_t formatID, uint32_t indent, uint32_t payloadSize)
+{
+	if ((formatID >= _formatsSize) || (NULL == _formats[formatID])) {
+		fprintf(stderr, "Event refers to undefined format %u\n", formatID);
+		return RC_FAILED;
+	}
+
+	const char *format = _formats[formatID];
+	const uint8_t *cursor = _payload;
+	const uint8_t *end = _payload + payloadSize;
+
+	/* read the next 8 byte argument, failing the event if the payload is exhausted */
+#define NEXT_VALUE(value) \
+	do { \
+		if ((uintptr_t)(end - cursor) < sizeof(uint64_t)) { \
+			goto truncated; \
+		} \
+		memcpy(&(value), cursor, sizeof(uint64_t)); \
+		cursor += sizeof(uint64_t); \
+	} while (0)
+
+	writeIndent(indent);
+	while ('\0' != *format) {
+		if ('%' != *format) {
+			fputc(*format++, _output);
+			continue;
+		}
+		format += 1;
+		if ('%' == *format) {
+			fputc('%', _output);
+			format += 1;
+			continue;
+		}
+
+		/* the writer only records formats of this shape; see MM_VerboseWriterFileLoggingBinary::parseFormat() */
+		char flag = '\0';
+		if (('\0' != *format) && (NULL != strchr("0 -+#", *format))) {
+			flag = *format++;
+		}
+
+		uint64_t width = NO_VALUE;
+		uint64_t precision = NO_VALUE;
+		if ('*' == *format) {
+			NEXT_VALUE(width);
+			width = (uint32_t)width;
+			format += 1;
+		} else if (('0' <= *format) && ('9' >= *format)) {
+			width = 0;
+			while (('0' <= *format) && ('9' >= *format)) {
+				width = (width * 10) + (*format++ - '0');
+			}
+		}
+		if ('.' == *format) {
+			format += 1;
+			if ('*' == *format) {
+				NEXT_VALUE(precision);
+				precision = (uint32_t)precision;
+				format += 1;
+			} else if (('0' <= *format) && ('9' >= *format)) {
+				precision = 0;
+				while (('0' <= *format) && ('9' >= *format)) {
+					precision = (precision * 10) + (*format++ - '0');
+				}
+			}
+		}
+
+		bool isLongLong = false;
+		if ('z' == *format) {
+			isLongLong = (8 == _pointerSize);
+			format += 1;
+		} else if ('l' == *format) {
+			format += 1;
+			if ('l' == *format) {
+				isLongLong = true;
+				format += 1;
+			}
+		}
+
+		uint64_t value = 0;
+		switch (*format) {
+		case 'i':
+		case 'd':
+			NEXT_VALUE(value);
+			writeInteger(width, precision, value, flag, true, isLongLong, digitsDecimal);
+			break;
+		case 'u':
+			NEXT_VALUE(value);
+			writeInteger(width, precision, value, flag, false, isLongLong, digitsDecimal);
+			break;
+		case 'x':
+			NEXT_VALUE(value);
+			writeInteger(width, precision, value, flag, false, isLongLong, digitsHexLower);
+			break;
+		case 'X':
+			NEXT_VALUE(value);
+			writeInteger(width, precision, value, flag, false, isLongLong, digitsHexUpper);
+			break;
+		case 'p':
+			/* omrstr_vprintf prints pointers as zero padded upper case hex, without a prefix */
+			NEXT_VALUE(value);
+			writeInteger(_pointerSize * 2, _pointerSize * 2, value, '\0', false, true, digitsHexUpper);
+			break;
+		case 'c':
+		{
+			NEXT_VALUE(value);
+			for (uint64_t i = 1; (NO_VALUE != width) && (i < width); i++) {
+				fputc(' ', _output);
+			}
+			fputc((char)value, _output);
+			break;
+		}
+		case 's':
+		{
+			uint32_t length = 0;
+			if ((uintptr_t)(end - cursor) < sizeof(length)) {
+				goto truncated;
+			}
+			memcpy(&length, cursor, sizeof(length));
+			cursor += sizeof(length);
+			if (VERBOSEGC_BINARY_NULL_STRING == length) {
+				writeString(width, precision, "<NULL>", strlen("<NULL>"), flag);
+			} else {
+				if ((uintptr_t)(end - cursor) < length) {
+					goto truncated;
+				}
+				writeString(width, precision, (const char *)cursor, length, flag);
+				cursor += length;
+			}
+			break;
+		}
+		case 'f':
+		case 'e':
+		case 'E':
+		case 'F':
+		case 'g':
+		case 'G':
+		{
+			double dbl = 0.0;
+			char doubleFormat[64];
+			char doubleBuffer[512];
+			char *formatCursor = doubleFormat;
+			NEXT_VALUE(value);
+			memcpy(&dbl, &value, sizeof(dbl));
+			*formatCursor++ = '%';
+			if ('\0' != flag) {
+				*formatCursor++ = flag;
+			}
+			if (NO_VALUE != width) {
+				formatCursor += sprintf(formatCursor, "%u", (unsigned int)width);
+			}
+			if (NO_VALUE != precision) {
+				formatCursor += sprintf(formatCursor, ".%u", (unsigned int)precision);
+			}
+			*formatCursor++ = *format;
+			*formatCursor = '\0';
+			snprintf(doubleBuffer, sizeof(doubleBuffer), doubleFormat, dbl);
+			fputs(doubleBuffer, _output);
+			break;
+		}
+		default:
+			fprintf(stderr, "Format %u uses an unsupported conversion\n", formatID);
+			return RC_FAILED;
+		}
+		format += 1;
+	}
+	fputc('\n', _output);
+	return RC_OK;
+
+truncated:
+	fprintf(stderr, "Event for format %u has too few arguments\n", formatID);
+	return RC_FAILED;
+#undef NEXT_VALUE
+}
+
+/**
+ * Write an integer the way omrstr_vprintf does. Unlike C printf, the '0' flag applies
+ * together with a precision, and 32 bit conversions only look at the low 32 bits.
+ */
+void
+VerboseGCDecoder::writeInteger(uint64_t width, uint64_t precision, uint64_t value, char flag, bool isSigned, bool isLongLong, const char *digits)
+{
+	char stackBuffer[128];
+	char *buffer = stackBuffer;
+	uint32_t length = 0;
+	uint32_t rightSpace = 0;
+	int32_t actualPrecision = 0;
+	char signChar = '\0';
+	uint64_t base = strlen(digits);
+	uint64_t temp = 0;
+
+	if (!isLongLong) {
+		value = (uint32_t)value;
+	}
+	if (isSigned) {
+		int64_t signedValue = isLongLong ? (int64_t)value : (int64_t)(int32_t)value;
+		if (signedValue < 0) {
+			signChar = '-';
+			value = (uint64_t)(signedValue * -1);
+		} else if ('+' == flag) {
+			signChar = '+';
+		}
+	}
+
+	temp = value;
+	do {
+		length += 1;
+		temp /= base;
+	} while (0 != temp);
+
+	if (NO_VALUE != precision) {
+		actualPrecision = (int32_t)precision;
+		if ((uint32_t)actualPrecision > length) {
+			length = actualPrecision;
+		}
+	}
+	if ('\0' != signChar) {
+		length += 1;
+	}
+	if (NO_VALUE != width) {
+		uint32_t actualWidth = (uint32_t)width;
+		if (actualWidth > length) {
+			if ('-' == flag) {
+				rightSpace = actualWidth - length;
+			}
+			length = actualWidth;
+		}
+	}
+	if ('0' == flag) {
+		actualPrecision = length - (('\0' != signChar) ? 1 : 0);
+	}
+
+	if (length > sizeof(stackBuffer)) {
+		buffer = (char *)malloc(length);
+		if (NULL == buffer) {
+			return;
+		}
+	}
+
+	/* fill the number in backwards */
+	uint32_t total = length;
+	for (; 0 != rightSpace; rightSpace--) {
+		buffer[--length] = ' ';
+	}
+	temp = value;
+	do {
+		length -= 1;
+		actualPrecision -= 1;
+		buffer[length] = digits[temp % base];
+		temp /= base;
+	} while (0 != temp);
+	while (length > 0) {
+		length -= 1;
+		actualPrecision -= 1;
+		if (actualPrecision >= 0) {
+			buffer[length] = '0';
+		} else if ('\0' != signChar) {
+			buffer[length] = signChar;
+			signChar = '\0';
+		} else {
+			buffer[length] = ' ';
+		}
+	}
+
+	fwrite(buffer, 1, total, _output);
+	if (stackBuffer != buffer) {
+		free(buffer);
+	}
+}
+
+void
+VerboseGCDecoder::writeString(uint64_t width, uint64_t precision, const char *value, uint64_t length, char flag)
+{
+	if ((NO_VALUE == precision) || (precision > length)) {
+		precision = length;
+	}
+	if (NO_VALUE == width) {
+		width = precision;
+	}
+	uint64_t padding = (width > precision) ? (width - precision) : 0;
+
+	if ('-' != flag) {
+		for (uint64_t i = 0; i < padding; i++) {
+			fputc(' ', _output);
+		}
+	}
+	fwrite(value, 1, (size_t)precision, _output);
+	if ('-' == flag) {
+		for (uint64_t i = 0; i < padding; i++) {
+			fputc(' ', _output);
+		}
+	}
+}
+
+void
+VerboseGCDecoder::tearDown()
+{
+	for (uint32_t i = 0; i < _formatsSize; i++) {
+		free(_formats[i]);
+	}
+	free(_formats);
+	_formats = NULL;
+	_formatsSize = 0;
+	free(_payload);
+	_payload = NULL;
+	_payloadCapacity = 0;
+}
+
+RCType
+startVerboseGCDecoder(int argc, char *argv[])
+{
+	const char *inputFileName = NULL;
+	const char *outputFileName = NULL;
+	RCType rc = VerboseGCDecoder::parseOptions(argc, argv, &inputFileName, &outputFileName);
+	if (RC_OK == rc) {
+		VerboseGCDecoder decoder;
+		rc = decoder.decodeFile(inputFileName, outputFileName);
+		decoder.tearDown();
+	}
+	return rc;
+}
@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef VERBOSEGCDECODER_HPP_
+#define VERBOSEGCDECODER_HPP_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "VerboseBinaryFormat.hpp"
+
+typedef enum RCType {
+	RC_OK = 0,
+	RC_FAILED = -1,
+	RCType_EnsureWideEnum = 0x1000000 /* force 4-byte enum */
+} RCType;
+
+RCType startVerboseGCDecoder(int argc, char *argv[]);
+
+/**
+ * Converts a binary verbose GC log (-Xgc:binaryLogging) back to the XML the text writers
+ * produce (gc/verbose/schema.xsd). Records are decoded one at a time, so logs of any size
+ * and logs cut short by a crash can be decoded.
+ */
+class VerboseGCDecoder
+{
+	/*
+	 * Data members
+	 */
+private:
+	FILE *_input;
+	FILE *_output;
+	char **_formats; /**< format strings indexed by formatID, owned */
+	uint32_t _formatsSize;
+	uint8_t *_payload; /**< current record payload */
+	uint32_t _payloadCapacity;
+	uint8_t _pointerSize; /**< sizeof(uintptr_t) in the process that wrote the log */
+protected:
+public:
+
+private:
+	RCType readFileHeader();
+	RCType defineFormat(uint32_t formatID, const char *format, uint32_t length);
+	RCType writeEvent(uint32_t formatID, uint32_t indent, uint32_t payloadSize);
+	void writeIndent(uint32_t indent);
+	void writeInteger(uint64_t width, uint64_t precision, uint64_t value, char flag, bool isSigned, bool isLongLong, const char *digits);
+	void writeString(uint64_t width, uint64_t precision, const char *value, uint64_t length, char flag);
+
+	static void displayUsage();
+
+protected:
+public:
+	VerboseGCDecoder()
+		: _input(NULL)
+		, _output(NULL)
+		, _formats(NULL)
+		, _formatsSize(0)
+		, _payload(NULL)
+		, _payloadCapacity(0)
+		, _pointerSize(sizeof(uintptr_t))
+	{
+	}
+
+	~VerboseGCDecoder()
+	{
+	}
+
+	/**
+	 * Decode a binary log into an XML file.
+	 * @param[in] inputFileName the binary log
+	 * @param[in] outputFileName the XML file to write, or NULL for stdout
+	 * @return RC_OK if the whole log was decoded
+	 */
+	RCType decodeFile(const char *inputFileName, const char *outputFileName);
+
+	/**
+	 * Decode a binary log from an open stream.
+	 */
+	RCType decode(FILE *input, FILE *output);
+
+	void tearDown();
+
+	static RCType parseOptions(int argc, char *argv[], const char **inputFileName, const char **outputFileName);
+};
+
+#endif /* VERBOSEGCDECODER_HPP_ */
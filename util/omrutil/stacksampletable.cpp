@@ -0,0 +1,229 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "stacksampletable.h"
+#include "AtomicSupport.hpp"
+
+/* room for the frames omrintrospect_backtrace_thread() allocates while walking a stack */
+#define STACK_SAMPLE_WALK_HEAP_SIZE (64 * (sizeof(J9PlatformStackFrame) + (4 * sizeof(uintptr_t))))
+
+extern "C" {
+
+/**
+ * Find the number of frames stackSampleTableCapture() sees inside the stack walk.  The stack is captured again from
+ * another call site, the frames the two captures have in common up to the first difference are the walk's own.
+ */
+static uintptr_t
+countStackWalkFrames(OMRStackSampleTable *table, uintptr_t *frames, uintptr_t frameCount)
+{
+	uintptr_t otherFrames[OMR_STACK_SAMPLE_MAX_FRAMES];
+	uintptr_t otherFrameCount = stackSampleTableCapture(table, otherFrames, OMR_STACK_SAMPLE_MAX_FRAMES);
+	uintptr_t commonFrames = 0;
+
+	while ((commonFrames < frameCount) && (commonFrames < otherFrameCount) && (frames[commonFrames] == otherFrames[commonFrames])) {
+		commonFrames += 1;
+	}
+
+	/* if the stacks never differ the walk did not get past its own frames, keep everything */
+	return ((commonFrames < frameCount) && (commonFrames < otherFrameCount)) ? commonFrames : 0;
+}
+
+void
+stackSampleTableInit(OMRStackSampleTable *table, OMRPortLibrary *portLibrary, OMRStackSample *samples, uintptr_t size)
+{
+	memset(samples, 0, sizeof(OMRStackSample) * size);
+	table->portLibrary = portLibrary;
+	table->size = size;
+	table->skipFrames = 0;
+	table->recordedCount = 0;
+	table->droppedCount = 0;
+	table->samples = samples;
+
+	uintptr_t frames[OMR_STACK_SAMPLE_MAX_FRAMES];
+	uintptr_t frameCount = stackSampleTableCapture(table, frames, OMR_STACK_SAMPLE_MAX_FRAMES);
+	table->skipFrames = countStackWalkFrames(table, frames, frameCount);
+}
+
+uintptr_t
+stackSampleTableCapture(OMRStackSampleTable *table, uintptr_t *frames, uintptr_t maxFrames)
+{
+	uintptr_t frameCount = 0;
+
+#if defined(LINUX) || defined(AIXPPC)
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	/* the walk allocates its frames from a heap on the stack so that it never calls malloc */
+	uintptr_t heapBuffer[STACK_SAMPLE_WALK_HEAP_SIZE / sizeof(uintptr_t)];
+	J9Heap *heap = omrheap_create(heapBuffer, sizeof(heapBuffer), 0);
+	ucontext_t context;
+
+	if ((NULL != heap) && (0 == getcontext(&context))) {
+		J9PlatformThread thread;
+		memset(&thread, 0, sizeof(thread));
+		thread.context = &context;
+		omrintrospect_backtrace_thread(&thread, heap, NULL);
+
+		uintptr_t skipFrames = table->skipFrames;
+		for (J9PlatformStackFrame *frame = thread.callstack; (NULL != frame) && (frameCount < maxFrames); frame = frame->parent_frame) {
+			if (0 < skipFrames) {
+				skipFrames -= 1;
+			} else {
+				frames[frameCount] = frame->instruction_pointer;
+				frameCount += 1;
+			}
+		}
+	}
+#endif /* defined(LINUX) || defined(AIXPPC) */
+
+	return frameCount;
+}
+
+BOOLEAN
+stackSampleTableRecord(OMRStackSampleTable *table, uintptr_t key, const char *name, uintptr_t *frames, uintptr_t frameCount, uint64_t weight, uint64_t extra)
+{
+	uint64_t hash64 = (uint64_t)key ^ (uint64_t)frameCount;
+	for (uintptr_t i = 0; i < frameCount; i++) {
+		hash64 = (hash64 ^ (uint64_t)frames[i]) * (uint64_t)11400714819323198485ULL;
+	}
+	uintptr_t hash = (uintptr_t)(hash64 ^ (hash64 >> 32));
+	if (OMR_STACK_SAMPLE_HASH_CLAIMED >= hash) {
+		hash += OMR_STACK_SAMPLE_HASH_CLAIMED + 1;
+	}
+
+	for (uintptr_t probe = 0; probe < table->size; probe++) {
+		OMRStackSample *sample = &table->samples[(hash + probe) & (table->size - 1)];
+		uintptr_t sampleHash = sample->hash;
+
+		if (0 == sampleHash) {
+			if (0 == VM_AtomicSupport::lockCompareExchange(&sample->hash, 0, OMR_STACK_SAMPLE_HASH_CLAIMED)) {
+				sample->key = key;
+				if (NULL != name) {
+					strncpy(sample->name, name, OMR_STACK_SAMPLE_NAME_LENGTH - 1);
+				}
+				sample->frameCount = frameCount;
+				memcpy(sample->frames, frames, frameCount * sizeof(uintptr_t));
+				/* the key must be visible before the hash which tells other threads it is there */
+				VM_AtomicSupport::writeBarrier();
+				sample->hash = hash;
+				sampleHash = hash;
+			} else {
+				sampleHash = sample->hash;
+			}
+		}
+
+		/* another thread is writing its key to the sample, which could be this one */
+		while (OMR_STACK_SAMPLE_HASH_CLAIMED == sampleHash) {
+			VM_AtomicSupport::yieldCPU();
+			sampleHash = sample->hash;
+		}
+		VM_AtomicSupport::readBarrier();
+
+		if ((hash == sampleHash) && (key == sample->key) && (frameCount == sample->frameCount)
+			&& (0 == memcmp(sample->frames, frames, frameCount * sizeof(uintptr_t)))
+		) {
+			VM_AtomicSupport::add(&sample->sampleCount, 1);
+			VM_AtomicSupport::addU64(&sample->weight, weight);
+			VM_AtomicSupport::addU64(&sample->extra, extra);
+			uint64_t maxWeight = sample->maxWeight;
+			while ((weight > maxWeight)
+				&& (maxWeight != VM_AtomicSupport::lockCompareExchangeU64(&sample->maxWeight, maxWeight, weight))
+			) {
+				maxWeight = sample->maxWeight;
+			}
+			VM_AtomicSupport::add(&table->recordedCount, 1);
+			return TRUE;
+		}
+	}
+
+	VM_AtomicSupport::add(&table->droppedCount, 1);
+	return FALSE;
+}
+
+uintptr_t
+stackSampleTableCount(OMRStackSampleTable *table)
+{
+	uintptr_t count = 0;
+	for (uintptr_t i = 0; i < table->size; i++) {
+		if (OMR_STACK_SAMPLE_HASH_CLAIMED < table->samples[i].hash) {
+			count += 1;
+		}
+	}
+	return count;
+}
+
+static int
+compareWeight(const void *left, const void *right)
+{
+	uint64_t leftWeight = (*(OMRStackSample **)left)->weight;
+	uint64_t rightWeight = (*(OMRStackSample **)right)->weight;
+	return (leftWeight > rightWeight) ? -1 : ((leftWeight < rightWeight) ? 1 : 0);
+}
+
+uintptr_t
+stackSampleTableSort(OMRStackSampleTable *table, OMRStackSample **sorted)
+{
+	uintptr_t count = 0;
+	for (uintptr_t i = 0; i < table->size; i++) {
+		OMRStackSample *sample = &table->samples[i];
+		if ((OMR_STACK_SAMPLE_HASH_CLAIMED < sample->hash) && (0 != sample->sampleCount)) {
+			sorted[count] = sample;
+			count += 1;
+		}
+	}
+	VM_AtomicSupport::readBarrier();
+	J9_SORT(sorted, count, sizeof(OMRStackSample *), compareWeight);
+	return count;
+}
+
+void
+stackSampleTablePrintStack(OMRStackSampleTable *table, intptr_t fd, OMRStackSample *sample, void *heapBuffer)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	/* resolve the stack in a scratch heap which is thrown away afterwards */
+	J9Heap *heap = omrheap_create(heapBuffer, OMR_STACK_SAMPLE_PRINT_HEAP_SIZE, 0);
+	J9PlatformThread thread;
+	memset(&thread, 0, sizeof(thread));
+	J9PlatformStackFrame **nextFrame = &thread.callstack;
+
+	for (uintptr_t frame = 0; (NULL != heap) && (frame < sample->frameCount); frame++) {
+		*nextFrame = (J9PlatformStackFrame *)omrheap_allocate(heap, sizeof(J9PlatformStackFrame));
+		if (NULL == *nextFrame) {
+			break;
+		}
+		memset(*nextFrame, 0, sizeof(J9PlatformStackFrame));
+		(*nextFrame)->instruction_pointer = sample->frames[frame];
+		nextFrame = &(*nextFrame)->parent_frame;
+	}
+	if (NULL != heap) {
+		omrintrospect_backtrace_symbols(&thread, heap);
+	}
+	for (J9PlatformStackFrame *frame = thread.callstack; NULL != frame; frame = frame->parent_frame) {
+		if (NULL != frame->symbol) {
+			omrfile_printf(fd, "\t%s\n", frame->symbol);
+		} else {
+			omrfile_printf(fd, "\t(%p)\n", (void *)frame->instruction_pointer);
+		}
+	}
+}
+
+} /* extern "C" */